@@ -4,12 +4,9 @@ const songSelector = document.getElementById("song-selector");
 const audioPlayer = document.getElementById("audio-player");
 const audioSource = document.getElementById("audio-source");
 const statusDiv = document.getElementById("status");
+const robotSpeaker = document.getElementById("robot-speaker");
 // ==================== LED CONTROL VARIABLES ====================
-        let currentLedPattern = "breathing";
-        let autoLedDanceMode = true;
-        let ledDancePatterns = ["dance", "rainbow", "pulse", "chase", "wave"]; // Patterns to cycle during dance
-        let currentPatternIndex = 0;
-        let ledDanceInterval = null;
+        let currentLedPattern = "breathing"; // During songs the robot plays its own LED cue track
 // ==================== DRAG AND DROP ELEMENTS ====================
 const dropZone = document.getElementById("drop-zone");
 const fileInput = document.getElementById("file-input");
@@ -25,6 +22,53 @@ let isPaused = false; // Track if we're in a paused state
 let uploadedFiles = [];
 let currentPlayingIndex = null; // Track which uploaded song is playing
 let isUploadedSongPlaying = false; // Track if currently playing song is uploaded or normal
+let currentAnalysis = null; // Tempo/energy analysis of the playing uploaded song
+
+// ==================== BINARY PROTOCOL ====================
+// Mirrors arduino/arduino/protocol.h
+const RB_PROTO_MAGIC = 0xb1;
+const RB_PROTO_VERSION = 1;
+const RB_OP = {
+  hello: 0x01, pause: 0x02, stop: 0x03, resume: 0x04, step: 0x05, song: 0x06,
+  speed: 0x07, led: 0x08, brightness: 0x09, tempo: 0x0a, energy: 0x0b, ping: 0x0c, at: 0x0d,
+  telemetry: 0x0e, step_depth: 0x0f, step_policy: 0x10,
+};
+const RB_MSG_HELLO = 0x81;
+const RB_MSG_ACK = 0x82;
+const RB_MSG_PONG = 0x83;
+const RB_MSG_TELEMETRY = 0x84;
+const RB_CAP_CLOCK = 0x0008;
+const RB_CAP_PCM = 0x0040;
+const RB_STATUS = ["ok", "bad version", "malformed", "rejected", "queue full", "cancelled"];
+const STEP_POLICY = { oldest: 0, newest: 1, coalesce: 2 };
+const LED_PATTERN_INDEX = {
+  off: 0, rainbow: 1, pulse: 2, chase: 3, strobe: 4, fire: 5, dance: 6, breathing: 11, wave: 12,
+  vu: 13, bass: 14, spectrum: 15,
+};
+
+let stepOverruns = 0; // Steps the robot's queue had to drop
+let robotProtocol = null; // { version, caps, maxFrame } once the robot says HELLO
+let batchSeq = 0;
+const pendingBatches = new Map(); // seq -> commands, until acked
+
+// ==================== CLOCK SYNC ====================
+// NTP-style: robotClockUs ~= performance.now() * 1000 + clockOffsetUs.
+// The sample with the lowest round trip of the last CLOCK_SAMPLES wins.
+const CLOCK_SAMPLES = 8;
+const CLOCK_PING_MS = 2000;
+const STEP_LEAD_MS = 300; // Scheduled steps are sent this far ahead
+let clockSamples = [];
+let clockOffsetUs = null;
+let clockRttUs = null;
+let pingId = 0;
+let pingTimer = null;
+const pingsInFlight = new Map(); // id -> client send time (us)
+
+// ==================== TELEMETRY ====================
+let latestTelemetry = null; // Last snapshot from the robot, see telemetry.h
+const TELEMETRY_FLAGS = ["dancing", "paused", "obstacle", "clap", "track", "cpg", "vm"];
+
+socket.binaryType = "arraybuffer";
 
 // WebSocket events
 socket.onopen = () => {
@@ -32,9 +76,81 @@ socket.onopen = () => {
 };
 
 socket.onmessage = (event) => {
+  if (event.data instanceof ArrayBuffer) {
+    handleBinaryMessage(new DataView(event.data));
+    return;
+  }
+  if (event.data.startsWith("step_overrun:")) {
+    // "step_overrun:<oldest|newest|coalesced>,<lost step>"
+    const [kind, step] = event.data.slice(13).split(",");
+    stepOverruns++;
+    console.warn(`Robot step queue full (${kind}), step ${step} lost`);
+    return;
+  }
   console.log("Received from ESP32:", event.data);
 };
 
+function handleBinaryMessage(view) {
+  if (view.byteLength < 3 || view.getUint8(0) !== RB_PROTO_MAGIC) return;
+  const type = view.getUint8(2);
+  if (type === RB_MSG_HELLO && view.byteLength >= 9) {
+    robotProtocol = {
+      version: view.getUint8(1),
+      caps: view.getUint32(3, true),
+      maxFrame: view.getUint16(7, true),
+    };
+    if (robotProtocol.version !== RB_PROTO_VERSION) robotProtocol = null;
+    console.log("Robot protocol:", robotProtocol);
+    if (robotProtocol && robotProtocol.caps & RB_CAP_CLOCK) startClockSync();
+  } else if (type === RB_MSG_PONG && view.byteLength >= 23) {
+    handlePong(view, performance.now() * 1000);
+  } else if (type === RB_MSG_TELEMETRY && view.byteLength >= 52) {
+    latestTelemetry = parseTelemetry(view);
+  } else if (type === RB_MSG_ACK && view.byteLength >= 7) {
+    const seq = view.getUint16(3, true);
+    const executed = view.getUint8(5);
+    const status = RB_STATUS[view.getUint8(6)] || "unknown";
+    const commands = pendingBatches.get(seq);
+    pendingBatches.delete(seq);
+    if (status !== "ok") {
+      console.log(`Batch ${seq} stopped after ${executed} commands (${status}):`, commands);
+    }
+  }
+}
+
+// Send several commands in one frame, e.g. [["song", "Faded"], ["led", "dance"], ["step", 1]].
+// Returns false (nothing sent) if the robot hasn't announced the binary protocol.
+function sendBatch(commands) {
+  if (!robotProtocol || socket.readyState !== WebSocket.OPEN) return false;
+  const seq = batchSeq;
+  batchSeq = (batchSeq + 1) & 0xffff;
+  const bytes = [RB_PROTO_MAGIC, RB_PROTO_VERSION, seq & 0xff, seq >> 8];
+  for (const [name, value] of commands) {
+    const op = RB_OP[name];
+    if (op === undefined) throw new Error(`Unknown command: ${name}`);
+    bytes.push(op);
+    if (name === "song") {
+      const encoded = new TextEncoder().encode(value).slice(0, 40);
+      bytes.push(encoded.length, ...encoded);
+    } else if (name === "led") {
+      bytes.push(LED_PATTERN_INDEX[value] ?? value);
+    } else if (name === "ping" || name === "at") {
+      // Little-endian u32 id or u64 robot time; BigInt keeps the high bits exact
+      let wide = BigInt(Math.round(value));
+      for (let i = 0; i < (name === "ping" ? 4 : 8); i++) {
+        bytes.push(Number(wide & 0xffn));
+        wide >>= 8n;
+      }
+    } else if (value !== undefined) {
+      bytes.push(value & 0xff);
+    }
+  }
+  if (bytes.length > robotProtocol.maxFrame) return false;
+  pendingBatches.set(seq, commands);
+  socket.send(new Uint8Array(bytes));
+  return true;
+}
+
 socket.onerror = (error) => {
   console.log("WebSocket Error:", error);
 };
@@ -213,6 +329,7 @@ function playUploadedFile(index) {
     currentPlayingIndex = index;
     isUploadedSongPlaying = true; // Mark as uploaded song
     playSelectedSong(fileObj.url, fileObj.name);
+    startProceduralDance(fileObj);
   }
 }
 
@@ -234,28 +351,279 @@ function removeUploadedFile(index) {
   console.log(`Removed file: ${fileObj.name}`);
 }
 
+// ==================== TEMPO / ENERGY ANALYSIS ====================
+
+// Decode an uploaded MP3 and estimate its tempo and loudness envelope.
+// The robot's oscillator engine (cpg.h) dances to these instead of
+// replaying steps authored for another song.
+async function analyzeSong(file) {
+  const AudioCtx = window.AudioContext || window.webkitAudioContext;
+  const ctx = new AudioCtx();
+  const buffer = await ctx.decodeAudioData(await file.arrayBuffer());
+  ctx.close();
+
+  // 100 Hz RMS envelope of the first channel
+  const envelopeRate = 100;
+  const data = buffer.getChannelData(0);
+  const frame = Math.floor(buffer.sampleRate / envelopeRate);
+  const envelope = new Float32Array(Math.floor(data.length / frame));
+  let peak = 0;
+  for (let i = 0; i < envelope.length; i++) {
+    let sum = 0;
+    for (let j = i * frame; j < (i + 1) * frame; j++) sum += data[j] * data[j];
+    envelope[i] = Math.sqrt(sum / frame);
+    peak = Math.max(peak, envelope[i]);
+  }
+
+  // Onset strength = positive envelope change; autocorrelate over 70-180 BPM
+  const onset = new Float32Array(envelope.length);
+  for (let i = 1; i < envelope.length; i++) {
+    onset[i] = Math.max(0, envelope[i] - envelope[i - 1]);
+  }
+  let bestLag = 50;
+  let bestScore = -1;
+  const minLag = Math.floor((60 * envelopeRate) / 180);
+  const maxLag = Math.ceil((60 * envelopeRate) / 70);
+  for (let lag = minLag; lag <= maxLag; lag++) {
+    let score = 0;
+    for (let i = lag; i < onset.length; i++) score += onset[i] * onset[i - lag];
+    if (score > bestScore) {
+      bestScore = score;
+      bestLag = lag;
+    }
+  }
+
+  return {
+    bpm: Math.round((60 * envelopeRate) / bestLag),
+    envelope: envelope,
+    envelopeRate: envelopeRate,
+    peak: peak || 1,
+  };
+}
+
+// Loudness around the current playback position, scaled to 0-255
+function currentEnergy() {
+  if (!currentAnalysis) return 128;
+  const { envelope, envelopeRate, peak } = currentAnalysis;
+  const center = Math.floor(audioPlayer.currentTime * envelopeRate);
+  let sum = 0;
+  let count = 0;
+  for (let i = Math.max(0, center - envelopeRate); i < Math.min(envelope.length, center + envelopeRate); i++) {
+    sum += envelope[i];
+    count++;
+  }
+  return count ? Math.min(255, Math.round((sum / count / peak) * 255 * 1.5)) : 128;
+}
+
+// Analyze (once per file) and hand the tempo to the robot
+async function startProceduralDance(fileObj) {
+  currentAnalysis = null;
+  try {
+    if (!fileObj.analysis) fileObj.analysis = await analyzeSong(fileObj.file);
+  } catch (err) {
+    console.log("Tempo analysis failed:", err);
+    fileObj.analysis = { bpm: 120, envelope: new Float32Array(0), envelopeRate: 100, peak: 1 };
+  }
+  if (!isUploadedSongPlaying) return; // Song changed while decoding
+  currentAnalysis = fileObj.analysis;
+  if (socket.readyState === WebSocket.OPEN) {
+    socket.send(`tempo:${currentAnalysis.bpm}`);
+    socket.send(`energy:${currentEnergy()}`);
+    console.log(`Procedural dance at ${currentAnalysis.bpm} BPM`);
+  }
+}
+
 // Send step signal to ESP32 - Updated to handle both normal and uploaded songs
 function sendSteps() {
   let stepSignal;
 
   if (isUploadedSongPlaying) {
-    // For uploaded songs: send random numbers between 1-18
-    stepSignal = Math.floor(Math.random() * 18) + 1;
-    console.log(`Sending random step signal for uploaded song: ${stepSignal}`);
-  } else {
-    // For normal songs: send sequential numbers
-    stepSignal = step;
-    step++;
-    console.log(
-      `Sending sequential step signal for normal song: ${stepSignal}`
-    );
+    // For uploaded songs: the robot improvises to the tempo, keep its energy current
+    if (currentAnalysis && socket.readyState === WebSocket.OPEN) {
+      socket.send(`energy:${currentEnergy()}`);
+    }
+    return;
   }
 
+  // For normal songs: send sequential numbers
+  stepSignal = step;
+  step++;
+  console.log(
+    `Sending sequential step signal for normal song: ${stepSignal}`
+  );
+
+  // With a synced clock the step is scheduled ahead, so WiFi jitter doesn't reach the dance
+  if (sendScheduled(robotTimeUs(performance.now() + STEP_LEAD_MS), [["step", stepSignal]])) return;
   if (socket.readyState === WebSocket.OPEN) {
     socket.send(stepSignal.toString());
   }
 }
 
+function startClockSync() {
+  clearInterval(pingTimer);
+  clockSamples = [];
+  for (let i = 0; i < 4; i++) setTimeout(sendPing, i * 150); // Quick first estimate
+  pingTimer = setInterval(sendPing, CLOCK_PING_MS);
+}
+
+function sendPing() {
+  const id = pingId;
+  pingId = (pingId + 1) >>> 0;
+  pingsInFlight.set(id, performance.now() * 1000);
+  if (!sendBatch([["ping", id]])) pingsInFlight.delete(id);
+}
+
+function handlePong(view, t3) {
+  const id = view.getUint32(3, true);
+  const t0 = pingsInFlight.get(id);
+  if (t0 === undefined) return;
+  pingsInFlight.delete(id);
+  const t1 = Number(view.getBigUint64(7, true));
+  const t2 = Number(view.getBigUint64(15, true));
+  const rtt = t3 - t0 - (t2 - t1);
+  const offset = (t1 - t0 + (t2 - t3)) / 2;
+  clockSamples.push({ rtt, offset });
+  if (clockSamples.length > CLOCK_SAMPLES) clockSamples.shift();
+  const best = clockSamples.reduce((a, b) => (b.rtt < a.rtt ? b : a));
+  clockOffsetUs = best.offset;
+  clockRttUs = best.rtt;
+}
+
+function parseTelemetry(view) {
+  const angles = [];
+  for (let i = 0; i < 12; i++) angles.push(view.getUint8(13 + i));
+  const flagBits = view.getUint8(51);
+  return {
+    seq: view.getUint16(3, true),
+    timeUs: Number(view.getBigUint64(5, true)),
+    angles,
+    step: view.getUint8(25),
+    keyframe: view.getUint16(26, true),
+    distanceCm: view.getUint16(28, true) / 10,
+    loopUs: view.getUint32(30, true),
+    loopMaxUs: view.getUint32(34, true),
+    cpgTickUs: view.getUint16(38, true),
+    scheduleLateUs: view.getInt32(40, true),
+    freeHeap: view.getUint32(44, true),
+    dropped: view.getUint16(48, true),
+    sequenceSlot: view.getInt8(50),
+    flags: TELEMETRY_FLAGS.filter((_, bit) => flagBits & (1 << bit)),
+  };
+}
+
+// Snapshots per second for every connected client (0 stops the stream)
+function subscribeTelemetry(hz) {
+  if (!sendBatch([["telemetry", hz]]) && socket.readyState === WebSocket.OPEN) {
+    socket.send(`telemetry:${hz}`);
+  }
+}
+
+// Robot clock (us) for a client time in ms, or null before the first PONG
+function robotTimeUs(clientMs = performance.now()) {
+  return clockOffsetUs === null ? null : clientMs * 1000 + clockOffsetUs;
+}
+
+// Send commands to run at a robot time; false if clock sync or the binary protocol is missing
+function sendScheduled(atUs, commands) {
+  if (atUs === null) return false;
+  return sendBatch(commands.flatMap((cmd) => [["at", atUs], cmd]));
+}
+
+// ==================== ROBOT SPEAKER ====================
+// Mirrors arduino/arduino/pcm_stream.h: the song goes to the robot as 8 kHz
+// 8-bit PCM and plays there, so the sound runs on the robot's clock. The
+// local player keeps running muted, lined up with the robot, for the
+// controls and the step timer.
+const PCM_MAGIC = 0xa5;
+const PCM_FLAG_START = 0x01;
+const PCM_FLAG_END = 0x02;
+const PCM_SAMPLE_HZ = 8000;
+const PCM_FRAME_SAMPLES = 160; // 20 ms per frame
+const PCM_LEAD_MS = 500; // Sent ahead of real time; the robot buffers 1 s
+let pcmStream = null; // { samples, offset, seq, baseMs, pausedAt, timer }
+
+// Decode, mix to mono, resample to 8 kHz and scale the peak to full range
+async function encodePcm(path) {
+  const AudioCtx = window.AudioContext || window.webkitAudioContext;
+  const ctx = new AudioCtx();
+  const decoded = await ctx.decodeAudioData(await (await fetch(path)).arrayBuffer());
+  ctx.close();
+  const offline = new OfflineAudioContext(1, Math.ceil(decoded.duration * PCM_SAMPLE_HZ), PCM_SAMPLE_HZ);
+  const source = offline.createBufferSource();
+  source.buffer = decoded;
+  source.connect(offline.destination);
+  source.start();
+  const mono = (await offline.startRendering()).getChannelData(0);
+  let peak = 0;
+  for (let i = 0; i < mono.length; i++) peak = Math.max(peak, Math.abs(mono[i]));
+  const gain = peak ? 127 / peak : 0;
+  const pcm = new Uint8Array(mono.length);
+  for (let i = 0; i < mono.length; i++) pcm[i] = Math.max(0, Math.min(255, Math.round(128 + mono[i] * gain)));
+  return pcm;
+}
+
+// Send every frame due by now, keeping PCM_LEAD_MS ahead of the robot
+function pumpPcm() {
+  const stream = pcmStream;
+  if (!stream || stream.pausedAt !== null || socket.readyState !== WebSocket.OPEN) return;
+  const due = Math.min(
+    stream.samples.length,
+    Math.ceil(((performance.now() - stream.baseMs + PCM_LEAD_MS) * PCM_SAMPLE_HZ) / 1000)
+  );
+  while (stream.offset < due) {
+    const end = Math.min(stream.offset + PCM_FRAME_SAMPLES, stream.samples.length);
+    const frame = new Uint8Array(4 + end - stream.offset);
+    const flags = (stream.offset === 0 ? PCM_FLAG_START : 0) | (end === stream.samples.length ? PCM_FLAG_END : 0);
+    frame.set([PCM_MAGIC, flags, stream.seq & 0xff, (stream.seq >> 8) & 0xff]);
+    frame.set(stream.samples.subarray(stream.offset, end), 4);
+    socket.send(frame);
+    stream.seq++;
+    stream.offset = end;
+  }
+  if (stream.offset === stream.samples.length) stopRobotAudio(false);
+}
+
+// Stream a song to the robot; false if it is off or the robot can't play PCM
+async function startRobotAudio(path) {
+  stopRobotAudio();
+  if (!robotSpeaker.checked || !robotProtocol || !(robotProtocol.caps & RB_CAP_PCM)) return false;
+  const stream = { samples: null, offset: 0, seq: 0, baseMs: 0, pausedAt: null, timer: null };
+  pcmStream = stream;
+  audioPlayer.muted = true;
+  try {
+    stream.samples = await encodePcm(path);
+  } catch (err) {
+    console.log("PCM encoding failed:", err);
+    stopRobotAudio();
+    return false;
+  }
+  if (pcmStream !== stream) return false; // Song changed while decoding
+  // The first burst covers the robot's prefill, so its playback starts about now: line the player up
+  audioPlayer.currentTime = 0;
+  stream.baseMs = performance.now();
+  stream.timer = setInterval(pumpPcm, 20);
+  pumpPcm();
+  console.log(`Streaming ${(stream.samples.length / PCM_SAMPLE_HZ).toFixed(1)} s of audio to the robot`);
+  return true;
+}
+
+function pauseRobotAudio() {
+  if (pcmStream && pcmStream.pausedAt === null) pcmStream.pausedAt = performance.now();
+}
+
+function resumeRobotAudio() {
+  if (!pcmStream || pcmStream.pausedAt === null) return;
+  pcmStream.baseMs += performance.now() - pcmStream.pausedAt;
+  pcmStream.pausedAt = null;
+}
+
+// unmute = false once every frame has gone: the robot is still playing them
+function stopRobotAudio(unmute = true) {
+  if (pcmStream) clearInterval(pcmStream.timer);
+  pcmStream = null;
+  if (unmute) audioPlayer.muted = false;
+}
+
 // Load song but don't play
 function preloadSong(path, name) {
   if (!path || !name) return;
@@ -266,6 +634,7 @@ function preloadSong(path, name) {
   isPlaying = false;
   isPaused = false;
   isUploadedSongPlaying = false; // Reset uploaded song flag
+  stopRobotAudio();
 
   audioSource.src = path;
   audioPlayer.load();
@@ -302,10 +671,15 @@ function playSelectedSong(path, name) {
   statusDiv.innerHTML = "Song Playing...";
   document.querySelector(".container").classList.add("playing");
 
-  if (socket.readyState === WebSocket.OPEN) {
+  // One frame with the song and its first step when the robot speaks the binary protocol
+  if (sendBatch([["song", selectedSongName], ["step", step]])) {
+    step++;
+    console.log(`Started new song: ${selectedSongName} (batched with step 1)`);
+  } else if (socket.readyState === WebSocket.OPEN) {
     socket.send(`song:${selectedSongName}`);
     console.log(`Started new song: ${selectedSongName}`);
   }
+  startRobotAudio(path);
 
   intervalId = setInterval(sendSteps, 5000);
 }
@@ -314,6 +688,7 @@ function playSelectedSong(path, name) {
 function stopSong() {
   audioPlayer.pause();
   audioPlayer.currentTime = 0;
+  stopRobotAudio();
 
   clearInterval(intervalId);
   intervalId = null;
@@ -363,6 +738,7 @@ audioPlayer.addEventListener("pause", () => {
     statusDiv.innerHTML = `Paused: ${selectedSongName}`;
     document.querySelector(".container").classList.remove("playing");
 
+    pauseRobotAudio();
     if (socket.readyState === WebSocket.OPEN) {
       socket.send("pause");
       console.log(`Song paused: ${selectedSongName}`);
@@ -381,6 +757,7 @@ audioPlayer.addEventListener("play", () => {
     isPaused = false;
     isPlaying = true;
 
+    resumeRobotAudio();
     if (socket.readyState === WebSocket.OPEN) {
       socket.send("resume");
       console.log(`Song resumed: ${selectedSongName}`);
@@ -409,6 +786,7 @@ audioPlayer.addEventListener("ended", () => {
   isPaused = false;
   currentPlayingIndex = null;
   isUploadedSongPlaying = false; // Reset uploaded song flag
+  stopRobotAudio();
 
   statusDiv.innerHTML = `Ended: ${selectedSongName}`;
   document.querySelector(".container").classList.remove("playing");
@@ -419,6 +797,86 @@ audioPlayer.addEventListener("ended", () => {
   }
 });
 
+// ==================== BYTECODE DANCES ====================
+// Mirrors arduino/arduino/choreo_vm.h. Ops are arrays: ["move", ch, angle, ms],
+// ["group", {ch: angle, ...}, ms], ["wait", ms], ["sync"], ["loop", n], ["next"],
+// ["call", motif], ["ret"], ["rand", motif, ...], ["set", reg, value],
+// ["add", reg, delta], ["mover", ch, reg, ms], ["led", index], ["tone", hz, ms],
+// ["base", pins], ["home", ms], ["end"]
+const VM_OPCODES = {
+  end: 0, move: 1, group: 2, wait: 3, sync: 4, loop: 5, next: 6, call: 7, ret: 8,
+  rand: 9, set: 10, add: 11, mover: 12, led: 13, tone: 14, base: 15, home: 16,
+};
+
+function assembleOps(ops, out) {
+  const u16 = (v) => out.push(v & 0xff, (v >> 8) & 0xff);
+  for (const [name, ...args] of ops) {
+    const op = VM_OPCODES[name];
+    if (op === undefined) throw new Error(`Unknown bytecode op: ${name}`);
+    out.push(op);
+    switch (name) {
+      case "move": out.push(args[0], args[1]); u16(args[2]); break;
+      case "group": {
+        const channels = Object.keys(args[0]).map(Number).sort((a, b) => a - b);
+        u16(channels.reduce((mask, ch) => mask | (1 << ch), 0));
+        u16(args[1]);
+        channels.forEach((ch) => out.push(args[0][ch]));
+        break;
+      }
+      case "wait": case "home": u16(args[0]); break;
+      case "loop": case "call": case "led": case "base": out.push(args[0]); break;
+      case "rand": out.push(args.length, ...args); break;
+      case "set": out.push(args[0]); u16(args[1]); break;
+      case "add": out.push(args[0], args[1] & 0xff); break;
+      case "mover": out.push(args[0], args[1]); u16(args[2]); break;
+      case "tone": u16(args[0]); u16(args[1]); break;
+    }
+  }
+}
+
+// { motifs: [[ops], ...], main: [ops] } -> binary program
+function assembleDance(dance) {
+  const motifs = dance.motifs || [];
+  const body = [];
+  assembleOps(dance.main, body);
+  const offsets = [];
+  const headerSize = 5 + motifs.length * 2;
+  motifs.forEach((motif) => {
+    offsets.push(headerSize + body.length);
+    assembleOps(motif, body);
+  });
+  const bytes = [0x52, 0x42, 0x56, 1, motifs.length];
+  offsets.forEach((offset) => bytes.push(offset & 0xff, offset >> 8));
+  return new Uint8Array(bytes.concat(body));
+}
+
+// Upload a dance; the robot starts it immediately and answers vm_loaded/vm_error
+function sendBytecodeDance(dance) {
+  if (socket.readyState !== WebSocket.OPEN) return;
+  const program = assembleDance(dance);
+  socket.send(program);
+  console.log(`Bytecode dance sent: ${program.length} bytes`);
+}
+
+// Example: wave both arms four times, then a random hip or knee bounce
+const DEMO_BYTECODE_DANCE = {
+  motifs: [
+    [["group", { 6: 15, 9: 15 }, 150], ["sync"], ["group", { 6: 0, 9: 0 }, 150], ["sync"], ["ret"]],
+    [["group", { 7: 20, 10: 20 }, 150], ["sync"], ["group", { 7: 0, 10: 0 }, 150], ["sync"], ["ret"]],
+  ],
+  main: [
+    ["led", 6],
+    ["loop", 4],
+    ["group", { 0: 30, 3: 150 }, 200], ["wait", 250],
+    ["group", { 0: 135, 3: 45 }, 200], ["wait", 250],
+    ["next"],
+    ["loop", 3], ["rand", 0, 1], ["next"],
+    ["home", 400], ["sync"],
+    ["end"],
+  ],
+};
+
+// Load first song on page load
 // Load first song on page load
 window.addEventListener("DOMContentLoaded", () => {
   if (songSelector.options.length > 0) {
@@ -431,4 +889,8 @@ window.addEventListener("DOMContentLoaded", () => {
 
 // Expose functions if needed in HTML inline (optional)
 window.playUploadedFile = playUploadedFile;
-window.removeUploadedFile = removeUploadedFile;
\ No newline at end of file
+window.removeUploadedFile = removeUploadedFile;
+window.sendBytecodeDance = sendBytecodeDance;
+window.sendBatch = sendBatch;
+window.subscribeTelemetry = subscribeTelemetry;
+window.getTelemetry = () => latestTelemetry;
\ No newline at end of file
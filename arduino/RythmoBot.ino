@@ -16,6 +16,29 @@
  * -- ULTRA-FAST WEBSOCKET: Instant pause/stop response with global abort system
  * -- FIX: Reverted to blocking smoothMove for compatibility with dance files
  * -- FIX: Restored handleBaseMovement to resolve undefined reference error
+ * -- CPG: Procedural oscillator dancing for uploaded songs (tempo:/energy: commands)
+ * -- KEYFRAMES: Dance steps play from compressed flash tracks without blocking
+ * -- SEQUENCER: Boot, WiFi celebration, clap reaction and dancing run as prioritised sequences
+ * -- CHOREO VM: Bytecode dances uploaded as binary WebSocket frames run without reflashing
+ * -- COMMAND PARSER: Text commands parsed in place and dispatched by verb hash, no heap use
+ * -- BINARY PROTOCOL: Versioned, batched binary commands with HELLO handshake and sequence acks
+ * -- CLOCK SYNC: PING/PONG against the microsecond clock, AT-scheduled commands fire on the control tick
+ * -- TELEMETRY: Subscribable binary status snapshots broadcast at a client-chosen rate
+ * -- COMMAND QUEUE: The WebSocket callback only parses and enqueues; loop() does the actuation
+ * -- NET PUMP: Network polled at a bounded rate and time budget; abort checks are a flag read
+ * -- STEP QUEUE: Steps sent ahead wait behind the playing one and chain without homing
+ * -- COALESCING: Speed/brightness/LED floods collapse to the latest value once per loop pass
+ * -- SHOW LOG: Records executed commands to LittleFS and replays them on the local clock
+ * -- LED OUTPUT: Patterns draw to a back buffer; changed frames go out from a transmit task
+ * -- LED STRIPS: Up to four strips in parallel, one segment each, table-driven effect kernels
+ * -- LED LAYERS: Base, beat accent, alert and clap layers composited with per-layer opacity and blend
+ * -- LED CUES: Each song carries a beat-aligned LED cue track played on the local clock
+ * -- PIXEL STREAM: DDP / E1.31 frames from a lighting desk drive the strip, local pattern on timeout
+ * -- AUDIO SPECTRUM: Sound sensor sampled by ADC DMA, fixed-point FFT bands drive VU, bass and spectrum patterns
+ * -- BEAT TRACKING: On-device onsets, tempo and beat clock; steps, CPG and cues lock to live music
+ * -- MELODIES: Buzzer sounds are note tables played whole by a non-blocking, prioritised melody queue
+ * -- PCM STREAM: Song audio streamed over WebSocket, jitter-buffered and played on the buzzer by timer ISR + LEDC
+ * -- BACKGROUND RANGING: Ultrasonic echo timed by pin interrupt, no pulseIn() stall; ranging continues inside steps
  * -- Version: Complete with modular dance step files + Ultra-Fast WebSocket Response
  */
 
@@ -26,7 +49,17 @@
 #include <Adafruit_PWMServoDriver.h>
 #include <LiquidCrystal_I2C.h>
 #include <FastLED.h>
+#include <atomic>
 
+// -- CHOREOGRAPHY FORMAT --
+// 1 = play steps from the compressed keyframe tracks (choreo_tracks.h, generated
+//     from the song headers by tools/choreo_encode.cpp)
+// 0 = compile the song headers and run the original blocking step functions
+#define CHOREO_COMPRESSED 1
+
+#if CHOREO_COMPRESSED
+#include "choreo_tracks.h" // All six songs as keyframe tracks
+#else
 // Include dance choreography files
 #include "fallingforyou.h" // "Falling for you" dance steps
 #include "stereo.h"        // "stereo love" dance steps
@@ -34,6 +67,27 @@
 #include "alone.h"         // "Alone" dance steps
 #include "neural.h"        // "Mashup" dance steps
 #include "other.h"         // "Other" dance steps
+#endif
+#include "cpg.h"           // Procedural motion for songs without choreography
+#include "sequencer.h"     // Prioritised non-blocking sequence runner
+#include "command_parser.h" // In-place text command parsing and dispatch
+#include "protocol.h"      // Binary control protocol
+#include "scheduler.h"     // Execute-at command queue
+#include "telemetry.h"     // Binary status snapshots
+#include "command_queue.h" // Callback -> loop() priority queue
+#include "net_pump.h"      // Rate-limited network polling
+#include "step_queue.h"    // Upcoming dance steps
+#include "show_log.h"      // Command stream recorder/replayer on LittleFS
+#include "led_output.h"    // Double-buffered LED transmit
+#include "led_effects.h"   // Strip segments and effect kernels
+#include "led_layers.h"    // Layer stack and blend modes
+#include "led_cues.h"      // Beat-aligned LED cue track per song
+#include "pixel_stream.h"  // DDP / E1.31 pixel stream into the base layer
+#include "audio_spectrum.h" // DMA ADC sampling and FFT bands of the sound sensor
+#include "beat_tracker.h"  // Onsets, tempo and beat clock from the audio frames
+#include "melody.h"        // Non-blocking buzzer melodies from note tables
+#include "pcm_stream.h"    // WebSocket PCM audio played on the buzzer pin
+#include "ultrasonic.h"    // Interrupt-timed ultrasonic ranging
 
 // -- WIFI CREDENTIALS --
 const char* ssid = "Dialog 4G 128";
@@ -45,13 +99,27 @@ Adafruit_PWMServoDriver pwm = Adafruit_PWMServoDriver(0x40);  // I2C address 0x4
 LiquidCrystal_I2C lcd(0x27, 16, 2);                           // I2C address 0x27, 16x2 display
 
 // -- LED STRIP CONFIGURATION --
-#define LED_PIN 2         // D2 pin for LED strips
-#define NUM_LEDS 60       // Total number of LEDs (adjust based on your strips)
+// Up to four strips, each on its own pin and sent in parallel (one RMT
+// channel each). A strip with 0 LEDs isn't fitted. Each strip is one segment.
+#define LED_PIN 2          // D2 pin for LED strip 1
+#define LED_STRIP1_LEDS 60
+#define LED_STRIP2_PIN 4
+#define LED_STRIP2_LEDS 0
+#define LED_STRIP3_PIN 5
+#define LED_STRIP3_LEDS 0
+#define LED_STRIP4_PIN 19
+#define LED_STRIP4_LEDS 0
+#define NUM_LEDS (LED_STRIP1_LEDS + LED_STRIP2_LEDS + LED_STRIP3_LEDS + LED_STRIP4_LEDS)  // Total number of LEDs
 #define LED_TYPE WS2812B  // Type of LED strip
 #define COLOR_ORDER GRB   // Color order for your strips
 #define BRIGHTNESS 100    // LED brightness (0-255)
+#define LED_STARTUP_STEPS 60  // Frames the startup fill takes, whatever the strip length
+#define LED_ACCENT_MS 200     // Fade of the flash on each dance step (accent layer)
 
-CRGB leds[NUM_LEDS];  // LED array
+CRGB leds[NUM_LEDS];       // LED array patterns draw on (back buffer)
+CRGB ledsFront[NUM_LEDS];  // What the strips show, owned by FastLED (led_output.h)
+uint8_t ledPhaseTable[NUM_LEDS];  // Position of each pixel along its segment (led_effects.h)
+CRGB ledLayerBuffers[LED_LAYERS * NUM_LEDS];  // One buffer per layer, composited into leds[] (led_layers.h)
 
 // -- PIN DEFINITIONS --
 // Motor Driver Pins (Base) - Updated with ENA and ENB
@@ -68,9 +136,10 @@ const int ENB = 25;  // PWM pin for Motor B (Right motors)
 #define ECHO_PIN 32
 // Sound Sensor Pin
 #define SOUND_SENSOR_PIN 34
+#define SOUND_SENSOR_ANALOG 1  // 1 = module's AO on the pin (spectrum, clap from the ADC), 0 = DO (clap only)
 
 // === REAL-TIME ABORT & LOOP HELPERS ===
-volatile bool gAbortAll = false;          // set true on pause/stop; checked everywhere
+std::atomic<bool> gAbortAll{false};       // set true on pause/stop from the callback; checked everywhere
 bool gPaused = false;                     // current paused state
 
 // -- WEBSOCKET OPTIMIZATION VARIABLES --
@@ -115,7 +184,8 @@ int currentServoAngles[12] = {
 // -- ROBOT STATE VARIABLES --
 bool isDancing = false;
 bool obstacleDetected = false;
-String currentSong = "No song";
+String currentSong = "No song";  // Reserved to SONG_NAME_MAX in setup, so renaming never allocates
+#define SONG_NAME_MAX RB_SONG_NAME_MAX
 
 // -- LCD STATE MACHINE VARIABLES --
 enum LcdState { INIT, PLAYING, PAUSED, STOPPED };
@@ -139,8 +209,13 @@ int motorCurrentAngle = 45;
 bool motorMovingToZero = true;
 
 // -- ULTRASONIC SENSOR VARIABLES --
-unsigned long lastUltrasonicCheck = 0;
-unsigned long ultrasonicCheckInterval = 100;  // Check every 100ms
+#define OBSTACLE_CM 50.0f
+float lastDistanceCm = 0;  // Last reading, for telemetry
+
+// -- LOOP TIMING VARIABLES --
+unsigned long loopStartUs = 0;
+unsigned long lastLoopUs = 0;
+unsigned long maxLoopUs = 0;  // Worst pass since the last telemetry snapshot
 
 // -- SOUND SENSOR VARIABLES --
 bool soundPreviouslyHigh = true;  // Tracks state to detect edge
@@ -162,101 +237,114 @@ enum LedPattern {
   LED_STARTUP,
   LED_WIFI_SUCCESS,
   LED_BREATHING,
-  LED_WAVE
+  LED_WAVE,
+  LED_VU,  // Sound level meter (audio_spectrum.h)
+  LED_BASS,  // Burst sized by the bass bands
+  LED_SPECTRUM,  // One band per slice of each strip
+  LED_ACCENT,  // Internal, not selectable with led: flash fading out in the layer colour
+  LED_SOLID,   // Internal: layer colour, set by LED cues
+  LED_STREAM   // Internal: pixels written by pixel_stream.h
 };
 
-// Add these global variables to better control clap response
-bool clapLedPatternActive = false;
-unsigned long clapPatternStartTime = 0;
-LedPattern currentLedPattern = LED_OFF;
-
-unsigned long lastLedUpdate = 0;
-unsigned long ledUpdateInterval = 50;  // 50ms for smooth animations
-int ledAnimationStep = 0;
-uint8_t ledHue = 0;
+LedPattern currentLedPattern = LED_OFF;  // Pattern on the base layer
 uint8_t ledBrightness = BRIGHTNESS;
-bool ledDirection = true;
-
-// -- NON-BLOCKING WIFI LED PATTERN VARIABLES --
-bool wifiPatternCompleted = false;
-unsigned long wifiPatternStartTime = 0;
-const unsigned long WIFI_PATTERN_TIMEOUT = 15000;  // 15 seconds timeout
-
-// -- NEW STATE MACHINE VARIABLES FOR NON-BLOCKING MOVEMENTS --
-enum ClapState {
-  CLAP_IDLE,
-  CLAP_INIT,
-  CLAP_MOVE_SET1,
-  CLAP_MOVE_SET2,
-  CLAP_MOVE_SET3,
-  CLAP_MOVE_SET4,
-  CLAP_FINAL_POSE,
-  CLAP_RESET
-};
-ClapState clapState = CLAP_IDLE;
-unsigned long clapStepStartTime = 0;
-int clapCurrentStep = 0;
-
-enum DanceState {
-  DANCE_IDLE,
-  DANCE_EXECUTING_STEP,
-  DANCE_RESETTING
-};
-DanceState danceState = DANCE_IDLE;
-unsigned long danceStepStartTime = 0;
+
+// -- DANCE STEP VARIABLES --
 int currentDanceStep = 0;
 
-// -- BUZZER STATE --
-struct BuzzerTone {
-  int frequency;
-  unsigned long duration;
-  unsigned long startTime;
-  bool active;
+// -- BEAT FOLLOWING VARIABLES --
+enum BeatMode { BEAT_OFF, BEAT_FOLLOW, BEAT_AUTO };
+const char* BEAT_MODE_NAMES[] = {"off", "follow", "auto"};
+#define BEAT_MODE_DEFAULT BEAT_AUTO
+#define BEAT_AUTO_START_BEATS 8     // Locked beats before dancing on its own
+#define BEAT_AUTO_STOP_MS 4000      // Music gone this long ends the dance
+#define BEAT_STEP_WAIT_MS 1100      // Longest a dance step waits for its beat (60 BPM)
+uint8_t beatMode = BEAT_MODE_DEFAULT;
+uint16_t beatLockedTicks = 0;       // Beats since the tracker locked
+bool beatAutoDancing = false;
+unsigned long beatLostAt = 0;
+
+// -- BUZZER MELODIES --
+const MelodyNote STARTUP_NOTES[] = {{440, 200, 0}, {523, 200, 0}, {659, 200, 0}, {784, 300, 0}};
+const MelodyNote WIFI_NOTES[] = {
+  {523, 150, 0}, {659, 150, 0}, {784, 150, 0}, {1047, 200, 100}, {1047, 100, 0}, {1175, 100, 0},
+  {1319, 100, 0}, {1397, 100, 0}, {1568, 300, 200}, {1047, 100, 50}, {1319, 100, 50}, {1568, 400, 0}
+};
+const MelodyNote CLAP_NOTES[] = {
+  {523, 100, 0}, {659, 100, 0}, {784, 100, 0}, {1047, 150, 50}, {988, 80, 0}, {880, 80, 0},
+  {784, 120, 100}, {1047, 200, 0}, {1319, 250, 0}
+};
+const MelodyNote DANCE_NOTES[] = {{659, 150, 0}, {784, 150, 0}, {988, 150, 0}, {1047, 200, 0}};
+const MelodyNote PAUSE_NOTES[] = {{659, 200, 0}, {523, 300, 0}};
+const MelodyNote STOP_NOTES[] = {{784, 150, 0}, {659, 150, 0}, {523, 200, 0}, {392, 300, 0}};
+const MelodyNote RESUME_NOTES[] = {{523, 150, 0}, {659, 150, 0}, {784, 200, 0}};
+const MelodyNote ERROR_NOTES[] = {{200, 100, 50}, {200, 100, 50}, {200, 100, 0}};
+const MelodyNote TEST_NOTES[] = {
+  {500, 150, 50}, {800, 150, 50}, {1100, 150, 50}, {1400, 150, 50}, {1700, 150, 50}, {2000, 150, 0}
+};
+// A new sound is a note table and a line here
+enum MelodyId { MELODY_STARTUP, MELODY_WIFI, MELODY_CLAP, MELODY_DANCE, MELODY_PAUSE, MELODY_STOP,
+                MELODY_RESUME, MELODY_ERROR, MELODY_TEST, MELODY_COUNT };
+const Melody MELODIES[MELODY_COUNT] = {
+  {"startup", MELODY_NOTES(STARTUP_NOTES), MELODY_PRIO_EVENT},
+  {"wifi", MELODY_NOTES(WIFI_NOTES), MELODY_PRIO_EVENT},
+  {"clap", MELODY_NOTES(CLAP_NOTES), MELODY_PRIO_EVENT},
+  {"dance", MELODY_NOTES(DANCE_NOTES), MELODY_PRIO_EVENT},
+  {"pause", MELODY_NOTES(PAUSE_NOTES), MELODY_PRIO_ALERT},
+  {"stop", MELODY_NOTES(STOP_NOTES), MELODY_PRIO_ALERT},
+  {"resume", MELODY_NOTES(RESUME_NOTES), MELODY_PRIO_ALERT},
+  {"error", MELODY_NOTES(ERROR_NOTES), MELODY_PRIO_ALERT},
+  {"test", MELODY_NOTES(TEST_NOTES), MELODY_PRIO_EVENT}
 };
-BuzzerTone currentTone = {0, 0, 0, false};
 
 // === FUNCTION DECLARATIONS ===
 void smoothMove(uint8_t channel, int toAngle, int delayMs);
 void pwmWriteAngle(uint8_t ch, float angle);
 void resetAllServos();
 void updateLcdScreenFast();
-void playClapResponseSound();
-void playErrorSound();
+void playMelody(MelodyId id);
 void setMotorSpeed(int speed);
 void setupPWMChannels();
 void moveForward(int duration);
 void moveBackward(int duration);
 void stopBase();
+void setBasePins(uint8_t pins);
 void playStepSound(int stepNumber);
-void handleWifiLedPatternCompletion();
 void optimizeWiFi();
 void updateLEDs();
 void setLedPattern(LedPattern pattern);
-void clearAllLEDs();
-void ledRainbow();
-void ledPulse();
-void ledChase();
-void ledStrobe();
-void ledFire();
-void ledDance();
-void ledClapResponse();
-void ledObstacleWarning();
-void ledStartup();
-void ledWifiSuccess();
-void ledBreathing();
-void ledWave();
-void executeClapResponseStep();
-void executeDanceStep();
+void startLedOverlay(uint8_t layer, LedPattern pattern);
+void ledRainbow(LedLayer& layer);
+void ledPulse(LedLayer& layer);
+void ledChase(LedLayer& layer);
+void ledStrobe(LedLayer& layer);
+void ledFire(LedLayer& layer);
+void ledDance(LedLayer& layer);
+void ledClapResponse(LedLayer& layer);
+void ledObstacleWarning(LedLayer& layer);
+void ledStartup(LedLayer& layer);
+void ledWifiSuccess(LedLayer& layer);
+void ledBreathing(LedLayer& layer);
+void ledWave(LedLayer& layer);
+void ledAccent(LedLayer& layer);
+void ledFlash(const CRGB& color);
+bool startDanceTrack();
+bool startShowReplay();
+void runShowCommand(uint8_t num, uint8_t action);
+bool beatStepDue();
 void playTone(int frequency, int duration);
 void updateBuzzer();
 void handleBaseMovement();
 
 // === ULTRA-FAST RESPONSE FUNCTIONS ===
 
-// Check if we should abort current operations
+// Check if we should abort current operations (the network side sets the flag)
 inline bool shouldAbort() {
-  webSocket.loop(); // CRITICAL: Process incoming messages immediately
-  return gAbortAll;
+  return gAbortAll.load(std::memory_order_relaxed);
+}
+
+void netPoll() {
+  webSocket.loop();
 }
 
 // Hard stop everything NOW (called on pause/stop)
@@ -265,63 +353,72 @@ void pauseImmediate() {
   gPaused = true;
 
   stopBase();
-  noTone(BUZZER_PIN);
-  currentTone.active = false;
+  melodyStopAll();
+  pcmPause();
   setMotorSpeed(0);
+  ledCuesPause();
+  ledLayerStop(LED_LAYER_CLAP);
+  ledLayerStop(LED_LAYER_ACCENT);
   setLedPattern(LED_BREATHING);
   lcdState = PAUSED;
   isDancing = false;
-  clapState = CLAP_IDLE;
-  danceState = DANCE_IDLE;
+  seqCancelAll();
+  clearScheduledCommands();
+  stepqClear();
   clapMovementInProgress = false;
 
   updateLcdScreenFast();
-
-  // Flush a few websocket cycles to immediately ack to the client
-  for (int i = 0; i < 3; i++) { webSocket.loop(); yield(); }
 }
 
+const SeqStep STOP_HOME_SEQUENCE[] = {
+  {SEQ_HOME, 0, 0, 600},
+  {SEQ_END}
+};
+
 // Full stop + reset (used by "stop")
 void stopImmediate() {
   gAbortAll = true;
   gPaused = false;
   isDancing = false;
   currentSong = "No song";
-  clapState = CLAP_IDLE;
-  danceState = DANCE_IDLE;
+  seqCancelAll();
+  clearScheduledCommands();
+  stepqClear();
   clapMovementInProgress = false;
 
   stopBase();
-  noTone(BUZZER_PIN);
-  currentTone.active = false;
+  melodyStopAll();
+  pcmStop();
   setMotorSpeed(0);
+  ledCuesStop();
+  ledLayerStop(LED_LAYER_CLAP);
+  ledLayerStop(LED_LAYER_ACCENT);
   setLedPattern(LED_BREATHING);
   lcdState = STOPPED;
 
-  // Start resetting servos to home
-  resetAllServos();
-
-  for (int i = 0; i < 3; i++) { webSocket.loop(); yield(); }
+  // Glide servos home without blocking the loop
+  seqStart(SEQ_PRIO_SYSTEM, STOP_HOME_SEQUENCE, "stop home");
 }
 
 // Resume clears the abort and restores speed/pattern
 void resumeFromPause() {
   gAbortAll = false;
   gPaused = false;
-  clapState = CLAP_IDLE;
-  danceState = DANCE_IDLE;
+  seqCancelAll();
   clapMovementInProgress = false;
 
   if (currentSong != "No song" && currentSong != "") {
     isDancing = true;
     setMotorSpeed(danceSpeed);
     setLedPattern(LED_DANCE);
+    ledCuesResume();
     lcdState = PLAYING;
   } else {
     setMotorSpeed(normalSpeed);
     setLedPattern(LED_BREATHING);
     lcdState = STOPPED;
   }
+  pcmResume();
   updateLcdScreenFast();
 }
 
@@ -334,301 +431,353 @@ void optimizeWiFi() {
 
 // === LED STRIP FUNCTIONS ===
 void setupLEDs() {
-  FastLED.addLeds<LED_TYPE, LED_PIN, COLOR_ORDER>(leds, NUM_LEDS);
+  uint16_t start = 0;
+  ledSegmentsBegin(ledPhaseTable);
+  FastLED.addLeds<LED_TYPE, LED_PIN, COLOR_ORDER>(ledsFront, LED_STRIP1_LEDS);
+  ledAddSegment(start, LED_STRIP1_LEDS, false);
+  start += LED_STRIP1_LEDS;
+#if LED_STRIP2_LEDS > 0
+  FastLED.addLeds<LED_TYPE, LED_STRIP2_PIN, COLOR_ORDER>(ledsFront + start, LED_STRIP2_LEDS);
+  ledAddSegment(start, LED_STRIP2_LEDS, false);
+  start += LED_STRIP2_LEDS;
+#endif
+#if LED_STRIP3_LEDS > 0
+  FastLED.addLeds<LED_TYPE, LED_STRIP3_PIN, COLOR_ORDER>(ledsFront + start, LED_STRIP3_LEDS);
+  ledAddSegment(start, LED_STRIP3_LEDS, false);
+  start += LED_STRIP3_LEDS;
+#endif
+#if LED_STRIP4_LEDS > 0
+  FastLED.addLeds<LED_TYPE, LED_STRIP4_PIN, COLOR_ORDER>(ledsFront + start, LED_STRIP4_LEDS);
+  ledAddSegment(start, LED_STRIP4_LEDS, false);
+  start += LED_STRIP4_LEDS;
+#endif
   FastLED.setBrightness(BRIGHTNESS);
   FastLED.clear();
   FastLED.show();
+  ledOutputBegin(leds, ledsFront, NUM_LEDS);
+  ledLayersBegin(ledLayerBuffers, NUM_LEDS);
 
-  Serial.println("LED strips initialized on pin D2");
-  Serial.print("Number of LEDs: ");
-  Serial.println(NUM_LEDS);
+  Serial.printf("LED strips initialized: %u strips, %u LEDs\n", ledSegmentCount, NUM_LEDS);
 
   setLedPattern(LED_STARTUP);
 }
 
 void updateLEDs() {
-  if (millis() - lastLedUpdate >= ledUpdateInterval) {
-    switch (currentLedPattern) {
-      case LED_OFF:
-        clearAllLEDs();
-        break;
-      case LED_RAINBOW:
-        ledRainbow();
-        break;
-      case LED_PULSE:
-        ledPulse();
-        break;
-      case LED_CHASE:
-        ledChase();
-        break;
-      case LED_STROBE:
-        ledStrobe();
-        break;
-      case LED_FIRE:
-        ledFire();
-        break;
-      case LED_DANCE:
-        ledDance();
-        break;
-      case LED_CLAP_RESPONSE:
-        ledClapResponse();
-        break;
-      case LED_OBSTACLE_WARNING:
-        ledObstacleWarning();
-        break;
-      case LED_STARTUP:
-        ledStartup();
-        break;
-      case LED_WIFI_SUCCESS:
-        ledWifiSuccess();
-        break;
-      case LED_BREATHING:
-        ledBreathing();
-        break;
-      case LED_WAVE:
-        ledWave();
-        break;
-    }
-
-    FastLED.show();
-    lastLedUpdate = millis();
-    ledAnimationStep++;
-    if (ledAnimationStep > 1000) {
-      ledAnimationStep = ledAnimationStep % 200;
-    }
-  }
+  if (ledLayersRender(leds)) ledFrameReady();
+  ledOutputService();  // Sends the frame only if it changed
 }
 
-void setLedPattern(LedPattern pattern) {
-  if (clapLedPatternActive && pattern != LED_CLAP_RESPONSE) {
-    Serial.println("WARNING: Attempted to change LED pattern during clap response - ignoring");
-    return;
-  }
-
-  if (currentLedPattern == pattern) {
-    Serial.println("LED pattern already set to requested pattern - skipping");
-    return;
-  }
-
-  currentLedPattern = pattern;
-  ledAnimationStep = 0;
-  ledHue = 0;
-  ledDirection = true;
-
-  if (pattern != LED_WIFI_SUCCESS && pattern != LED_CLAP_RESPONSE) {
-    FastLED.clear();
-    FastLED.show();
-  }
-
-  switch (pattern) {
-    case LED_STROBE:
-      ledUpdateInterval = 100;
+// Called by led_layers.h when a layer is due
+void renderLedPattern(LedLayer& layer) {
+  switch (layer.pattern) {
+    case LED_OFF:
+      fill_solid(layer.pixels, NUM_LEDS, CRGB::Black);
+      break;
+    case LED_RAINBOW:
+      ledRainbow(layer);
+      break;
+    case LED_PULSE:
+      ledPulse(layer);
       break;
     case LED_CHASE:
-      ledUpdateInterval = 80;
+      ledChase(layer);
+      break;
+    case LED_STROBE:
+      ledStrobe(layer);
       break;
     case LED_FIRE:
-      ledUpdateInterval = 30;
+      ledFire(layer);
       break;
     case LED_DANCE:
-      ledUpdateInterval = 60;
+      ledDance(layer);
       break;
     case LED_CLAP_RESPONSE:
-      ledUpdateInterval = 30;
+      ledClapResponse(layer);
       break;
     case LED_OBSTACLE_WARNING:
-      ledUpdateInterval = 200;
+      ledObstacleWarning(layer);
+      break;
+    case LED_STARTUP:
+      ledStartup(layer);
       break;
     case LED_WIFI_SUCCESS:
-      ledUpdateInterval = 100;
+      ledWifiSuccess(layer);
       break;
     case LED_BREATHING:
-      ledUpdateInterval = 50;
+      ledBreathing(layer);
       break;
-    default:
-      ledUpdateInterval = 50;
+    case LED_WAVE:
+      ledWave(layer);
+      break;
+    case LED_VU:
+      ledFxVu(layer.pixels, ledPhaseTable, NUM_LEDS, audioLevel);
+      break;
+    case LED_BASS:
+      ledFxBurst(layer.pixels, ledPhaseTable, NUM_LEDS, audioBass(), layer.hue++);
+      break;
+    case LED_SPECTRUM:
+      ledFxSpectrum(layer.pixels, ledPhaseTable, NUM_LEDS, audioBandLevel, AUDIO_BANDS);
+      break;
+    case LED_ACCENT:
+      ledAccent(layer);
+      break;
+    case LED_SOLID:
+      fill_solid(layer.pixels, NUM_LEDS, layer.color);
+      break;
+    case LED_STREAM:
       break;
   }
+}
+
+uint16_t ledPatternInterval(LedPattern pattern) {
+  switch (pattern) {
+    case LED_STROBE:
+      return 100;
+    case LED_CHASE:
+      return 80;
+    case LED_FIRE:
+      return 30;
+    case LED_DANCE:
+      return 60;
+    case LED_CLAP_RESPONSE:
+      return 30;
+    case LED_OBSTACLE_WARNING:
+      return 200;
+    case LED_WIFI_SUCCESS:
+      return 100;
+    case LED_VU:
+    case LED_BASS:
+    case LED_SPECTRUM:
+      return 25;  // About one audio frame
+    case LED_ACCENT:
+      return 20;
+    case LED_STREAM:
+      return 1000;  // Nothing to draw; each received frame composites on its own
+    default:
+      return 50;
+  }
+}
+
+// Base layer; alerts, the clap and beat accents draw on their own layers above it
+void setLedPattern(LedPattern pattern) {
+  if (pixelStreamActive()) {
+    currentLedPattern = pattern;  // Shown when the stream ends
+    return;
+  }
+
+  if (currentLedPattern == pattern && ledLayerActive(LED_LAYER_BASE)) {
+    Serial.println("LED pattern already set to requested pattern - skipping");
+    return;
+  }
+
+  currentLedPattern = pattern;
+  ledLayerStart(LED_LAYER_BASE, pattern, ledPatternInterval(pattern));
 
   Serial.print("LED pattern changed to: ");
   Serial.println(pattern);
 }
 
-void clearAllLEDs() {
-  FastLED.clear();
+void startLedOverlay(uint8_t layer, LedPattern pattern) {
+  ledLayerStart(layer, pattern, ledPatternInterval(pattern));
 }
 
-void ledRainbow() {
-  for (int i = 0; i < NUM_LEDS; i++) {
-    leds[i] = CHSV((ledHue + (i * 255 / NUM_LEDS)) % 255, 255, ledBrightness);
-  }
-  ledHue += 2;
+// LED opcode from a bytecode dance
+void vmSetLedPattern(uint8_t pattern) {
+  if (pattern > LED_SPECTRUM) return;
+  setLedPattern((LedPattern)pattern);
 }
 
-void ledPulse() {
-  uint8_t brightness = beatsin8(30, 0, 255);
-  fill_solid(leds, NUM_LEDS, CHSV(ledHue, 255, brightness));
-  ledHue += 1;
+void ledRainbow(LedLayer& layer) {
+  ledFxRainbow(layer.pixels, ledPhaseTable, NUM_LEDS, layer.hue, ledBrightness);
+  layer.hue += 2;
 }
 
-void ledChase() {
-  fadeToBlackBy(leds, NUM_LEDS, 64);
-  int pos = ledAnimationStep % NUM_LEDS;
-  leds[pos] = CHSV(ledHue, 255, 255);
-  leds[(pos + 1) % NUM_LEDS] = CHSV(ledHue + 30, 255, 180);
-  leds[(pos + 2) % NUM_LEDS] = CHSV(ledHue + 60, 255, 100);
-  ledHue += 2;
+void ledPulse(LedLayer& layer) {
+  uint8_t brightness = beatsin8(30, 0, 255);
+  fill_solid(layer.pixels, NUM_LEDS, CHSV(layer.hue, 255, brightness));
+  layer.hue += 1;
 }
 
-void ledStrobe() {
-  if (ledAnimationStep % 2 == 0) {
-    fill_solid(leds, NUM_LEDS, CRGB::White);
-  } else {
-    FastLED.clear();
+void ledChase(LedLayer& layer) {
+  CRGB* px = layer.pixels;
+  fadeToBlackBy(px, NUM_LEDS, 64);
+  for (uint8_t s = 0; s < ledSegmentCount; s++) {
+    const LedSegment& seg = ledSegments[s];
+    uint16_t pos = layer.step % seg.count;
+    px[ledSegmentPixel(seg, pos)] = CHSV(layer.hue, 255, 255);
+    px[ledSegmentPixel(seg, (pos + 1) % seg.count)] = CHSV(layer.hue + 30, 255, 180);
+    px[ledSegmentPixel(seg, (pos + 2) % seg.count)] = CHSV(layer.hue + 60, 255, 100);
   }
+  layer.hue += 2;
 }
 
-void ledFire() {
-  for (int i = 0; i < NUM_LEDS; i++) {
-    int heat = random(0, 255);
-    if (heat < 80) {
-      leds[i] = CRGB::Black;
-    } else if (heat < 160) {
-      leds[i] = CRGB::Red;
-    } else if (heat < 220) {
-      leds[i] = CRGB::Orange;
-    } else {
-      leds[i] = CRGB::Yellow;
-    }
-  }
+void ledStrobe(LedLayer& layer) {
+  fill_solid(layer.pixels, NUM_LEDS, layer.step % 2 == 0 ? CRGB::White : CRGB::Black);
 }
 
-void ledDance() {
-  fadeToBlackBy(leds, NUM_LEDS, 32);
-  int pos1 = beatsin16(30, 0, NUM_LEDS - 1);
-  int pos2 = beatsin16(45, 0, NUM_LEDS - 1);
-  int pos3 = beatsin16(60, 0, NUM_LEDS - 1);
-  leds[pos1] += CHSV(0, 255, 255);
-  leds[pos2] += CHSV(96, 255, 255);
-  leds[pos3] += CHSV(160, 255, 255);
+void ledFire(LedLayer& layer) {
+  ledFxFire(layer.pixels, NUM_LEDS);
 }
 
-void ledClapResponse() {
-  unsigned long elapsed = millis() - clapPatternStartTime;
+void ledDance(LedLayer& layer) {
+  CRGB* px = layer.pixels;
+  fadeToBlackBy(px, NUM_LEDS, 32);
+  for (uint8_t s = 0; s < ledSegmentCount; s++) {
+    const LedSegment& seg = ledSegments[s];
+    px[ledSegmentPixel(seg, beatsin16(30, 0, seg.count - 1))] += CHSV(0, 255, 255);
+    px[ledSegmentPixel(seg, beatsin16(45, 0, seg.count - 1))] += CHSV(96, 255, 255);
+    px[ledSegmentPixel(seg, beatsin16(60, 0, seg.count - 1))] += CHSV(160, 255, 255);
+  }
+}
+
+// Clap layer: runs three seconds, then the layer switches itself off
+void ledClapResponse(LedLayer& layer) {
+  CRGB* px = layer.pixels;
+  unsigned long elapsed = millis() - layer.startedAt;
   if (elapsed < 500) {
-    int center = NUM_LEDS / 2;
-    int maxRadius = NUM_LEDS / 2;
-    int radius = map(elapsed, 0, 500, 0, maxRadius);
-    FastLED.clear();
-    for (int i = max(0, center - radius); i <= min(NUM_LEDS - 1, center + radius); i++) {
-      uint8_t brightness = 255 - (abs(i - center) * 255 / maxRadius);
-      brightness = max(brightness, (uint8_t)50);
-      leds[i] = CHSV((elapsed / 10) % 255, 255, brightness);
-    }
+    ledFxBurst(px, ledPhaseTable, NUM_LEDS, elapsed * 255 / 500, (elapsed / 10) % 255);
   } else if (elapsed < 1500) {
-    fadeToBlackBy(leds, NUM_LEDS, 40);
+    fadeToBlackBy(px, NUM_LEDS, 40);
     int numSparkles = 8;
     for (int i = 0; i < numSparkles; i++) {
       int pos = random(NUM_LEDS);
-      leds[pos] = CHSV(random(255), 255, 255);
+      px[pos] = CHSV(random(255), 255, 255);
     }
   } else if (elapsed < 2200) {
     if ((elapsed / 100) % 2 == 0) {
-      fill_solid(leds, NUM_LEDS, CRGB::Red);
+      fill_solid(px, NUM_LEDS, CRGB::Red);
     } else {
-      fill_solid(leds, NUM_LEDS, CRGB::Blue);
+      fill_solid(px, NUM_LEDS, CRGB::Blue);
     }
   } else if (elapsed < 3000) {
     uint8_t brightness = beatsin8(30, 100, 255);
-    fill_solid(leds, NUM_LEDS, CHSV(96, 255, brightness));
+    fill_solid(px, NUM_LEDS, CHSV(96, 255, brightness));
   } else {
-    clapLedPatternActive = false;
-    if (isDancing) {
-      setLedPattern(LED_DANCE);
-    } else {
-      setLedPattern(LED_BREATHING);
-    }
-    Serial.println("Clap LED pattern finished, restored normal pattern");
+    ledLayerStop(LED_LAYER_CLAP);
+    Serial.println("Clap LED pattern finished");
   }
 }
 
-void ledObstacleWarning() {
-  if (ledAnimationStep % 2 == 0) {
-    fill_solid(leds, NUM_LEDS, CRGB::Red);
-  } else {
-    FastLED.clear();
-  }
+// Alert layer (keyed): the dark half of the blink shows the base pattern
+void ledObstacleWarning(LedLayer& layer) {
+  fill_solid(layer.pixels, NUM_LEDS, layer.step % 2 == 0 ? CRGB::Red : CRGB::Black);
 }
 
-void ledStartup() {
-  if (ledAnimationStep < NUM_LEDS) {
-    leds[ledAnimationStep] = CHSV(ledHue, 255, 255);
-    ledHue += 256 / NUM_LEDS;
-  } else if (ledAnimationStep < NUM_LEDS + 30) {
+// Rainbow filling every strip in LED_STARTUP_STEPS frames
+void ledStartup(LedLayer& layer) {
+  if (layer.step < LED_STARTUP_STEPS) {
+    uint16_t fill = (layer.step + 1) * 256 / LED_STARTUP_STEPS;
+    for (uint8_t s = 0; s < ledSegmentCount; s++) {
+      const LedSegment& seg = ledSegments[s];
+      uint16_t lit = ((uint32_t)seg.count * fill) >> 8;
+      for (uint16_t k = 0; k < lit; k++) {
+        uint16_t i = ledSegmentPixel(seg, k);
+        layer.pixels[i] = CHSV(ledPhaseTable[i], 255, 255);
+      }
+    }
+  } else if (layer.step < LED_STARTUP_STEPS + 30) {
     // Hold full pattern
   } else {
     setLedPattern(LED_BREATHING);
   }
 }
 
-void ledWifiSuccess() {
-  if (ledAnimationStep < 30) {
-    int fillCount = map(ledAnimationStep, 0, 29, 0, NUM_LEDS);
-    FastLED.clear();
-    for (int i = 0; i < fillCount; i++) {
-      leds[i] = CRGB::Green;
-    }
-  } else if (ledAnimationStep < 60) {
-    FastLED.clear();
-    for (int i = 0; i < NUM_LEDS; i++) {
-      uint8_t brightness = sin8(((i * 256 / NUM_LEDS) + ((ledAnimationStep - 30) * 8)) % 256);
-      leds[i] = CRGB(0, brightness, 0);
-    }
-  } else if (ledAnimationStep < 90) {
-    fill_solid(leds, NUM_LEDS, CRGB::Green);
-  } else if (ledAnimationStep < 120) {
+void ledWifiSuccess(LedLayer& layer) {
+  CRGB* px = layer.pixels;
+  if (layer.step < 30) {
+    fill_solid(px, NUM_LEDS, CRGB::Black);
+    ledFxFillSegments(px, layer.step * 256 / 29, CRGB::Green);
+  } else if (layer.step < 60) {
+    ledFxSineFill(px, ledPhaseTable, NUM_LEDS, CRGB(0, 255, 0), (layer.step - 30) * 8);
+  } else if (layer.step < 90) {
+    fill_solid(px, NUM_LEDS, CRGB::Green);
+  } else if (layer.step < 120) {
     uint8_t brightness = beatsin8(20, 100, 255);
-    fill_solid(leds, NUM_LEDS, CRGB(0, brightness, 0));
-  } else if (ledAnimationStep < 150) {
-    if ((ledAnimationStep / 3) % 2 == 0) {
-      fill_solid(leds, NUM_LEDS, CRGB::Green);
+    fill_solid(px, NUM_LEDS, CRGB(0, brightness, 0));
+  } else if (layer.step < 150) {
+    if ((layer.step / 3) % 2 == 0) {
+      fill_solid(px, NUM_LEDS, CRGB::Green);
     } else {
-      fill_solid(leds, NUM_LEDS, CRGB::White);
+      fill_solid(px, NUM_LEDS, CRGB::White);
     }
   } else {
     uint8_t brightness = beatsin8(10, 150, 255);
-    fill_solid(leds, NUM_LEDS, CRGB(0, brightness, 0));
+    fill_solid(px, NUM_LEDS, CRGB(0, brightness, 0));
   }
 }
 
-void ledBreathing() {
+void ledBreathing(LedLayer& layer) {
   uint8_t brightness = beatsin8(15, 30, 200);
-  fill_solid(leds, NUM_LEDS, CHSV(160, 200, brightness));
+  fill_solid(layer.pixels, NUM_LEDS, CHSV(160, 200, brightness));
 }
 
-void ledWave() {
-  for (int i = 0; i < NUM_LEDS; i++) {
-    uint8_t brightness = sin8(((i * 256 / NUM_LEDS) + (ledAnimationStep * 4)) % 256);
-    leds[i] = CHSV((ledHue + (i * 2)) % 255, 255, brightness);
-  }
-  ledHue += 1;
+void ledWave(LedLayer& layer) {
+  ledFxWave(layer.pixels, ledPhaseTable, NUM_LEDS, layer.hue, layer.step * 4);
+  layer.hue += 1;
 }
 
-void handleWifiLedPatternCompletion() {
-  if (!wifiPatternCompleted) {
-    unsigned long elapsedTime = millis() - wifiPatternStartTime;
-    if (currentLedPattern == LED_WIFI_SUCCESS && ledAnimationStep >= 150) {
-      wifiPatternCompleted = true;
-      setLedPattern(LED_BREATHING);
-      Serial.println("WiFi LED pattern completed naturally, switched to breathing");
-    } else if (elapsedTime >= WIFI_PATTERN_TIMEOUT) {
-      wifiPatternCompleted = true;
-      setLedPattern(LED_BREATHING);
-      Serial.println("WiFi LED pattern timed out, switched to breathing");
-    }
+// Accent layer: flash fading out over LED_ACCENT_MS (dance steps, cue beats)
+void ledAccent(LedLayer& layer) {
+  unsigned long elapsed = millis() - layer.startedAt;
+  if (elapsed >= LED_ACCENT_MS) {
+    ledLayerStop(LED_LAYER_ACCENT);
+    return;
   }
+  fill_solid(layer.pixels, NUM_LEDS, CRGB(layer.color).nscale8(255 - elapsed * 255 / LED_ACCENT_MS));
+}
+
+void ledFlash(const CRGB& color) {
+  ledLayerSetColor(LED_LAYER_ACCENT, color);
+  startLedOverlay(LED_LAYER_ACCENT, LED_ACCENT);
+}
+
+// === PIXEL STREAM (pixel_stream.h) ===
+void pixelStreamStarted() {
+  ledLayerStart(LED_LAYER_BASE, LED_STREAM, ledPatternInterval(LED_STREAM));
+  webSocket.broadcastTXT("stream_started");
+  Serial.println("Pixel stream started, base layer follows the network");
+}
+
+void pixelStreamEnded() {
+  ledLayerStart(LED_LAYER_BASE, currentLedPattern, ledPatternInterval(currentLedPattern));
+  webSocket.broadcastTXT("stream_ended");
+  Serial.println("Pixel stream ended, local pattern restored");
 }
 
+// === LED CUE ACTIONS (led_cues.h) ===
+void cueSetPattern(uint8_t pattern) {
+  if (pattern > LED_SPECTRUM) return;
+  setLedPattern((LedPattern)pattern);
+}
+
+void cueSetColor(const CRGB& color) {
+  ledLayerSetColor(LED_LAYER_BASE, color);
+  setLedPattern(LED_SOLID);
+}
+
+void cueFlash(const CRGB& color) {
+  ledFlash(color);
+}
+
+// === WIFI CELEBRATION SEQUENCE ===
+void wifiCelebrationBegin() {
+  playMelody(MELODY_WIFI);
+  setLedPattern(LED_WIFI_SUCCESS);
+}
+
+void restoreIdleLeds() {
+  setLedPattern(isDancing ? LED_DANCE : LED_BREATHING);
+  Serial.println("WiFi LED pattern completed, switched back");
+}
+
+// LED_WIFI_SUCCESS runs for 150 frames at 100 ms
+const SeqStep WIFI_SEQUENCE[] = {
+  {SEQ_CALL, 0, 0, 0, wifiCelebrationBegin},
+  {SEQ_WAIT, 0, 0, 15000},
+  {SEQ_CALL, 0, 0, 0, restoreIdleLeds},
+  {SEQ_END}
+};
+
 // === PWM SPEED CONTROL FUNCTIONS ===
 void setupPWMChannels() {
   ledcAttach(ENA, PWM_FREQ, PWM_RESOLUTION);
@@ -646,205 +795,89 @@ void setMotorSpeed(int speed) {
   Serial.println(speed);
 }
 
-void changeSpeedGradually(int targetSpeed, int stepSize = 5, unsigned long stepMs = 30) {
-  static int currentSpeed = baseSpeed;
-  static unsigned long lastSpeedUpdate = 0;
-  static bool speedChanging = false;
-
-  if (!speedChanging) {
-    currentSpeed = baseSpeed;
-    targetSpeed = constrain(targetSpeed, 0, 255);
-    if (currentSpeed == targetSpeed) return;
-    speedChanging = true;
-  }
-
-  if (shouldAbort()) {
-    speedChanging = false;
-    return;
-  }
+// === SOUND SENSOR FUNCTIONS ===
+void clapBegin() {
+  lcd.clear();
+  lcd.setCursor(0, 0);
+  lcd.print("Clap Detected!");
+  lcd.setCursor(0, 1);
+  lcd.print("Dancing...");
+  setMotorSpeed(slowSpeed);
+  playMelody(MELODY_CLAP);
+}
 
-  if (millis() - lastSpeedUpdate >= stepMs) {
-    int dir = (targetSpeed > currentSpeed) ? 1 : -1;
-    currentSpeed += dir * stepSize;
-    if ((dir > 0 && currentSpeed >= targetSpeed) || (dir < 0 && currentSpeed <= targetSpeed)) {
-      currentSpeed = targetSpeed;
-      speedChanging = false;
-    }
-    setMotorSpeed(currentSpeed);
-    lastSpeedUpdate = millis();
-  }
+void clapEnd() {
+  setMotorSpeed(isDancing ? danceSpeed : normalSpeed);
+  clapMovementInProgress = false;
+  updateLcdScreenFast();
+  Serial.println("Clap response sequence complete!");
 }
 
-// === SOUND SENSOR FUNCTIONS ===
+// Arms reach up, legs bend, arms cross, legs shift, final pose, home
+const SeqStep CLAP_SEQUENCE[] = {
+  {SEQ_CALL, 0, 0, 0, clapBegin},
+  {SEQ_MOVE, 0, 30, 150}, {SEQ_MOVE, 3, 150, 150}, {SEQ_MOVE, 1, 10, 150}, {SEQ_MOVE, 4, 170, 150},
+  {SEQ_SYNC}, {SEQ_WAIT, 0, 0, 300},
+  {SEQ_MOVE, LEG1_HIP_CHANNEL, 15}, {SEQ_MOVE, LEG2_HIP_CHANNEL, 15},
+  {SEQ_MOVE, LEG1_KNEE_CHANNEL, 20}, {SEQ_MOVE, LEG2_KNEE_CHANNEL, 20},
+  {SEQ_MOVE, LEG1_ANKLE_CHANNEL, 10}, {SEQ_MOVE, LEG2_ANKLE_CHANNEL, 10},
+  {SEQ_WAIT, 0, 0, 400},
+  {SEQ_MOVE, 0, 135, 150}, {SEQ_MOVE, 3, 45, 150}, {SEQ_MOVE, 2, 90, 150}, {SEQ_MOVE, 5, 90, 150},
+  {SEQ_SYNC}, {SEQ_WAIT, 0, 0, 300},
+  {SEQ_MOVE, LEG1_HIP_CHANNEL, 25}, {SEQ_MOVE, LEG2_HIP_CHANNEL, 5},
+  {SEQ_MOVE, LEG1_KNEE_CHANNEL, 10}, {SEQ_MOVE, LEG2_KNEE_CHANNEL, 15},
+  {SEQ_WAIT, 0, 0, 300},
+  {SEQ_MOVE, 0, 45, 150}, {SEQ_MOVE, 3, 135, 150}, {SEQ_MOVE, 2, 45, 150}, {SEQ_MOVE, 5, 135, 150},
+  {SEQ_SYNC}, {SEQ_WAIT, 0, 0, 500},
+  {SEQ_HOME, 0, 0, 400},
+  {SEQ_CALL, 0, 0, 0, clapEnd},
+  {SEQ_END}
+};
+
 void checkForClap() {
-  if (gPaused || clapMovementInProgress) return;
+  if (gPaused || gAbortAll || clapMovementInProgress || showState == SHOW_REPLAYING) return;
+  if (audioRunning && beatLocked) return;  // Music is playing: loud frames are beats, not claps
 
-  int soundNow = digitalRead(SOUND_SENSOR_PIN);
+  // A loud audio frame reads like the module's comparator output going low
+  int soundNow = audioRunning ? (audioLoud ? LOW : HIGH) : digitalRead(SOUND_SENSOR_PIN);
   if (soundPreviouslyHigh && soundNow == LOW) {
     if (millis() - lastClapTime > clapDebounceDelay) {
-      Serial.println("🎉 Clap detected! Starting clap response...");
       lastClapTime = millis();
+      if (showClapArmed && startShowReplay()) {
+        Serial.println("🎉 Clap detected! Replaying the recorded show...");
+        webSocket.broadcastTXT("show_playing");
+        soundPreviouslyHigh = (soundNow == HIGH);
+        return;
+      }
+      Serial.println("🎉 Clap detected! Starting clap response...");
       clapMovementInProgress = true;
-      clapLedPatternActive = true;
-      clapPatternStartTime = millis();
-      clapState = CLAP_INIT;
-      setLedPattern(LED_CLAP_RESPONSE);
+      seqStart(SEQ_PRIO_CLAP, CLAP_SEQUENCE, "clap");
+      startLedOverlay(LED_LAYER_CLAP, LED_CLAP_RESPONSE);
       updateLcdScreenFast();
     }
   }
   soundPreviouslyHigh = (soundNow == HIGH);
 }
 
-void executeClapResponseStep() {
-  if (shouldAbort() || !clapMovementInProgress) {
-    clapState = CLAP_IDLE;
-    clapMovementInProgress = false;
-    return;
-  }
-
-  if (millis() - clapStepStartTime < 10) return; // Small delay for smooth updates
-
-  switch (clapState) {
-    case CLAP_INIT:
-      lcd.clear();
-      lcd.setCursor(0, 0);
-      lcd.print("Clap Detected!");
-      lcd.setCursor(0, 1);
-      lcd.print("Dancing...");
-      setMotorSpeed(slowSpeed);
-      playClapResponseSound();
-      clapState = CLAP_MOVE_SET1;
-      clapStepStartTime = millis();
-      break;
-
-    case CLAP_MOVE_SET1:
-      if (clapCurrentStep == 0) {
-        smoothMove(0, 30, 10);
-        smoothMove(3, 150, 10);
-        smoothMove(1, 10, 10);
-        smoothMove(4, 170, 10);
-        clapCurrentStep = 1;
-        clapStepStartTime = millis();
-      } else if (millis() - clapStepStartTime >= 300) {
-        clapCurrentStep = 0;
-        clapState = CLAP_MOVE_SET2;
-        clapStepStartTime = millis();
-      }
-      break;
-
-    case CLAP_MOVE_SET2:
-      if (clapCurrentStep == 0) {
-        pwmWriteAngle(LEG1_HIP_CHANNEL, 15);
-        pwmWriteAngle(LEG2_HIP_CHANNEL, 15);
-        pwmWriteAngle(LEG1_KNEE_CHANNEL, 20);
-        pwmWriteAngle(LEG2_KNEE_CHANNEL, 20);
-        pwmWriteAngle(LEG1_ANKLE_CHANNEL, 10);
-        pwmWriteAngle(LEG2_ANKLE_CHANNEL, 10);
-        clapCurrentStep = 1;
-        clapStepStartTime = millis();
-      } else if (millis() - clapStepStartTime >= 400) {
-        clapCurrentStep = 0;
-        clapState = CLAP_MOVE_SET3;
-        clapStepStartTime = millis();
-      }
-      break;
-
-    case CLAP_MOVE_SET3:
-      if (clapCurrentStep == 0) {
-        smoothMove(0, 135, 10);
-        smoothMove(3, 45, 10);
-        smoothMove(2, 90, 10);
-        smoothMove(5, 90, 10);
-        clapCurrentStep = 1;
-        clapStepStartTime = millis();
-      } else if (millis() - clapStepStartTime >= 300) {
-        clapCurrentStep = 0;
-        clapState = CLAP_MOVE_SET4;
-        clapStepStartTime = millis();
-      }
-      break;
-
-    case CLAP_MOVE_SET4:
-      if (clapCurrentStep == 0) {
-        pwmWriteAngle(LEG1_HIP_CHANNEL, 25);
-        pwmWriteAngle(LEG2_HIP_CHANNEL, 5);
-        pwmWriteAngle(LEG1_KNEE_CHANNEL, 10);
-        pwmWriteAngle(LEG2_KNEE_CHANNEL, 15);
-        clapCurrentStep = 1;
-        clapStepStartTime = millis();
-      } else if (millis() - clapStepStartTime >= 300) {
-        clapCurrentStep = 0;
-        clapState = CLAP_FINAL_POSE;
-        clapStepStartTime = millis();
-      }
-      break;
-
-    case CLAP_FINAL_POSE:
-      if (clapCurrentStep == 0) {
-        smoothMove(0, 45, 10);
-        smoothMove(3, 135, 10);
-        smoothMove(2, 45, 10);
-        smoothMove(5, 135, 10);
-        clapCurrentStep = 1;
-        clapStepStartTime = millis();
-      } else if (millis() - clapStepStartTime >= 500) {
-        clapCurrentStep = 0;
-        clapState = CLAP_RESET;
-        clapStepStartTime = millis();
-      }
-      break;
-
-    case CLAP_RESET:
-      resetAllServos();
-      if (millis() - clapStepStartTime >= 200) {
-        setMotorSpeed(isDancing ? danceSpeed : normalSpeed);
-        clapMovementInProgress = false;
-        clapState = CLAP_IDLE;
-        updateLcdScreenFast();
-        Serial.println("Clap response sequence complete!");
-      }
-      break;
-
-    default:
-      clapState = CLAP_IDLE;
-      clapMovementInProgress = false;
-      break;
-  }
-}
-
-// === ULTRASONIC SENSOR FUNCTIONS ===
-float measureDistance() {
-  digitalWrite(TRIG_PIN, LOW);
-  delayMicroseconds(2);
-  digitalWrite(TRIG_PIN, HIGH);
-  delayMicroseconds(10);
-  digitalWrite(TRIG_PIN, LOW);
-  long duration = pulseIn(ECHO_PIN, HIGH, 30000);
-  float distance = (duration * 0.034) / 2;
-  if (duration == 0) return -1;
-  return distance;
-}
-
+// === ULTRASONIC SENSOR FUNCTIONS (ultrasonic.h) ===
+// Pings when due and acts on each new reading; never waits for an echo
 void checkForObstacles() {
-  if (millis() - lastUltrasonicCheck >= ultrasonicCheckInterval) {
-    float distance = measureDistance();
-    if (distance > 0 && distance <= 50.0) {
-      if (!obstacleDetected) {
-        obstacleDetected = true;
-        setLedPattern(LED_OBSTACLE_WARNING);
-        playErrorSound();
-      }
-    } else {
-      if (obstacleDetected) {
-        obstacleDetected = false;
-        if (isDancing) {
-          setLedPattern(LED_DANCE);
-        } else {
-          setLedPattern(LED_BREATHING);
-        }
-      }
+  ultrasonicPoll();
+  float distance;
+  if (!ultrasonicRead(distance)) return;
+  lastDistanceCm = distance;
+  if (distance > 0 && distance <= OBSTACLE_CM) {
+    if (!obstacleDetected) {
+      obstacleDetected = true;
+      stopBase();  // Now, not when the loop next gets to the base
+      startLedOverlay(LED_LAYER_ALERT, LED_OBSTACLE_WARNING);
+      playMelody(MELODY_ERROR);
+    }
+  } else {
+    if (obstacleDetected) {
+      obstacleDetected = false;
+      ledLayerStop(LED_LAYER_ALERT);
     }
-    lastUltrasonicCheck = millis();
   }
 }
 
@@ -881,314 +914,1054 @@ void handleMotorCH15() {
   }
 }
 
-// === BUZZER CONTROL FUNCTIONS ===
-void playTone(int frequency, int duration) {
-  if (shouldAbort()) return;
-  if (currentTone.active) {
+// === BUZZER CONTROL FUNCTIONS (melody.h) ===
+void buzzerOutput(uint16_t hz) {
+  if (pcmActive()) return;  // The stream has the pin
+  if (hz) {
+    tone(BUZZER_PIN, hz);
+  } else {
     noTone(BUZZER_PIN);
-    currentTone.active = false;
   }
-  if (frequency > 0) {
-    tone(BUZZER_PIN, frequency);
-    currentTone = {frequency, duration, millis(), true};
+}
+
+void playMelody(MelodyId id) {
+  melodyPlay(MELODIES[id]);
+}
+
+// Single notes (the bytecode VM's tone op)
+void playTone(int frequency, int duration) {
+  if (shouldAbort()) return;
+  melodyTone("tone", constrain(frequency, 0, 20000), constrain(duration, 0, 60000), MELODY_PRIO_STEP);
+}
+
+void playStepSound(int stepNumber) {
+  if (shouldAbort()) return;
+  const uint16_t frequencies[] = {
+    262, 294, 330, 349, 392, 440, 494, 523, 587, 659,
+    698, 784, 831, 880, 932, 988, 1047, 1175, 1319, 1397,
+    1568, 1661, 1760, 1865, 1976, 2093
+  };
+  if (stepNumber >= 1 && stepNumber <= 26) {
+    melodyTone("step", frequencies[stepNumber - 1], 150, MELODY_PRIO_STEP);
   }
 }
 
+void playStartupSound() {
+  playMelody(MELODY_STARTUP);
+}
+
 void updateBuzzer() {
-  if (currentTone.active && millis() - currentTone.startTime >= currentTone.duration) {
-    noTone(BUZZER_PIN);
-    currentTone.active = false;
-  }
+  melodyPoll();
 }
 
-void playClapResponseSound() {
-  static int clapSoundStep = 0;
-  static unsigned long lastSoundTime = 0;
-  const int tones[] = {523, 659, 784, 1047, 988, 880, 784, 1047, 1319};
-  const int durations[] = {100, 100, 100, 150, 80, 80, 120, 200, 250};
-  const int delays[] = {0, 0, 0, 50, 0, 0, 100, 0, 0};
+// === OPTIMIZED LCD UPDATE FUNCTIONS ===
+void updateLcdScreenFast() {
+  if (millis() - lastLcdUpdate < 50) return;
+  lcd.clear();
+  switch (lcdState) {
+    case PLAYING:
+      lcd.setCursor(0, 0);
+      lcd.print(currentSong.substring(0, 16));
+      lcd.setCursor(0, 1);
+      lcd.print(obstacleDetected ? "OBSTACLE!" : "Playing");
+      break;
+    case PAUSED:
+      lcd.setCursor(0, 0);
+      lcd.print(currentSong.substring(0, 16));
+      lcd.setCursor(0, 1);
+      lcd.print("Paused");
+      break;
+    case STOPPED:
+      lcd.setCursor(0, 0);
+      lcd.print("Robot Ready");
+      lcd.setCursor(0, 1);
+      lcd.print("Clap to dance!");
+      break;
+    case INIT:
+      lcd.setCursor(0, 0);
+      lcd.print("IP Address:");
+      lcd.setCursor(0, 1);
+      lcd.print(WiFi.localIP().toString());
+      break;
+  }
+  lastLcdUpdate = millis();
+}
 
-  if (shouldAbort()) {
-    clapSoundStep = 0;
-    return;
+// === SONG-SPECIFIC STEP EXECUTION ===
+#if CHOREO_COMPRESSED
+// Track table entry for a song name; the last entry ("Other") covers unknown songs
+const ChoreoSong* choreoSongFor(const String& song) {
+  for (int i = 0; i < CHOREO_SONG_COUNT - 1; i++) {
+    if (song == CHOREO_SONGS[i].name) return &CHOREO_SONGS[i];
   }
+  return &CHOREO_SONGS[CHOREO_SONG_COUNT - 1];
+}
 
-  if (clapSoundStep < 9 && millis() - lastSoundTime >= (clapSoundStep > 0 ? delays[clapSoundStep - 1] : 0)) {
-    if (!currentTone.active) {
-      playTone(tones[clapSoundStep], durations[clapSoundStep]);
-      clapSoundStep++;
-      lastSoundTime = millis();
-    }
-  } else if (clapSoundStep >= 9) {
-    clapSoundStep = 0;
+bool startDanceTrack() {
+  if (choreoStart(choreoSongFor(currentSong), currentDanceStep)) return true;
+  Serial.println("Unknown step for current song");
+  return false;
+}
+#else
+// Legacy step files block until the step is done, so there is no track to wait for
+bool startDanceTrack() {
+  if (currentSong == "Falling For You") {
+    executeFallingStep(currentDanceStep);
+  } else if (currentSong == "Stereo Love") {
+    executeStereoStep(currentDanceStep);
+  } else if (currentSong == "Faded") {
+    executeFadedStep(currentDanceStep);
+  } else if (currentSong == "Alone") {
+    executeAloneStep(currentDanceStep);
+  } else if (currentSong == "Mastie Mashup") {
+    executeNeuralStep(currentDanceStep);
+  } else {
+    executeOtherStep(currentDanceStep);
   }
+  return false;
+}
+#endif
+
+void danceStepBegin() {
+  uint8_t step;
+  if (!stepqPop(step)) return;
+  currentDanceStep = step;
+  playStepSound(currentDanceStep);
+  ledFlash(CRGB::White);
+}
+
+void danceStepEnd() {
+  Serial.println("Dance step complete, servos reset");
 }
 
-void playWifiConnectedSound() {
-  static int wifiSoundStep = 0;
-  static unsigned long lastSoundTime = 0;
-  const int tones[] = {523, 659, 784, 1047, 1047, 1175, 1319, 1397, 1568, 1047, 1319, 1568};
-  const int durations[] = {150, 150, 150, 200, 100, 100, 100, 100, 300, 100, 100, 400};
-  const int delays[] = {0, 0, 0, 100, 0, 0, 0, 0, 200, 50, 50, 0};
+// A step queued by the time one finishes starts from where that one ended
+const SeqStep DANCE_STEP_SEQUENCE[] = {
+  {SEQ_AWAIT, 0, 0, BEAT_STEP_WAIT_MS, nullptr, beatStepDue},
+  {SEQ_CALL, 0, 0, 0, danceStepBegin},
+  {SEQ_TRACK},
+  {SEQ_JUMP_IF, 0, 0, 0, nullptr, stepqPending},
+  {SEQ_WAIT, 0, 0, 200},
+  {SEQ_JUMP_IF, 0, 0, 0, nullptr, stepqPending},
+  {SEQ_HOME, 0, 0, 500},
+  {SEQ_JUMP_IF, 0, 0, 0, nullptr, stepqPending},
+  {SEQ_CALL, 0, 0, 0, danceStepEnd},
+  {SEQ_END}
+};
 
-  if (shouldAbort()) {
-    wifiSoundStep = 0;
+const char* STEP_OVERRUN_NAMES[] = {"", "oldest", "newest", "coalesced"};
+
+// Play now if no step is running, otherwise wait behind it
+void queueDanceStep(uint8_t step) {
+  bool playing = seqRunning(SEQ_PRIO_DANCE) && seqSlots[SEQ_PRIO_DANCE].steps == DANCE_STEP_SEQUENCE;
+  if (!playing) stepqClear();
+  uint8_t lost = 0;
+  StepqResult result = stepqPush(step, lost);
+  if (!playing) {
+    seqStart(SEQ_PRIO_DANCE, DANCE_STEP_SEQUENCE, "dance step");
     return;
   }
+  if (result == STEPQ_QUEUED) return;
 
-  if (wifiSoundStep < 12 && millis() - lastSoundTime >= (wifiSoundStep > 0 ? delays[wifiSoundStep - 1] : 0)) {
-    if (!currentTone.active) {
-      playTone(tones[wifiSoundStep], durations[wifiSoundStep]);
-      wifiSoundStep++;
-      lastSoundTime = millis();
-    }
-  } else if (wifiSoundStep >= 12) {
-    wifiSoundStep = 0;
-    Serial.println("WiFi connection sound complete!");
-  }
+  // Tell every client which step was lost
+  char report[32];
+  snprintf(report, sizeof(report), "step_overrun:%s,%u", STEP_OVERRUN_NAMES[result], lost);
+  webSocket.broadcastTXT(report);
+  Serial.println(report);
 }
 
-void playStartupSound() {
-  static int startupSoundStep = 0;
-  static unsigned long lastSoundTime = 0;
-  const int tones[] = {440, 523, 659, 784};
-  const int durations[] = {200, 200, 200, 300};
+// Procedural dancing runs until the next song, step or stop replaces it
+const SeqStep CPG_SEQUENCE[] = {
+  {SEQ_CPG},
+  {SEQ_END}
+};
+
+const SeqStep VM_SEQUENCE[] = {
+  {SEQ_VM},
+  {SEQ_HOME, 0, 0, 500},
+  {SEQ_END}
+};
+
+// === BEAT FOLLOWING (beat_tracker.h) ===
+void audioFrameAnalysed(uint32_t frameEndUs) {
+  beatTrackFrame(audioBandLog, frameEndUs);
+}
+
+bool beatFollowing() {
+  return beatMode != BEAT_OFF && beatLocked;
+}
 
-  if (shouldAbort()) {
-    startupSoundStep = 0;
+// Dance steps start on a beat while following, otherwise at once
+bool beatStepDue() {
+  return !beatFollowing() || beatTickNow;
+}
+
+void beatAutoDanceStart() {
+  beatAutoDancing = true;
+  seqStart(SEQ_PRIO_DANCE, CPG_SEQUENCE, "beat dance");
+  setLedPattern(LED_BASS);
+  webSocket.broadcastTXT("beat_dance_started");
+  Serial.println("Music detected, dancing to the beat");
+}
+
+void beatAutoDanceEnd() {
+  beatAutoDancing = false;
+  seqStart(SEQ_PRIO_DANCE, STOP_HOME_SEQUENCE, "beat dance end");
+  setLedPattern(LED_BREATHING);
+  webSocket.broadcastTXT("beat_dance_ended");
+  Serial.println("Music stopped, beat dance over");
+}
+
+// Every loop pass: fire the beat clock and keep the CPG, steps and auto dance on it
+void updateBeatFollow() {
+  bool ticked = beatClockPoll();
+  if (beatAutoDancing && (!seqRunning(SEQ_PRIO_DANCE) || seqSlots[SEQ_PRIO_DANCE].steps != CPG_SEQUENCE)) {
+    beatAutoDancing = false;  // A song, step, stop or pause took over
+  }
+  if (!beatLocked) {
+    if (beatLockedTicks) beatLostAt = millis();
+    beatLockedTicks = 0;
+    if (beatAutoDancing && millis() - beatLostAt > BEAT_AUTO_STOP_MS) beatAutoDanceEnd();
     return;
   }
+  if (!ticked || beatMode == BEAT_OFF) return;
 
-  if (startupSoundStep < 4 && millis() - lastSoundTime >= (startupSoundStep > 0 ? durations[startupSoundStep - 1] : 0)) {
-    if (!currentTone.active) {
-      playTone(tones[startupSoundStep], durations[startupSoundStep]);
-      startupSoundStep++;
-      lastSoundTime = millis();
-    }
-  } else if (startupSoundStep >= 4) {
-    startupSoundStep = 0;
+  beatLockedTicks++;
+  cpgSyncBeat(beatTickPeriodUs, micros() - beatLastTickUs);  // Also the tempo LED cues follow
+  if (beatAutoDancing) cpgSetEnergy(audioLevel);
+
+  // Only on a fresh lock, so a stop during the music holds until it ends
+  if (beatMode == BEAT_AUTO && beatLockedTicks == BEAT_AUTO_START_BEATS && !isDancing && !gPaused &&
+      !clapMovementInProgress && showState == SHOW_IDLE && !seqRunning(SEQ_PRIO_DANCE)) {
+    beatAutoDanceStart();
   }
 }
 
-void playDanceSound() {
-  static int danceSoundStep = 0;
-  static unsigned long lastSoundTime = 0;
-  const int tones[] = {659, 784, 988, 1047};
-  const int durations[] = {150, 150, 150, 200};
-
-  if (shouldAbort()) {
-    danceSoundStep = 0;
+// === PCM STREAM (pcm_stream.h) ===
+// The LED cues run on the samples played: they start with the first one and stop on an underrun
+void pcmPlaybackChanged(bool playing, uint32_t positionSamples) {
+  if (!playing) {
+    ledCuesPause();
     return;
   }
+  if (positionSamples == 0 && ledCuesActive()) {
+    ledCuesStart(cueTrack);
+  } else {
+    ledCuesResume();
+  }
+}
 
-  if (danceSoundStep < 4 && millis() - lastSoundTime >= (danceSoundStep > 0 ? durations[danceSoundStep - 1] : 0)) {
-    if (!currentTone.active) {
-      playTone(tones[danceSoundStep], durations[danceSoundStep]);
-      danceSoundStep++;
-      lastSoundTime = millis();
-    }
-  } else if (danceSoundStep >= 4) {
-    danceSoundStep = 0;
+// === COMMAND EXECUTION ===
+void startSong(const char* name, size_t nameLen) {
+  char songName[SONG_NAME_MAX + 1];
+  nameLen = min(nameLen, (size_t)SONG_NAME_MAX);
+  memcpy(songName, name, nameLen);
+  songName[nameLen] = '\0';
+  currentSong = songName;
+  seqCancel(SEQ_PRIO_DANCE); // Uploaded songs restart the CPG with "tempo:"
+  stepqClear();
+  gAbortAll = false;
+  isDancing = true;
+  lcdState = PLAYING;
+  setMotorSpeed(danceSpeed);
+  setLedPattern(LED_DANCE);
+  ledCuesStart(ledCueTrackFor(songName));
+  playMelody(MELODY_DANCE);
+  Serial.print("Song started: ");
+  Serial.println(currentSong);
+}
+
+// Shared by the text and binary protocols; false if the command was rejected
+bool executeCommand(const RbCommand& cmd) {
+  showRecord(cmd);
+  switch (cmd.op) {
+    case RB_OP_PAUSE:
+      pauseImmediate();
+      playMelody(MELODY_PAUSE);
+      Serial.println("⚡ IMMEDIATE PAUSE EXECUTED");
+      return true;
+
+    case RB_OP_STOP:
+      stopImmediate();
+      playMelody(MELODY_STOP);
+      Serial.println("⚡ IMMEDIATE STOP EXECUTED");
+      return true;
+
+    case RB_OP_RESUME:
+      resumeFromPause();
+      playMelody(MELODY_RESUME);
+      Serial.println("⚡ IMMEDIATE RESUME EXECUTED");
+      return true;
+
+    case RB_OP_STEP:
+      if (cmd.value < 1 || cmd.value > 26) return false;
+      queueDanceStep(cmd.value);
+      return true;
+
+    case RB_OP_STEP_DEPTH:
+      return stepqConfigure(cmd.value, stepqPolicy);
+
+    case RB_OP_STEP_POLICY:
+      return stepqConfigure(stepqDepth, cmd.value);
+
+    case RB_OP_SONG:
+      startSong(cmd.text, cmd.textLen);
+      return true;
+
+    case RB_OP_SPEED:
+      if (cmd.value < 0 || cmd.value > 255) return false;
+      setMotorSpeed(cmd.value);  // At once: the coalesced ack reports the value as applied
+      return true;
+
+    case RB_OP_LED:
+      if (cmd.value < 0 || cmd.value > LED_SPECTRUM) return false;
+      ledCuesStop();  // A chosen pattern takes over from the song's cues
+      setLedPattern((LedPattern)cmd.value);
+      return true;
+
+    case RB_OP_BRIGHTNESS:
+      if (cmd.value < 0 || cmd.value > 255) return false;
+      ledBrightness = cmd.value;
+      FastLED.setBrightness(ledBrightness);
+      Serial.print("LED brightness changed to: ");
+      Serial.println(cmd.value);
+      return true;
+
+    case RB_OP_TEMPO:
+      if (cmd.value < CPG_MIN_BPM || cmd.value > CPG_MAX_BPM) return false;
+      cpgSetTempo(cmd.value);
+      if (!seqRunning(SEQ_PRIO_DANCE) || seqSlots[SEQ_PRIO_DANCE].steps != CPG_SEQUENCE) {
+        seqStart(SEQ_PRIO_DANCE, CPG_SEQUENCE, "procedural dance");
+      }
+      return true;
+
+    case RB_OP_ENERGY:
+      if (cmd.value < 0 || cmd.value > 255) return false;
+      cpgSetEnergy(cmd.value);
+      return true;
+
+    case RB_OP_TELEMETRY:
+      return telemetrySetRate(cmd.value);
+
+    case RB_OP_RUN_BYTECODE:
+      if (showState == SHOW_RECORDING || !vmLoadStaged()) return false;  // A show log can't hold the program
+      gAbortAll = false;
+      seqStart(SEQ_PRIO_DANCE, VM_SEQUENCE, "bytecode dance");
+      return true;
+
+    case RB_OP_ERROR_SOUND:
+      playMelody(MELODY_ERROR);
+      return true;
+
+    default:
+      return false;
   }
 }
 
-void playStepSound(int stepNumber) {
-  if (shouldAbort()) return;
-  int frequencies[] = {
-    262, 294, 330, 349, 392, 440, 494, 523, 587, 659,
-    698, 784, 831, 880, 932, 988, 1047, 1175, 1319, 1397,
-    1568, 1661, 1760, 1865, 1976, 2093
-  };
-  if (stepNumber >= 1 && stepNumber <= 26) {
-    playTone(frequencies[stepNumber - 1], 150);
+// === COMMAND QUEUE ===
+// Binary frame being drained, so its single ACK can report how far it got
+uint16_t drainFrameSeq = 0;
+uint8_t drainFrameExecuted = 0;
+uint8_t drainFrameStatus = RB_STATUS_OK;
+bool drainInFrame = false;
+
+void sendFrameAck(uint8_t num, uint16_t seq, uint8_t executed, uint8_t status) {
+  uint8_t ack[8];
+  webSocket.sendBIN(num, ack, rbWriteAck(ack, seq, executed, status));
+}
+
+// A pause/stop overtook this entry; close its binary frame if it was the last one
+void ackDroppedCommand(const QueuedCommand& entry) {
+  if (!(entry.flags & CMDQ_FRAME_END)) return;
+  bool started = drainInFrame && drainFrameSeq == entry.frameSeq;
+  sendFrameAck(entry.client, entry.frameSeq, started ? drainFrameExecuted : 0, RB_STATUS_CANCELLED);
+  if (started) drainInFrame = false;
+}
+
+// Setters sent before a normal command must land before it runs, and later ones after it
+void queueSetterBarrier() {
+  if (!cmdqSettersPending()) return;
+  QueuedCommand entry = {};
+  entry.cmd.op = RB_OP_APPLY_SETTERS;
+  cmdqSnapshotSetters(entry.setters);
+  if (cmdqPush(CMDQ_PRIO_NORMAL, entry)) cmdqDropSetters();
+}
+
+// A pause/stop from the network overtakes everything still waiting, and ends a show replay
+void preemptForUrgent() {
+  gAbortAll = true;  // Whatever is moving sees this on its next shouldAbort()
+  cmdqDiscardBelow(CMDQ_PRIO_URGENT, ackDroppedCommand);
+  cmdqDropSetters();
+  if (showState == SHOW_REPLAYING) {
+    showStopReplay();
+    webSocket.broadcastTXT("show_stopped");
   }
 }
 
-void playPauseSound() {
-  static int pauseSoundStep = 0;
-  static unsigned long lastSoundTime = 0;
-  const int tones[] = {659, 523};
-  const int durations[] = {200, 300};
+// Callback side: queue for loop(); pause/stop raise the abort flag right away
+bool queueEntry(uint8_t prio, const QueuedCommand& entry) {
+  if (prio == CMDQ_PRIO_URGENT) {
+    preemptForUrgent();
+  } else {
+    queueSetterBarrier();
+  }
+  return cmdqPush(prio, entry);
+}
 
-  if (shouldAbort()) {
-    pauseSoundStep = 0;
-    return;
+void queueErrorSound() {
+  QueuedCommand entry = {};
+  entry.cmd.op = RB_OP_ERROR_SOUND;
+  cmdqPush(CMDQ_PRIO_NORMAL, entry);
+}
+
+void queueTextCommand(uint8_t num, const RbCommand& cmd, const char* okAck, const char* errorAck) {
+  QueuedCommand entry = {};
+  entry.cmd = cmd;
+  entry.client = num;
+  entry.okAck = okAck;
+  entry.errorAck = errorAck;
+  if (!queueEntry(cmdqPriorityFor(cmd.op), entry)) {
+    webSocket.sendTXT(num, errorAck ? errorAck : "queue_full");
+    Serial.println("Command queue full, command dropped");
   }
+}
 
-  if (pauseSoundStep < 2 && millis() - lastSoundTime >= (pauseSoundStep > 0 ? durations[pauseSoundStep - 1] : 0)) {
-    if (!currentTone.active) {
-      playTone(tones[pauseSoundStep], durations[pauseSoundStep]);
-      pauseSoundStep++;
-      lastSoundTime = millis();
-    }
-  } else if (pauseSoundStep >= 2) {
-    pauseSoundStep = 0;
+// Apply a batch of setter values, then one combined ack
+// ("set:speed=150,brightness=200", "speed=error" if rejected) to each client that sent one
+void applySetters(const SetterBatch& batch) {
+  char ack[64] = "set:";
+  size_t used = 4;
+  uint32_t clients = 0;
+  bool failed = false;
+  for (uint8_t i = 0; i < CMDQ_SETTERS; i++) {
+    if (!(batch.pending & (1 << i))) continue;
+    const PendingSetter& setter = cmdqSetters[i];
+    RbCommand cmd = {setter.op, batch.value[i], 0, nullptr, 0};
+    bool ok = executeCommand(cmd);
+    failed |= !ok;
+    clients |= batch.clients[i];
+    int n = ok ? snprintf(ack + used, sizeof(ack) - used, "%s%s=%ld", used > 4 ? "," : "", setter.name, (long)batch.value[i])
+               : snprintf(ack + used, sizeof(ack) - used, "%s%s=error", used > 4 ? "," : "", setter.name);
+    used = min(used + n, sizeof(ack) - 1);
+  }
+  for (uint8_t num = 0; clients; num++, clients >>= 1) {
+    if (clients & 1) webSocket.sendTXT(num, ack);
   }
+  if (failed) playMelody(MELODY_ERROR);
 }
 
-void playStopSound() {
-  static int stopSoundStep = 0;
-  static unsigned long lastSoundTime = 0;
-  const int tones[] = {784, 659, 523, 392};
-  const int durations[] = {150, 150, 200, 300};
+// Setters that arrived after every queued command; they wait while older commands are queued
+void applyLatestSetters() {
+  if (!cmdqSettersPending() || cmdQueues[CMDQ_PRIO_NORMAL].count) return;
+  SetterBatch batch;
+  cmdqSnapshotSetters(batch);
+  cmdqDropSetters();
+  applySetters(batch);
+}
 
-  if (shouldAbort()) {
-    stopSoundStep = 0;
-    return;
+// Loop side: run queued commands and send their acks
+void drainCommandQueue() {
+  QueuedCommand entry;
+  // Bounded, in case commands arrive while these run
+  for (int budget = 0; budget < CMDQ_DEPTH * CMDQ_PRIORITIES && cmdqPop(entry); budget++) {
+    if (entry.cmd.op == RB_OP_APPLY_SETTERS) {
+      applySetters(entry.setters);
+      continue;
+    }
+    if (entry.cmd.op == RB_OP_SHOW) {
+      runShowCommand(entry.client, entry.cmd.value);
+      continue;
+    }
+    if (!(entry.flags & CMDQ_BINARY)) {
+      if (executeCommand(entry.cmd)) {
+        if (entry.okAck) webSocket.sendTXT(entry.client, entry.okAck);
+      } else {
+        if (entry.errorAck) webSocket.sendTXT(entry.client, entry.errorAck);
+        playMelody(MELODY_ERROR);
+      }
+      continue;
+    }
+
+    if (entry.flags & CMDQ_FRAME_START) {
+      drainFrameSeq = entry.frameSeq;
+      drainFrameExecuted = entry.frameImmediate;
+      drainFrameStatus = RB_STATUS_OK;
+      drainInFrame = true;
+    }
+    // The first rejected command ends the frame; the rest are skipped
+    if (drainFrameStatus == RB_STATUS_OK) {
+      if (executeCommand(entry.cmd)) {
+        drainFrameExecuted++;
+      } else {
+        drainFrameStatus = RB_STATUS_REJECTED;
+      }
+    }
+    if (entry.flags & CMDQ_FRAME_END) {
+      drainInFrame = false;
+      sendFrameAck(entry.client, entry.frameSeq, drainFrameExecuted, drainFrameStatus);
+      if (drainFrameStatus != RB_STATUS_OK) {
+        playMelody(MELODY_ERROR);
+        Serial.printf("Binary frame %u stopped after %u commands\n", entry.frameSeq, drainFrameExecuted);
+      }
+    }
+  }
+  applyLatestSetters();  // Once per loop pass, however many arrived
+}
+
+// === SHOW RECORDER ===
+// Settings the recorded commands build on, logged as the first records
+void recordShowSnapshot() {
+  RbCommand cmd = {RB_OP_STEP_DEPTH, stepqDepth, 0, nullptr, 0};
+  showRecord(cmd);
+  cmd = {RB_OP_STEP_POLICY, stepqPolicy, 0, nullptr, 0};
+  showRecord(cmd);
+  cmd = {RB_OP_SPEED, baseSpeed, 0, nullptr, 0};
+  showRecord(cmd);
+  cmd = {RB_OP_ENERGY, cpgEnergy, 0, nullptr, 0};
+  showRecord(cmd);
+  cmd = {RB_OP_BRIGHTNESS, ledBrightness, 0, nullptr, 0};
+  showRecord(cmd);
+  if (isDancing) {
+    cmd = {RB_OP_SONG, 0, 0, currentSong.c_str(), (uint8_t)min(currentSong.length(), (unsigned int)SONG_NAME_MAX)};
+    showRecord(cmd);
+  }
+  // Tempo starts the procedural dance, so it is only part of the state while that runs
+  if (seqRunning(SEQ_PRIO_DANCE) && seqSlots[SEQ_PRIO_DANCE].steps == CPG_SEQUENCE) {
+    cmd = {RB_OP_TEMPO, cpgTempo, 0, nullptr, 0};
+    showRecord(cmd);
+  }
+  // After the song, which sets its own; not while its cue track drives the strip (led: would stop it)
+  if (!ledCuesActive() && currentLedPattern <= LED_SPECTRUM) {
+    cmd = {RB_OP_LED, currentLedPattern, 0, nullptr, 0};
+    showRecord(cmd);
   }
+}
+
+// Replays start from a stopped robot (without the stop sound), whatever was going on
+bool startShowReplay() {
+  if (showState != SHOW_IDLE) return false;
+  stopImmediate();
+  gAbortAll = false;
+  if (!showStartReplay()) return false;
+  Serial.println("▶ Show replay started");
+  return true;
+}
 
-  if (stopSoundStep < 4 && millis() - lastSoundTime >= (stopSoundStep > 0 ? durations[stopSoundStep - 1] : 0)) {
-    if (!currentTone.active) {
-      playTone(tones[stopSoundStep], durations[stopSoundStep]);
-      stopSoundStep++;
-      lastSoundTime = millis();
+// A queued show: command; the reply depends on the log, so it is sent from here
+void runShowCommand(uint8_t num, uint8_t action) {
+  char reply[64];
+  switch (action) {
+    case SHOW_ACTION_RECORD:
+      if (vm.running) {
+        webSocket.sendTXT(num, "show_error:bytecode");  // The log can't hold the program
+      } else if (showStartRecording()) {
+        recordShowSnapshot();
+        webSocket.sendTXT(num, "show_recording");
+        Serial.println("⏺ Show recording started");
+      } else {
+        webSocket.sendTXT(num, "show_error:busy");
+      }
+      break;
+    case SHOW_ACTION_STOP:
+      if (showState == SHOW_RECORDING) {
+        showStopRecording();
+        snprintf(reply, sizeof(reply), "show_saved:%lu,%lu,%lu", (unsigned long)showRecords,
+                 (unsigned long)showBytes, (unsigned long)showDropped);
+        webSocket.sendTXT(num, reply);
+      } else {
+        showStopReplay();
+        webSocket.sendTXT(num, "show_stopped");
+      }
+      break;
+    case SHOW_ACTION_PLAY:
+      webSocket.sendTXT(num, startShowReplay() ? "show_playing" : "show_error:no_log");
+      break;
+    case SHOW_ACTION_INFO: {
+      const char* states[] = {"idle", "recording", "replaying"};
+      File log = LittleFS.open(SHOW_LOG_PATH, "r");
+      snprintf(reply, sizeof(reply), "show_info:%s,%lu,%s", states[showState], log ? (unsigned long)log.size() : 0UL,
+               showClapArmed ? "armed" : "disarmed");
+      if (log) log.close();
+      webSocket.sendTXT(num, reply);
+      break;
     }
-  } else if (stopSoundStep >= 4) {
-    stopSoundStep = 0;
   }
 }
 
-void playResumeSound() {
-  static int resumeSoundStep = 0;
-  static unsigned long lastSoundTime = 0;
-  const int tones[] = {523, 659, 784};
-  const int durations[] = {150, 150, 200};
+void finishShowReplay() {
+  char reply[48] = "show_done:";
+  showReplayStats(reply + 10, sizeof(reply) - 10);
+  webSocket.broadcastTXT(reply);
+  Serial.print("Show replay finished (records,avgLateUs,maxLateUs): ");
+  Serial.println(reply + 10);
+}
+
+// === TEXT COMMAND HANDLERS ===
+// Each gets the text after "verb:" straight from the payload (not terminated).
+// They only validate and queue; drainCommandQueue() does the work.
+void runTextCommand(uint8_t num, uint8_t op, int32_t value, const char* okAck) {
+  RbCommand cmd = {op, value, 0, nullptr, 0};
+  if (okAck) webSocket.sendTXT(num, okAck);  // Ack straight away, the client doesn't wait on the queue
+  queueTextCommand(num, cmd, nullptr, nullptr);
+}
 
-  if (shouldAbort()) {
-    resumeSoundStep = 0;
+// Idempotent setters: only the latest value per loop pass is applied (applySetters)
+void runSetterCommand(uint8_t num, uint8_t op, const char* arg, size_t argLen, const char* errorAck) {
+  int32_t value;
+  if (!cmdParseInt(arg, argLen, value)) {
+    webSocket.sendTXT(num, errorAck);
+    queueErrorSound();
     return;
   }
+  cmdqSetLatest(*cmdqSetterFor(op), value, num);
+}
 
-  if (resumeSoundStep < 3 && millis() - lastSoundTime >= (resumeSoundStep > 0 ? durations[resumeSoundStep - 1] : 0)) {
-    if (!currentTone.active) {
-      playTone(tones[resumeSoundStep], durations[resumeSoundStep]);
-      resumeSoundStep++;
-      lastSoundTime = millis();
-    }
-  } else if (resumeSoundStep >= 3) {
-    resumeSoundStep = 0;
+// "verb:<int>" commands: ack okAck once it ran, or errorAck and the error sound
+void runIntCommand(uint8_t num, uint8_t op, const char* arg, size_t argLen, const char* okAck, const char* errorAck) {
+  RbCommand cmd = {op, 0, 0, nullptr, 0};
+  if (!cmdParseInt(arg, argLen, cmd.value)) {
+    webSocket.sendTXT(num, errorAck);
+    queueErrorSound();
+    return;
   }
+  queueTextCommand(num, cmd, okAck, errorAck);
+}
+
+void cmdPause(uint8_t num, const char* arg, size_t argLen) {
+  runTextCommand(num, RB_OP_PAUSE, 0, "paused_ack");
 }
 
-void playErrorSound() {
-  static int errorSoundStep = 0;
-  static unsigned long lastSoundTime = 0;
-  const int tones[] = {200, 200, 200};
-  const int durations[] = {100, 100, 100};
-  const int delays[] = {50, 50, 0};
+void cmdStop(uint8_t num, const char* arg, size_t argLen) {
+  runTextCommand(num, RB_OP_STOP, 0, "stopped_ack");
+}
 
-  if (shouldAbort()) {
-    errorSoundStep = 0;
-    return;
+void cmdResume(uint8_t num, const char* arg, size_t argLen) {
+  runTextCommand(num, RB_OP_RESUME, 0, "resumed_ack");
+}
+
+void cmdHeartbeat(uint8_t num, const char* arg, size_t argLen) {
+}
+
+void cmdSong(uint8_t num, const char* arg, size_t argLen) {
+  webSocket.sendTXT(num, "song_started");
+  RbCommand cmd = {RB_OP_SONG, 0, 0, arg, (uint8_t)min(argLen, (size_t)SONG_NAME_MAX)};
+  queueTextCommand(num, cmd, nullptr, nullptr);
+}
+
+void cmdSpeed(uint8_t num, const char* arg, size_t argLen) {
+  runSetterCommand(num, RB_OP_SPEED, arg, argLen, "speed_error");
+}
+
+struct LedPatternName {
+  uint32_t hash;
+  const char* name;
+  LedPattern pattern;
+};
+
+#define LED_NAME(name, pattern) {cmdHash(name), name, pattern}
+
+const LedPatternName LED_PATTERN_NAMES[] = {
+  LED_NAME("off", LED_OFF),
+  LED_NAME("rainbow", LED_RAINBOW),
+  LED_NAME("pulse", LED_PULSE),
+  LED_NAME("chase", LED_CHASE),
+  LED_NAME("strobe", LED_STROBE),
+  LED_NAME("fire", LED_FIRE),
+  LED_NAME("dance", LED_DANCE),
+  LED_NAME("breathing", LED_BREATHING),
+  LED_NAME("wave", LED_WAVE),
+  LED_NAME("vu", LED_VU),
+  LED_NAME("bass", LED_BASS),
+  LED_NAME("spectrum", LED_SPECTRUM)
+};
+
+void cmdLed(uint8_t num, const char* arg, size_t argLen) {
+  uint32_t hash = cmdHashRange(arg, argLen, true);
+  for (const LedPatternName& entry : LED_PATTERN_NAMES) {
+    if (entry.hash == hash && cmdMatches(entry.name, arg, argLen, true)) {
+      cmdqSetLatest(*cmdqSetterFor(RB_OP_LED), entry.pattern, num);
+      return;
+    }
   }
+  queueErrorSound();
+  webSocket.sendTXT(num, "led_error");
+  Serial.println("Unknown LED pattern");
+}
+
+void cmdBrightness(uint8_t num, const char* arg, size_t argLen) {
+  runSetterCommand(num, RB_OP_BRIGHTNESS, arg, argLen, "brightness_error");
+}
+
+void cmdTempo(uint8_t num, const char* arg, size_t argLen) {
+  runIntCommand(num, RB_OP_TEMPO, arg, argLen, "tempo_set", "tempo_error");
+}
+
+void cmdEnergy(uint8_t num, const char* arg, size_t argLen) {
+  runIntCommand(num, RB_OP_ENERGY, arg, argLen, "energy_set", "energy_error");
+}
 
-  if (errorSoundStep < 3 && millis() - lastSoundTime >= (errorSoundStep > 0 ? delays[errorSoundStep - 1] : 0)) {
-    if (!currentTone.active) {
-      playTone(tones[errorSoundStep], durations[errorSoundStep]);
-      errorSoundStep++;
-      lastSoundTime = millis();
+void cmdTelemetry(uint8_t num, const char* arg, size_t argLen) {
+  runIntCommand(num, RB_OP_TELEMETRY, arg, argLen, "telemetry_set", "telemetry_error");
+}
+
+void cmdStepQueue(uint8_t num, const char* arg, size_t argLen) {
+  runIntCommand(num, RB_OP_STEP_DEPTH, arg, argLen, "stepqueue_set", "stepqueue_error");
+}
+
+// Same order as StepqPolicy
+const char* STEP_POLICY_NAMES[] = {"oldest", "newest", "coalesce"};
+
+void cmdStepPolicy(uint8_t num, const char* arg, size_t argLen) {
+  for (uint8_t policy = 0; policy < STEPQ_POLICIES; policy++) {
+    if (cmdMatches(STEP_POLICY_NAMES[policy], arg, argLen, true)) {
+      RbCommand cmd = {RB_OP_STEP_POLICY, policy, 0, nullptr, 0};
+      queueTextCommand(num, cmd, "steppolicy_set", "steppolicy_error");
+      return;
     }
-  } else if (errorSoundStep >= 3) {
-    errorSoundStep = 0;
   }
+  queueErrorSound();
+  webSocket.sendTXT(num, "steppolicy_error");
 }
 
-void testBuzzer() {
-  static int buzzerTestStep = 0;
-  static unsigned long lastTestTime = 0;
-  const int tones[] = {500, 800, 1100, 1400, 1700, 2000};
-  const int durations[] = {150, 150, 150, 150, 150, 150};
-  const int delays[] = {200, 200, 200, 200, 200, 200};
+// Network-only, answered from the callback
+void cmdNetPump(uint8_t num, const char* arg, size_t argLen) {
+  int32_t intervalUs;
+  bool ok = cmdParseInt(arg, argLen, intervalUs) && netPumpSetInterval(intervalUs);
+  webSocket.sendTXT(num, ok ? "netpump_changed" : "netpump_error");
+}
 
-  if (shouldAbort()) {
-    buzzerTestStep = 0;
+void cmdLedStats(uint8_t num, const char* arg, size_t argLen) {
+  char reply[64] = "ledstats:";
+  ledOutputStats(reply + 9, sizeof(reply) - 9);
+  webSocket.sendTXT(num, reply);
+}
+
+// Same order as LedLayerId and LedBlend
+const char* LED_LAYER_NAMES[] = {"base", "accent", "alert", "clap"};
+const char* LED_BLEND_NAMES[] = {"normal", "add", "screen", "multiply", "lighten", "keyed"};
+
+// "ledlayer:<layer>,<opacity 0-255>[,<blend>]", network-only like netpump
+void cmdLedLayer(uint8_t num, const char* arg, size_t argLen) {
+  const char* end = arg + argLen;
+  const char* comma = (const char*)memchr(arg, ',', argLen);
+  const char* blendArg = comma ? (const char*)memchr(comma + 1, ',', end - comma - 1) : nullptr;
+  const char* opacityEnd = blendArg ? blendArg : end;
+
+  uint8_t id = LED_LAYERS;
+  for (uint8_t i = 0; comma && i < LED_LAYERS; i++) {
+    if (cmdMatches(LED_LAYER_NAMES[i], arg, comma - arg, true)) id = i;
+  }
+  int32_t opacity = -1;
+  if (comma) cmdParseInt(comma + 1, opacityEnd - comma - 1, opacity);
+  uint8_t blend = id < LED_LAYERS ? ledLayers[id].blend : (uint8_t)LED_BLENDS;
+  if (blendArg) {
+    blend = LED_BLENDS;
+    for (uint8_t i = 0; i < LED_BLENDS; i++) {
+      if (cmdMatches(LED_BLEND_NAMES[i], blendArg + 1, end - blendArg - 1, true)) blend = i;
+    }
+  }
+
+  if (opacity < 0 || opacity > 255 || !ledLayerConfigure(id, opacity, blend)) {
+    webSocket.sendTXT(num, "ledlayer_error");
     return;
   }
+  char reply[48];
+  snprintf(reply, sizeof(reply), "ledlayer_set:%s,%ld,%s", LED_LAYER_NAMES[id], (long)opacity, LED_BLEND_NAMES[blend]);
+  webSocket.sendTXT(num, reply);
+}
+
+void cmdCues(uint8_t num, const char* arg, size_t argLen) {
+  char reply[64] = "cues:";
+  ledCuesInfo(reply + 5, sizeof(reply) - 5);
+  webSocket.sendTXT(num, reply);
+}
+
+void cmdStreamStats(uint8_t num, const char* arg, size_t argLen) {
+  char reply[80] = "streamstats:";
+  pixelStreamStats(reply + 12, sizeof(reply) - 12);
+  webSocket.sendTXT(num, reply);
+}
+
+void cmdRangeStats(uint8_t num, const char* arg, size_t argLen) {
+  char stats[40];
+  ultrasonicStats(stats, sizeof(stats));
+  char reply[64];
+  snprintf(reply, sizeof(reply), "rangestats:%s,%d", stats, (int)lastDistanceCm);
+  webSocket.sendTXT(num, reply);
+}
 
-  if (buzzerTestStep < 6 && millis() - lastTestTime >= (buzzerTestStep > 0 ? delays[buzzerTestStep - 1] : 0)) {
-    if (!currentTone.active) {
-      playTone(tones[buzzerTestStep], durations[buzzerTestStep]);
-      buzzerTestStep++;
-      lastTestTime = millis();
+void cmdPcmStats(uint8_t num, const char* arg, size_t argLen) {
+  char reply[80] = "pcmstats:";
+  pcmStats(reply + 9, sizeof(reply) - 9);
+  webSocket.sendTXT(num, reply);
+}
+
+void cmdAudioStats(uint8_t num, const char* arg, size_t argLen) {
+  char reply[80] = "audiostats:";
+  audioStats(reply + 11, sizeof(reply) - 11);
+  webSocket.sendTXT(num, reply);
+}
+
+void cmdBeat(uint8_t num, const char* arg, size_t argLen) {
+  for (uint8_t mode = 0; mode < sizeof(BEAT_MODE_NAMES) / sizeof(BEAT_MODE_NAMES[0]); mode++) {
+    if (cmdMatches(BEAT_MODE_NAMES[mode], arg, argLen, true)) {
+      beatMode = mode;
+      char reply[24];
+      snprintf(reply, sizeof(reply), "beat_set:%s", BEAT_MODE_NAMES[mode]);
+      webSocket.sendTXT(num, reply);
+      return;
     }
-  } else if (buzzerTestStep >= 6) {
-    buzzerTestStep = 0;
   }
+  webSocket.sendTXT(num, "beat_error");
 }
 
-// === OPTIMIZED LCD UPDATE FUNCTIONS ===
-void updateLcdScreenFast() {
-  if (millis() - lastLcdUpdate < 50) return;
-  lcd.clear();
-  switch (lcdState) {
-    case PLAYING:
-      lcd.setCursor(0, 0);
-      lcd.print(currentSong.substring(0, 16));
-      lcd.setCursor(0, 1);
-      lcd.print(obstacleDetected ? "OBSTACLE!" : "Playing");
-      break;
-    case PAUSED:
-      lcd.setCursor(0, 0);
-      lcd.print(currentSong.substring(0, 16));
-      lcd.setCursor(0, 1);
-      lcd.print("Paused");
-      break;
-    case STOPPED:
-      lcd.setCursor(0, 0);
-      lcd.print("Robot Ready");
-      lcd.setCursor(0, 1);
-      lcd.print("Clap to dance!");
-      break;
-    case INIT:
-      lcd.setCursor(0, 0);
-      lcd.print("IP Address:");
-      lcd.setCursor(0, 1);
-      lcd.print(WiFi.localIP().toString());
-      break;
+void cmdBeatStats(uint8_t num, const char* arg, size_t argLen) {
+  char reply[80] = "beatstats:";
+  beatStats(reply + 10, sizeof(reply) - 10);
+  webSocket.sendTXT(num, reply);
+}
+
+void cmdMelody(uint8_t num, const char* arg, size_t argLen) {
+  for (uint8_t id = 0; id < MELODY_COUNT; id++) {
+    if (cmdMatches(MELODIES[id].name, arg, argLen, true)) {
+      char reply[32];
+      snprintf(reply, sizeof(reply), melodyPlay(MELODIES[id]) ? "melody_playing:%s" : "melody_dropped:%s",
+               MELODIES[id].name);
+      webSocket.sendTXT(num, reply);
+      return;
+    }
   }
-  lastLcdUpdate = millis();
+  webSocket.sendTXT(num, "melody_error");
 }
 
-// === SONG-SPECIFIC STEP EXECUTION ===
-void executeDanceStep() {
-  if (shouldAbort() || danceState == DANCE_IDLE) {
-    danceState = DANCE_IDLE;
+void cmdMelodyStats(uint8_t num, const char* arg, size_t argLen) {
+  char reply[48] = "melodystats:";
+  melodyStats(reply + 12, sizeof(reply) - 12);
+  webSocket.sendTXT(num, reply);
+}
+
+void cmdNetStats(uint8_t num, const char* arg, size_t argLen) {
+  char reply[64] = "netstats:";
+  netPumpStats(reply + 9, sizeof(reply) - 9);
+  webSocket.sendTXT(num, reply);
+}
+
+// "show:record|stop|play|arm|disarm|info"; the first four go through the queue (runShowCommand)
+void cmdShow(uint8_t num, const char* arg, size_t argLen) {
+  static const char* const ACTIONS[] = {"record", "stop", "play", "info"};  // ShowAction order
+  if (!showFsReady) {
+    webSocket.sendTXT(num, "show_error:no_fs");
+    return;
+  }
+  for (uint8_t action = 0; action < sizeof(ACTIONS) / sizeof(ACTIONS[0]); action++) {
+    if (cmdMatches(ACTIONS[action], arg, argLen, true)) {
+      RbCommand cmd = {RB_OP_SHOW, action, 0, nullptr, 0};
+      queueTextCommand(num, cmd, nullptr, "show_error:busy");
+      return;
+    }
+  }
+  if (cmdMatches("arm", arg, argLen, true)) {
+    showClapArmed = true;
+    webSocket.sendTXT(num, "show_armed");
+  } else if (cmdMatches("disarm", arg, argLen, true)) {
+    showClapArmed = false;
+    webSocket.sendTXT(num, "show_disarmed");
+  } else {
+    queueErrorSound();
+    webSocket.sendTXT(num, "show_error");
+  }
+}
+
+const CommandEntry COMMAND_TABLE[] = {
+  CMD_ENTRY("pause", cmdPause),
+  CMD_ENTRY("stop", cmdStop),
+  CMD_ENTRY("resume", cmdResume),
+  CMD_ENTRY("heartbeat", cmdHeartbeat),
+  CMD_ENTRY("song", cmdSong),
+  CMD_ENTRY("speed", cmdSpeed),
+  CMD_ENTRY("led", cmdLed),
+  CMD_ENTRY("brightness", cmdBrightness),
+  CMD_ENTRY("tempo", cmdTempo),
+  CMD_ENTRY("energy", cmdEnergy),
+  CMD_ENTRY("telemetry", cmdTelemetry),
+  CMD_ENTRY("stepqueue", cmdStepQueue),
+  CMD_ENTRY("steppolicy", cmdStepPolicy),
+  CMD_ENTRY("netpump", cmdNetPump),
+  CMD_ENTRY("netstats", cmdNetStats),
+  CMD_ENTRY("ledstats", cmdLedStats),
+  CMD_ENTRY("ledlayer", cmdLedLayer),
+  CMD_ENTRY("cues", cmdCues),
+  CMD_ENTRY("streamstats", cmdStreamStats),
+  CMD_ENTRY("audiostats", cmdAudioStats),
+  CMD_ENTRY("beat", cmdBeat),
+  CMD_ENTRY("beatstats", cmdBeatStats),
+  CMD_ENTRY("melody", cmdMelody),
+  CMD_ENTRY("melodystats", cmdMelodyStats),
+  CMD_ENTRY("pcmstats", cmdPcmStats),
+  CMD_ENTRY("rangestats", cmdRangeStats),
+  CMD_ENTRY("show", cmdShow)
+};
+
+// Bare numbers are dance steps, everything else goes through the verb table
+void handleTextCommand(uint8_t num, const char* msg, size_t len) {
+  int32_t stepNumber;
+  if (cmdParseInt(msg, len, stepNumber) && stepNumber >= 1 && stepNumber <= 26) {
+    runTextCommand(num, RB_OP_STEP, stepNumber, nullptr);
     return;
   }
+  if (cmdDispatch(COMMAND_TABLE, sizeof(COMMAND_TABLE) / sizeof(COMMAND_TABLE[0]), num, msg, len)) return;
 
-  if (millis() - danceStepStartTime < 10) return;
+  queueErrorSound();
+  webSocket.sendTXT(num, "unknown_command");
+  Serial.print("Unknown command received: ");
+  Serial.write((const uint8_t*)msg, len);
+  Serial.println();
+}
+
+// === BINARY PROTOCOL ===
+void sendHello(uint8_t num) {
+  uint8_t frame[16];
+  webSocket.sendBIN(num, frame, rbWriteHello(frame));
+}
+
+// Commands the callback answers itself; everything else goes through the queue
+bool isNetworkCommand(uint8_t op) {
+  return op == RB_OP_PING || op == RB_OP_HELLO;
+}
 
-  if (danceState == DANCE_EXECUTING_STEP) {
-    if (currentSong == "Falling For You") {
-      executeFallingStep(currentDanceStep);
-    } else if (currentSong == "Stereo Love") {
-      executeStereoStep(currentDanceStep);
-    } else if (currentSong == "Faded") {
-      executeFadedStep(currentDanceStep);
-    } else if (currentSong == "Alone") {
-      executeAloneStep(currentDanceStep);
-    } else if (currentSong == "Mastie Mashup") {
-      executeNeuralStep(currentDanceStep);
+// Validate the whole frame, answer PING/HELLO/AT straight away and queue the rest
+// in order. The frame is queued whole or not at all; its ACK goes out once the
+// last queued command has run (or right away if nothing was queued).
+void handleBinaryCommands(uint8_t num, const uint8_t* frame, size_t len) {
+  uint64_t receivedUs = robotClockUs();
+  if (len < RB_HEADER_SIZE || frame[1] != RB_PROTO_VERSION) {
+    sendFrameAck(num, 0, 0, RB_STATUS_BAD_VERSION);
+    queueErrorSound();
+    return;
+  }
+  uint16_t seq = frame[2] | (frame[3] << 8);
+  const uint8_t* end = frame + len;
+
+  // First pass: decode everything and check there is room
+  uint8_t status = len > RB_MAX_FRAME ? RB_STATUS_MALFORMED : RB_STATUS_OK;
+  uint8_t queued = 0;
+  uint8_t immediate = 0;
+  uint8_t atCount = 0;
+  uint8_t prio = CMDQ_PRIO_NORMAL;
+  bool scheduled = false;
+  for (const uint8_t* p = frame + RB_HEADER_SIZE; status == RB_STATUS_OK && p < end;) {
+    RbCommand cmd;
+    if (!rbDecodeCommand(p, end, cmd)) {
+      status = RB_STATUS_MALFORMED;
+    } else if (scheduled) {
+      scheduled = false;
+      if (cmd.op == RB_OP_AT || isNetworkCommand(cmd.op)) status = RB_STATUS_REJECTED;
+      immediate++;
+    } else if (cmd.op == RB_OP_AT) {
+      scheduled = true;
+      atCount++;
+      immediate++;
+    } else if (isNetworkCommand(cmd.op)) {
+      immediate++;
     } else {
-      executeOtherStep(currentDanceStep);
+      queued++;
+      prio = max(prio, cmdqPriorityFor(cmd.op));
     }
-    danceState = DANCE_RESETTING;
-    danceStepStartTime = millis();
-  } else if (danceState == DANCE_RESETTING) {
-    if (millis() - danceStepStartTime >= 200) {
-      resetAllServos();
-      danceState = DANCE_IDLE;
-      Serial.println("Dance step complete, servos reset");
+  }
+  if (status == RB_STATUS_OK && scheduled) status = RB_STATUS_MALFORMED;  // AT with nothing after it
+  uint8_t barrier = (queued && prio == CMDQ_PRIO_NORMAL && cmdqSettersPending()) ? 1 : 0;
+  if (status == RB_STATUS_OK && (atCount > SCHED_QUEUE_SIZE - schedCount || queued + barrier > cmdqFree(prio))) {
+    status = RB_STATUS_QUEUE_FULL;
+  }
+  if (status != RB_STATUS_OK) {
+    sendFrameAck(num, seq, 0, status);
+    queueErrorSound();
+    Serial.printf("Binary frame %u refused (status %u)\n", seq, status);
+    return;
+  }
+  if (prio == CMDQ_PRIO_URGENT) {
+    preemptForUrgent();  // The whole frame goes urgent with its pause/stop
+  }
+  if (barrier) queueSetterBarrier();
+
+  // Second pass: act
+  QueuedCommand entry = {};
+  entry.client = num;
+  entry.frameSeq = seq;
+  entry.frameImmediate = immediate;
+  uint8_t pushed = 0;
+  scheduled = false;
+  uint64_t executeAt = 0;
+  for (const uint8_t* p = frame + RB_HEADER_SIZE; p < end;) {
+    RbCommand cmd;
+    rbDecodeCommand(p, end, cmd);
+    if (scheduled) {
+      scheduled = false;
+      scheduleCommand(cmd, executeAt);
+    } else if (cmd.op == RB_OP_AT) {
+      scheduled = true;
+      executeAt = cmd.time;
+    } else if (cmd.op == RB_OP_PING) {
+      uint8_t pong[24];
+      webSocket.sendBIN(num, pong, rbWritePong(pong, cmd.value, receivedUs, robotClockUs()));
+    } else if (cmd.op == RB_OP_HELLO) {
+      sendHello(num);
+    } else {
+      entry.cmd = cmd;
+      entry.flags = CMDQ_BINARY | (pushed == 0 ? CMDQ_FRAME_START : 0) | (pushed + 1 == queued ? CMDQ_FRAME_END : 0);
+      cmdqPush(prio, entry);  // Room was checked above
+      pushed++;
+    }
+  }
+  if (queued == 0) sendFrameAck(num, seq, immediate, RB_STATUS_OK);
+}
+
+// === TELEMETRY ===
+void sendTelemetry() {
+  if (!telemetryDue() || webSocket.connectedClients() == 0) return;
+
+  TelemetrySnapshot snap;
+  snap.timeUs = robotClockUs();
+  for (int i = 0; i < 12; i++) snap.angles[i] = currentServoAngles[i];
+  snap.step = currentDanceStep;
+  snap.keyframe = choreo.active ? choreo.keyframe : 0;
+  snap.distanceMm = constrain(lastDistanceCm * 10, 0, 65535);
+  snap.loopUs = lastLoopUs;
+  snap.loopMaxUs = maxLoopUs;
+  snap.cpgTickUs = min(cpgTickCostUs, 65535UL);
+  snap.schedLateUs = schedLastLateUs;
+  snap.freeHeap = ESP.getFreeHeap();
+  snap.seqSlot = seqTopSlot();
+  snap.flags = (isDancing ? TELEMETRY_DANCING : 0) | (gPaused ? TELEMETRY_PAUSED : 0) |
+               (obstacleDetected ? TELEMETRY_OBSTACLE : 0) | (clapMovementInProgress ? TELEMETRY_CLAP : 0) |
+               (choreo.active ? TELEMETRY_TRACK : 0) | (cpgActive ? TELEMETRY_CPG : 0) |
+               (vm.running ? TELEMETRY_VM : 0);
+  maxLoopUs = 0;
+
+  uint8_t frame[TELEMETRY_FRAME_SIZE];
+  size_t len = rbWriteTelemetry(frame, snap);
+  unsigned long sendStart = micros();
+  bool ok = webSocket.broadcastBIN(frame, len);
+  telemetrySent(ok, micros() - sendStart);
+}
+
+// Fire AT-scheduled commands whose time has come
+void runDueCommands() {
+  RbCommand cmd;
+  while (nextDueCommand(robotClockUs(), cmd)) {
+    if (!executeCommand(cmd)) {
+      Serial.printf("Scheduled command %u rejected\n", cmd.op);
     }
   }
 }
 
 // === ULTRA-FAST WEBSOCKET EVENT HANDLER ===
 void handleWebSocketEvent(uint8_t num, WStype_t type, uint8_t* payload, size_t length) {
+  netPumpEvents++;
   switch (type) {
     case WStype_DISCONNECTED:
       Serial.printf("[%u] Disconnected!\n", num);
       webSocketConnected = false;
+      if (webSocket.connectedClients() == 0) telemetrySetRate(0);
       break;
     case WStype_CONNECTED:
       {
@@ -1196,106 +1969,37 @@ void handleWebSocketEvent(uint8_t num, WStype_t type, uint8_t* payload, size_t l
         Serial.printf("[%u] Connected from %d.%d.%d.%d\n", num, ip[0], ip[1], ip[2], ip[3]);
         webSocketConnected = true;
         webSocket.sendTXT(num, "connected");
+        sendHello(num);
       }
       break;
-    case WStype_TEXT:
+    case WStype_BIN:
+      if (length > 0 && payload[0] == PCM_MAGIC) {
+        // A new stream is refused while paused, like a bytecode dance
+        bool starts = length > 1 && (payload[1] & PCM_FLAG_START);
+        if ((gPaused && starts) || !pcmReceive(payload, length)) webSocket.sendTXT(num, "pcm_error");
+        break;
+      }
+      if (length > 0 && payload[0] == RB_PROTO_MAGIC) {
+        handleBinaryCommands(num, payload, length);
+        break;
+      }
       {
-        String message = String((char*)payload).substring(0, length);
-        if (message == "pause") {
-          webSocket.sendTXT(num, "paused_ack");
-          pauseImmediate();
-          playPauseSound();
-          Serial.println("⚡ IMMEDIATE PAUSE EXECUTED");
-          return;
-        }
-        if (message == "stop") {
-          webSocket.sendTXT(num, "stopped_ack");
-          stopImmediate();
-          playStopSound();
-          Serial.println("⚡ IMMEDIATE STOP EXECUTED");
-          return;
-        }
-        if (message == "resume") {
-          webSocket.sendTXT(num, "resumed_ack");
-          resumeFromPause();
-          playResumeSound();
-          Serial.println("⚡ IMMEDIATE RESUME EXECUTED");
-          return;
-        }
-        if (message == "heartbeat") {
+        // Bytecode dance: staged here, swapped in and started when its run command executes
+        const char* error = gPaused ? "paused" : showState == SHOW_RECORDING ? "recording a show" : vmStage(payload, length);
+        if (error) {
+          webSocket.sendTXT(num, "vm_error");
+          Serial.print("Bytecode rejected: ");
+          Serial.println(error);
           return;
         }
-        if (message.toInt() >= 1 && message.toInt() <= 26) {
-          currentDanceStep = message.toInt();
-          playStepSound(currentDanceStep);
-          danceState = DANCE_EXECUTING_STEP;
-          danceStepStartTime = millis();
-        } else if (message.startsWith("song:")) {
-          webSocket.sendTXT(num, "song_started");
-          currentSong = message.substring(5);
-          gAbortAll = false;
-          isDancing = true;
-          lcdState = PLAYING;
-          setMotorSpeed(danceSpeed);
-          setLedPattern(LED_DANCE);
-          playDanceSound();
-          Serial.println("Song started: " + currentSong);
-        } else if (message.startsWith("speed:")) {
-          int newSpeed = message.substring(6).toInt();
-          if (newSpeed >= 0 && newSpeed <= 255) {
-            changeSpeedGradually(newSpeed);
-            webSocket.sendTXT(num, "speed_changed");
-            Serial.print("Speed changed to: ");
-            Serial.println(newSpeed);
-          } else {
-            webSocket.sendTXT(num, "speed_error");
-            playErrorSound();
-          }
-        } else if (message.startsWith("led:")) {
-          String ledCommand = message.substring(4);
-          ledCommand.toLowerCase();
-          if (ledCommand == "off") {
-            setLedPattern(LED_OFF);
-          } else if (ledCommand == "rainbow") {
-            setLedPattern(LED_RAINBOW);
-          } else if (ledCommand == "pulse") {
-            setLedPattern(LED_PULSE);
-          } else if (ledCommand == "chase") {
-            setLedPattern(LED_CHASE);
-          } else if (ledCommand == "strobe") {
-            setLedPattern(LED_STROBE);
-          } else if (ledCommand == "fire") {
-            setLedPattern(LED_FIRE);
-          } else if (ledCommand == "dance") {
-            setLedPattern(LED_DANCE);
-          } else if (ledCommand == "breathing") {
-            setLedPattern(LED_BREATHING);
-          } else if (ledCommand == "wave") {
-            setLedPattern(LED_WAVE);
-          } else {
-            playErrorSound();
-            webSocket.sendTXT(num, "led_error");
-            Serial.println("Unknown LED pattern");
-          }
-        } else if (message.startsWith("brightness:")) {
-          int newBrightness = message.substring(11).toInt();
-          if (newBrightness >= 0 && newBrightness <= 255) {
-            ledBrightness = newBrightness;
-            FastLED.setBrightness(ledBrightness);
-            webSocket.sendTXT(num, "brightness_changed");
-            Serial.print("LED brightness changed to: ");
-            Serial.println(newBrightness);
-          } else {
-            playErrorSound();
-            webSocket.sendTXT(num, "brightness_error");
-          }
-        } else {
-          playErrorSound();
-          webSocket.sendTXT(num, "unknown_command");
-          Serial.println("Unknown command received: " + message);
-        }
+        RbCommand run = {RB_OP_RUN_BYTECODE, 0, 0, nullptr, 0};
+        queueTextCommand(num, run, "vm_loaded", "vm_error");
+        Serial.printf("Bytecode dance staged: %u bytes\n", (unsigned)length);
       }
       break;
+    case WStype_TEXT:
+      handleTextCommand(num, (const char*)payload, length);
+      break;
     case WStype_ERROR:
       Serial.printf("[%u] WebSocket Error: %s\n", num, payload);
       break;
@@ -1304,9 +2008,27 @@ void handleWebSocketEvent(uint8_t num, WStype_t type, uint8_t* payload, size_t l
   }
 }
 
+// === BOOT SEQUENCE ===
+// Servo positions are unknown at power-on, so write every channel once
+void writeHomePose() {
+  for (int i = 0; i < 12; i++) {
+    pwmWriteAngle(i, servoHome[i]);
+  }
+  pwmWriteAngle(MOTOR_CH15, 45);
+  motorCurrentAngle = 45;
+}
+
+const SeqStep BOOT_SEQUENCE[] = {
+  {SEQ_CALL, 0, 0, 0, playStartupSound},
+  {SEQ_CALL, 0, 0, 0, writeHomePose},
+  {SEQ_WAIT, 0, 0, 500},  // Let the servos settle before anything else takes them
+  {SEQ_END}
+};
+
 // === SETUP WITH OPTIMIZATIONS ===
 void setup() {
   Serial.begin(115200);
+  currentSong.reserve(SONG_NAME_MAX);
   delay(1000); // Brief delay for serial stability
   Serial.println("=== RythmoBot with Ultra-Fast WebSocket Response Starting ===");
 
@@ -1316,9 +2038,14 @@ void setup() {
   pinMode(IN3, OUTPUT);
   pinMode(IN4, OUTPUT);
   pinMode(BUZZER_PIN, OUTPUT);
-  pinMode(TRIG_PIN, OUTPUT);
-  pinMode(ECHO_PIN, INPUT);
+  pcmBegin(BUZZER_PIN);
+  ultrasonicBegin(TRIG_PIN, ECHO_PIN);
   pinMode(SOUND_SENSOR_PIN, INPUT);
+#if SOUND_SENSOR_ANALOG
+  beatTrackerBegin();
+  Serial.println(audioBegin(SOUND_SENSOR_PIN) ? "Audio sampling started on the sound sensor"
+                                              : "Audio sampling failed, clap from the digital pin");
+#endif
 
   // Setup PWM channels for motor speed control
   setupPWMChannels();
@@ -1326,6 +2053,9 @@ void setup() {
   // Setup LED strips
   setupLEDs();
 
+  // Show log storage (formats the partition on first boot)
+  Serial.println(showBegin() ? "LittleFS mounted for show recording" : "LittleFS mount failed, show recording disabled");
+
   stopBase();
 
   // Initialize hardware
@@ -1335,8 +2065,9 @@ void setup() {
   lcd.init();
   lcd.backlight();
 
-  // Play startup sound
-  playStartupSound();
+  // Boot sequence: startup sound, then servos home
+  cpgSetTempo(cpgTempo);
+  seqStart(SEQ_PRIO_SYSTEM, BOOT_SEQUENCE, "boot");
 
   lcd.clear();
   lcd.setCursor(0, 0);
@@ -1349,7 +2080,13 @@ void setup() {
   WiFi.begin(ssid, password);
   int wifiRetries = 0;
   while (WiFi.status() != WL_CONNECTED && wifiRetries < 20) {
-    delay(500);
+    unsigned long waitStart = millis();
+    while (millis() - waitStart < 500) {  // Keep the boot sequence running
+      updateSequencer();
+      updateLEDs();
+      updateBuzzer();
+      yield();
+    }
     Serial.print(".");
     wifiRetries++;
   }
@@ -1359,19 +2096,17 @@ void setup() {
     Serial.print("IP Address: ");
     Serial.println(WiFi.localIP());
     optimizeWiFi();
-    playWifiConnectedSound();
-    setLedPattern(LED_WIFI_SUCCESS);
-    wifiPatternStartTime = millis();
-    wifiPatternCompleted = false;
+    seqStart(SEQ_PRIO_AMBIENT, WIFI_SEQUENCE, "wifi celebration");
     lcdState = INIT;
     updateLcdScreenFast();
     webSocket.begin();
     webSocket.onEvent(handleWebSocketEvent);
     webSocket.enableHeartbeat(1000, 3000, 2);
+    pixelStreamBegin(ledLayers[LED_LAYER_BASE].pixels, NUM_LEDS);
     Serial.println("WebSocket server started with ultra-fast response optimizations.");
   } else {
     Serial.println("\n❌ WiFi connection failed!");
-    playErrorSound();
+    playMelody(MELODY_ERROR);
     lcd.clear();
     lcd.setCursor(0, 0);
     lcd.print("WiFi Failed!");
@@ -1379,19 +2114,28 @@ void setup() {
     lcd.print("Check credentials");
   }
 
-  // Initialize servos
-  resetAllServos();
-  pwmWriteAngle(MOTOR_CH15, 45);
-  motorCurrentAngle = 45;
-
   Serial.println("=== RythmoBot Setup Complete with Ultra-Fast WebSocket Response ===");
 }
 
 // === ULTRA-OPTIMIZED MAIN LOOP ===
 void loop() {
   while (true) {
+    unsigned long nowUs = micros();
+    if (loopStartUs != 0) {
+      lastLoopUs = nowUs - loopStartUs;
+      if (lastLoopUs > maxLoopUs) maxLoopUs = lastLoopUs;
+    }
+    loopStartUs = nowUs;
+
     // HIGHEST PRIORITY: WebSocket handling
-    webSocket.loop();
+    pumpNetwork();
+    drainCommandQueue();  // Act on what the callback queued
+    if (showPoll()) finishShowReplay();
+    ledCuesPoll(cpgTempo);
+    pixelStreamPoll();
+    audioPoll();
+    pcmPoll();
+    updateBeatFollow();
 
     // Send heartbeat
     // if (millis() - lastKeepAlive >= KEEP_ALIVE_INTERVAL) {
@@ -1408,7 +2152,6 @@ void loop() {
 
     // Update tasks
     updateLEDs();
-    handleWifiLedPatternCompletion();
     updateBuzzer();
 
     if (isDancing && !obstacleDetected && !clapMovementInProgress && !shouldAbort()) {
@@ -1421,13 +2164,8 @@ void loop() {
       handleMotorCH15();
     }
 
-    if (clapMovementInProgress) {
-      executeClapResponseStep();
-    }
-
-    if (danceState != DANCE_IDLE) {
-      executeDanceStep();
-    }
+    runDueCommands();  // AT-scheduled commands start on the same pass as the sequencer
+    updateSequencer();
 
     updateLcdScreenFast();
 
@@ -1444,6 +2182,8 @@ void loop() {
       lastAnimationTime = millis();
     }
 
+    sendTelemetry();
+
     yield();
   }
 }
@@ -1506,6 +2246,15 @@ void stopBase() {
   digitalWrite(IN4, LOW);
 }
 
+// Drive IN1..IN4 from bits 0-3 (keyframe base channel); obstacles still win
+void setBasePins(uint8_t pins) {
+  if (obstacleDetected || shouldAbort()) pins = 0;
+  digitalWrite(IN1, (pins & 0x01) ? HIGH : LOW);
+  digitalWrite(IN2, (pins & 0x02) ? HIGH : LOW);
+  digitalWrite(IN3, (pins & 0x04) ? HIGH : LOW);
+  digitalWrite(IN4, (pins & 0x08) ? HIGH : LOW);
+}
+
 void handleBaseMovement() {
   if (!isDancing || obstacleDetected || clapMovementInProgress || shouldAbort()) return;
   if (millis() - lastBaseMovement >= baseMovementInterval) {
@@ -1554,7 +2303,9 @@ void smoothMove(uint8_t channel, int toAngle, int delayMs) {
     }
     pwmWriteAngle(channel, newAngle);
     delay(delayMs);
-    webSocket.loop(); // Allow WebSocket processing during servo movement
+    pumpNetwork(); // Lets a pause/stop in while the servo moves
+    updateLEDs();  // Keeps the animation going; the strip is sent off the loop
+    checkForObstacles();  // Blocking steps still stop the base for an obstacle
   }
 }
 
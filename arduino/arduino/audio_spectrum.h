@@ -0,0 +1,339 @@
+/*
+ * =========================================================
+ * AUDIO SPECTRUM - DMA ADC SAMPLING, FIXED-POINT FFT, BANDS
+ * =========================================================
+ * The sound sensor's analog output is sampled continuously by
+ * the ADC's DMA (the IDF adc_continuous driver, I2S0 on the
+ * ESP32) into its own ring of DMA buffers. A task on core 0,
+ * away from loop(), sleeps until a DMA frame is done: pairs of
+ * 20 kHz samples are averaged down to 10 kHz, and every
+ * AUDIO_FFT_N samples one frame is analysed:
+ *
+ *   remove DC -> Hann window -> Q15 radix-2 FFT (scaled by 1/N
+ *   per stage, no overflow) -> |X| by alpha-max-beta-min ->
+ *   AUDIO_BANDS log-spaced bands -> log2 levels 0-255 against a
+ *   slowly decaying peak (auto gain), fast attack, slow release
+ *
+ * 256 points at 10 kHz: 39 Hz bins, a new frame every 25.6 ms.
+ * The kernels take buffers and sizes explicitly, so
+ * tools/bench_fft.cpp times them on the host. After each frame
+ * audioFrameAnalysed() runs on the same task (beat tracking).
+ *
+ * When the ADC samples the clap pin, a frame whose peak-to-peak
+ * swing passes AUDIO_CLAP_PTP counts as loud (what the module's
+ * comparator did on its digital output).
+ *
+ * Without the IDF (the host twin), loop() calls audioPoll() and
+ * samples come from analogRead() as the clock advances.
+ * =========================================================
+ */
+
+#ifndef AUDIO_SPECTRUM_H
+#define AUDIO_SPECTRUM_H
+
+// Include required libraries
+#include <Arduino.h>
+#include <math.h>
+#ifdef ESP32
+#include "esp_adc/adc_continuous.h"
+#endif
+
+#define AUDIO_FFT_N 256
+#define AUDIO_FFT_LOG2N 8
+#define AUDIO_ADC_HZ 20000          // Lowest rate the ESP32 ADC DMA runs at
+#define AUDIO_DECIMATE 2
+#define AUDIO_SAMPLE_HZ (AUDIO_ADC_HZ / AUDIO_DECIMATE)
+#define AUDIO_BANDS 8
+#define AUDIO_DMA_FRAME_BYTES 256   // 128 conversions per DMA frame
+#define AUDIO_DMA_POOL_BYTES 2048   // ~50 ms of samples buffered by the driver
+#define AUDIO_FRAME_US (AUDIO_FFT_N * 1000000UL / AUDIO_SAMPLE_HZ)
+#define AUDIO_TASK_STACK 4096
+#define AUDIO_TASK_PRIORITY 1       // Below WiFi on the same core, sleeps on the DMA
+#define AUDIO_TASK_CORE 0           // loop() owns core 1
+#define AUDIO_READ_TIMEOUT_MS 50
+#define AUDIO_POOL_SAMPLES (AUDIO_DMA_POOL_BYTES / 2 / AUDIO_DECIMATE)
+#define AUDIO_RANGE_Q4 (6 * 16)     // Levels span 6 octaves (36 dB) below the peak
+#define AUDIO_GATE_Q4 (7 * 16)      // Band energy under 2^7 is sensor noise and reads 0
+#define AUDIO_PEAK_MIN_Q4 (AUDIO_GATE_Q4 + 3 * 16)
+#define AUDIO_RELEASE 12            // Level units a band falls per frame
+#define AUDIO_CLAP_PTP 2000         // Peak-to-peak ADC counts of a clap, about half the range
+
+// External function declarations (these will be defined in the main file)
+extern void audioFrameAnalysed(uint32_t frameEndUs);  // Runs on the audio task
+
+// Upper FFT bin (exclusive) of each band; bin 0 (DC) is skipped
+const uint16_t AUDIO_BAND_EDGES[AUDIO_BANDS + 1] = {1, 2, 4, 7, 12, 20, 34, 60, 128};
+
+// === KERNELS ===
+// Twiddles for an n-point FFT: cos/sin of 2*pi*k/n for k < n/2, Q15
+void audioFftTables(int16_t* cosTable, int16_t* sinTable, uint16_t n) {
+  for (uint16_t k = 0; k < n / 2; k++) {
+    cosTable[k] = (int16_t)lroundf(32767.0f * cosf(2.0f * (float)M_PI * k / n));
+    sinTable[k] = (int16_t)lroundf(32767.0f * sinf(2.0f * (float)M_PI * k / n));
+  }
+}
+
+void audioHannTable(int16_t* window, uint16_t n) {
+  for (uint16_t i = 0; i < n; i++) {
+    window[i] = (int16_t)lroundf(32767.0f * 0.5f * (1.0f - cosf(2.0f * (float)M_PI * i / (n - 1))));
+  }
+}
+
+// In-place forward FFT, result scaled by 1/n; tables from audioFftTables(tableN), tableN >= n
+void audioFftQ15(int16_t* re, int16_t* im, uint16_t n, const int16_t* cosTable, const int16_t* sinTable,
+                 uint16_t tableN) {
+  for (uint16_t i = 1, j = 0; i < n; i++) {
+    uint16_t bit = n >> 1;
+    for (; j & bit; bit >>= 1) j ^= bit;
+    j ^= bit;
+    if (i < j) {
+      int16_t t = re[i];
+      re[i] = re[j];
+      re[j] = t;
+      t = im[i];
+      im[i] = im[j];
+      im[j] = t;
+    }
+  }
+  for (uint16_t len = 2; len <= n; len <<= 1) {
+    uint16_t half = len >> 1;
+    uint16_t stride = tableN / len;
+    for (uint16_t start = 0; start < n; start += len) {
+      for (uint16_t k = 0; k < half; k++) {
+        int32_t wr = cosTable[k * stride];
+        int32_t wi = -sinTable[k * stride];
+        uint16_t a = start + k;
+        uint16_t b = a + half;
+        int32_t tr = (wr * re[b] - wi * im[b]) >> 15;
+        int32_t ti = (wr * im[b] + wi * re[b]) >> 15;
+        re[b] = (re[a] - tr) >> 1;
+        im[b] = (im[a] - ti) >> 1;
+        re[a] = (re[a] + tr) >> 1;
+        im[a] = (im[a] + ti) >> 1;
+      }
+    }
+  }
+}
+
+// Sum of |X[k]| over each band, |X| ~ max + 3/8 min
+void audioBandEnergies(const int16_t* re, const int16_t* im, const uint16_t* edges, uint8_t bands, uint32_t* out) {
+  uint16_t k = edges[0];
+  for (uint8_t band = 0; band < bands; band++) {
+    uint32_t sum = 0;
+    for (; k < edges[band + 1]; k++) {
+      uint16_t x = abs(re[k]);
+      uint16_t y = abs(im[k]);
+      sum += x > y ? x + (y * 3 >> 3) : y + (x * 3 >> 3);
+    }
+    out[band] = sum;
+  }
+}
+
+// 16 * log2(x), 4 fraction bits from the bits below the leading one
+uint16_t audioLog2Q4(uint32_t x) {
+  if (x == 0) return 0;
+  uint8_t msb = 31 - __builtin_clz(x);
+  uint32_t frac = msb >= 4 ? (x >> (msb - 4)) & 0x0F : (x << (4 - msb)) & 0x0F;
+  return msb * 16 + frac;
+}
+
+// -- AUDIO STATE VARIABLES --
+int16_t audioCos[AUDIO_FFT_N / 2];
+int16_t audioSin[AUDIO_FFT_N / 2];
+int16_t audioWindow[AUDIO_FFT_N];
+int16_t audioRe[AUDIO_FFT_N];
+int16_t audioIm[AUDIO_FFT_N];
+uint16_t audioSamples[AUDIO_FFT_N];  // Raw 12-bit, filled by audioPushSample()
+uint16_t audioFill = 0;
+uint32_t audioFrameEndUs = 0;  // micros() of the last sample in audioSamples
+bool audioRunning = false;
+uint8_t audioPin = 0;
+
+uint8_t audioBandLevel[AUDIO_BANDS];  // 0-255, for the LED patterns
+uint16_t audioBandLog[AUDIO_BANDS];   // 16 * log2 of each band's energy in the last frame, unsmoothed
+uint8_t audioLevel = 0;               // Whole spectrum, 0-255
+bool audioLoud = false;               // Last frame swung more than AUDIO_CLAP_PTP
+uint16_t audioPeakQ4 = AUDIO_PEAK_MIN_Q4;
+
+// Counters
+uint32_t audioFrames = 0;
+uint32_t audioOverruns = 0;  // DMA pool filled before loop() drained it
+uint32_t audioLastFrameUs = 0;
+uint32_t audioMaxFrameUs = 0;
+
+uint8_t audioLevelFor(uint32_t energy) {
+  uint16_t l = audioLog2Q4(energy);
+  int floorQ4 = max(audioPeakQ4 - AUDIO_RANGE_Q4, AUDIO_GATE_Q4);
+  if (l <= floorQ4) return 0;
+  return min(255, (l - floorQ4) * 255 / (audioPeakQ4 - floorQ4));
+}
+
+void audioProcessFrame() {
+  unsigned long start = micros();
+  uint32_t sum = 0;
+  uint16_t lo = 4095, hi = 0;
+  for (uint16_t i = 0; i < AUDIO_FFT_N; i++) {
+    sum += audioSamples[i];
+    lo = min(lo, audioSamples[i]);
+    hi = max(hi, audioSamples[i]);
+  }
+  int16_t mean = sum / AUDIO_FFT_N;
+  for (uint16_t i = 0; i < AUDIO_FFT_N; i++) {
+    int32_t x = (audioSamples[i] - mean) * 8;  // +-2048 counts -> +-16384
+    audioRe[i] = (x * audioWindow[i]) >> 15;
+    audioIm[i] = 0;
+  }
+  audioFftQ15(audioRe, audioIm, AUDIO_FFT_N, audioCos, audioSin, AUDIO_FFT_N);
+
+  uint32_t energy[AUDIO_BANDS];
+  uint32_t total = 0;
+  audioBandEnergies(audioRe, audioIm, AUDIO_BAND_EDGES, AUDIO_BANDS, energy);
+  for (uint8_t band = 0; band < AUDIO_BANDS; band++) total += energy[band];
+
+  // Auto gain: the loudest band sets the top, falling 1/16 octave per frame
+  uint16_t loudest = 0;
+  for (uint8_t band = 0; band < AUDIO_BANDS; band++) {
+    audioBandLog[band] = audioLog2Q4(energy[band]);
+    loudest = max(loudest, audioBandLog[band]);
+  }
+  audioPeakQ4 = max((uint16_t)max(loudest, (uint16_t)(audioPeakQ4 - 1)), (uint16_t)AUDIO_PEAK_MIN_Q4);
+
+  for (uint8_t band = 0; band < AUDIO_BANDS; band++) {
+    uint8_t level = audioLevelFor(energy[band]);
+    uint8_t old = audioBandLevel[band];
+    audioBandLevel[band] = level >= old ? level : old - min(old - level, AUDIO_RELEASE);
+  }
+  uint8_t level = audioLevelFor(total >> 2);
+  audioLevel = level >= audioLevel ? level : audioLevel - min(audioLevel - level, AUDIO_RELEASE);
+  audioLoud = hi - lo > AUDIO_CLAP_PTP;
+
+  audioFrames++;
+  audioLastFrameUs = micros() - start;
+  if (audioLastFrameUs > audioMaxFrameUs) audioMaxFrameUs = audioLastFrameUs;
+  audioFrameAnalysed(audioFrameEndUs);
+}
+
+void audioPushSample(uint16_t sample, uint32_t sampleUs) {
+  audioSamples[audioFill++] = sample;
+  if (audioFill == AUDIO_FFT_N) {
+    audioFill = 0;
+    audioFrameEndUs = sampleUs;
+    audioProcessFrame();
+  }
+}
+
+// Bass: the two lowest bands (39-156 Hz)
+uint8_t audioBass() {
+  return max(audioBandLevel[0], audioBandLevel[1]);
+}
+
+#ifdef ESP32
+adc_continuous_handle_t audioAdc = nullptr;
+adc_channel_t audioChannel;
+uint8_t audioDma[AUDIO_DMA_FRAME_BYTES];
+uint32_t audioPairSum = 0;
+uint8_t audioPairCount = 0;
+
+// Runs in the driver's ISR when the pool is full and the oldest frame is overwritten
+bool IRAM_ATTR audioPoolOverflow(adc_continuous_handle_t, const adc_continuous_evt_data_t*, void*) {
+  audioOverruns++;
+  return false;
+}
+
+TaskHandle_t audioTask = nullptr;
+
+// Sleeps until the DMA has a frame; the last sample read is the newest, taken about now
+void audioTaskLoop(void*) {
+  const uint32_t ADC_SAMPLE_US = 1000000UL / AUDIO_ADC_HZ;
+  for (;;) {
+    uint32_t got = 0;
+    if (adc_continuous_read(audioAdc, audioDma, sizeof(audioDma), &got, AUDIO_READ_TIMEOUT_MS) != ESP_OK) continue;
+    uint32_t readUs = micros();
+    uint32_t count = got / SOC_ADC_DIGI_RESULT_BYTES;
+    for (uint32_t i = 0; i < count; i++) {
+      const adc_digi_output_data_t* result = (const adc_digi_output_data_t*)&audioDma[i * SOC_ADC_DIGI_RESULT_BYTES];
+      if (result->type1.channel != audioChannel) continue;
+      audioPairSum += result->type1.data;
+      if (++audioPairCount == AUDIO_DECIMATE) {
+        audioPushSample(audioPairSum / AUDIO_DECIMATE, readUs - (count - 1 - i) * ADC_SAMPLE_US);
+        audioPairSum = 0;
+        audioPairCount = 0;
+      }
+    }
+  }
+}
+
+bool audioBegin(uint8_t pin) {
+  adc_unit_t unit;
+  if (adc_continuous_io_to_channel(pin, &unit, &audioChannel) != ESP_OK || unit != ADC_UNIT_1) return false;
+  adc_continuous_handle_cfg_t handleConfig = {};
+  handleConfig.max_store_buf_size = AUDIO_DMA_POOL_BYTES;
+  handleConfig.conv_frame_size = AUDIO_DMA_FRAME_BYTES;
+  if (adc_continuous_new_handle(&handleConfig, &audioAdc) != ESP_OK) return false;
+
+  adc_digi_pattern_config_t pattern = {};
+  pattern.atten = ADC_ATTEN_DB_12;
+  pattern.channel = audioChannel;
+  pattern.unit = ADC_UNIT_1;
+  pattern.bit_width = SOC_ADC_DIGI_MAX_BITWIDTH;
+  adc_continuous_config_t config = {};
+  config.pattern_num = 1;
+  config.adc_pattern = &pattern;
+  config.sample_freq_hz = AUDIO_ADC_HZ;
+  config.conv_mode = ADC_CONV_SINGLE_UNIT_1;
+  config.format = ADC_DIGI_OUTPUT_FORMAT_TYPE1;
+  adc_continuous_evt_cbs_t callbacks = {};
+  callbacks.on_pool_ovf = audioPoolOverflow;
+  audioFftTables(audioCos, audioSin, AUDIO_FFT_N);
+  audioHannTable(audioWindow, AUDIO_FFT_N);
+  audioPin = pin;
+  if (adc_continuous_config(audioAdc, &config) != ESP_OK ||
+      adc_continuous_register_event_callbacks(audioAdc, &callbacks, nullptr) != ESP_OK ||
+      adc_continuous_start(audioAdc) != ESP_OK) {
+    adc_continuous_deinit(audioAdc);
+    audioAdc = nullptr;
+    return false;
+  }
+  audioRunning = true;
+  xTaskCreatePinnedToCore(audioTaskLoop, "audio", AUDIO_TASK_STACK, nullptr, AUDIO_TASK_PRIORITY, &audioTask,
+                          AUDIO_TASK_CORE);
+  return true;
+}
+
+// Sampling and analysis run on the audio task
+void audioPoll() {}
+#else
+unsigned long audioNextSampleUs = 0;
+
+bool audioBegin(uint8_t pin) {
+  audioFftTables(audioCos, audioSin, AUDIO_FFT_N);
+  audioHannTable(audioWindow, AUDIO_FFT_N);
+  audioPin = pin;
+  audioNextSampleUs = micros();
+  audioRunning = true;
+  return true;
+}
+
+void audioPoll() {
+  if (!audioRunning) return;
+  unsigned long now = micros();
+  uint16_t taken = 0;
+  while ((long)(now - audioNextSampleUs) >= 0 && taken < AUDIO_POOL_SAMPLES) {
+    audioPushSample(analogRead(audioPin), audioNextSampleUs);
+    audioNextSampleUs += 1000000UL / AUDIO_SAMPLE_HZ;
+    taken++;
+  }
+  if (taken == AUDIO_POOL_SAMPLES) {
+    audioOverruns++;
+    audioNextSampleUs = now;  // More behind than the DMA pool holds: skip ahead
+  }
+}
+#endif
+
+// "frames,overruns,level,bass,lastFrameUs,maxFrameUs"
+void audioStats(char* out, size_t size) {
+  snprintf(out, size, "%lu,%lu,%u,%u,%lu,%lu", (unsigned long)audioFrames, (unsigned long)audioOverruns, audioLevel,
+           audioBass(), (unsigned long)audioLastFrameUs, (unsigned long)audioMaxFrameUs);
+}
+
+#endif
@@ -0,0 +1,278 @@
+/*
+ * =========================================================
+ * BEAT TRACKER - ONSETS, TEMPO AND A PHASE-LOCKED BEAT CLOCK
+ * =========================================================
+ * Follows live music from the audio frames of audio_spectrum.h
+ * (one every 25.6 ms), on the audio task, in three stages:
+ *
+ * 1. Onsets: spectral flux, the sum over the bands of each
+ *    rise in log energy since the last frame, minus its
+ *    running mean. The last BEAT_HISTORY frames are kept.
+ * 2. Tempo: autocorrelation of that history for 60-180 BPM,
+ *    each lag plus half its double (a two-tooth comb) and
+ *    weighted towards 120 BPM, so half and double tempo lose.
+ *    BEAT_LAGS_PER_FRAME lags are computed per frame, so a
+ *    frame costs the same whether or not a sweep completes.
+ * 3. Beat clock: the strongest onset near each predicted beat
+ *    pulls its phase and period (a PLL), and the period is
+ *    drawn towards the tempo estimate. Locked once most recent
+ *    beats had an onset and the tempo peak stands out.
+ *
+ * The tracker publishes the time of its last beat and the
+ * period. beatClockPoll() in loop() projects them forward, so
+ * beats fire on time rather than when the next frame arrives.
+ * The two are written on the audio task's core and read on the
+ * loop's, so they go through a sequence lock: loop() never
+ * pairs a new anchor with the old period.
+ * =========================================================
+ */
+
+#ifndef BEAT_TRACKER_H
+#define BEAT_TRACKER_H
+
+// Include required libraries
+#include <Arduino.h>
+#include <math.h>
+#include <atomic>
+#include "audio_spectrum.h"
+
+#define BEAT_FRAME_HZ ((float)AUDIO_SAMPLE_HZ / AUDIO_FFT_N)  // 39.06
+#define BEAT_HISTORY 256              // Onset frames kept, 6.6 s
+#define BEAT_MIN_LAG 13               // Frames per beat at 180 BPM
+#define BEAT_MAX_LAG 39               // 60 BPM
+#define BEAT_ACF_LAGS (2 * BEAT_MAX_LAG + 1)
+#define BEAT_LAGS_PER_FRAME 8         // A sweep of all lags every 9 frames
+#define BEAT_PRIOR_BPM 120.0f
+#define BEAT_PRIOR_OCTAVES 0.8f       // Width of the tempo preference
+#define BEAT_WINDOW 0.2f              // Onsets within 20% of a period of a predicted beat count for it
+#define BEAT_PHASE_GAIN 0.3f
+#define BEAT_PERIOD_GAIN 0.05f
+#define BEAT_TEMPO_PULL 0.1f          // Share of the gap to the tempo estimate closed per beat
+#define BEAT_ONSET_RATIO 1.0f         // An onset stands this far above the mean flux
+#define BEAT_LOCK_CONFIDENCE 0.25f
+#define BEAT_LOCK_HITS 5              // Of the last 8 predicted beats
+#define BEAT_SILENCE_FRAMES 80        // 2 s without an onset drops the lock
+
+// -- BEAT TRACKER STATE VARIABLES --
+float beatNovelty[BEAT_HISTORY];  // Ring, beatHead is the oldest
+uint16_t beatHead = 0;
+uint32_t beatFrame = 0;           // Frames tracked
+uint16_t beatPrevLog[AUDIO_BANDS];
+float beatFluxMean = 0;
+float beatAcf[BEAT_ACF_LAGS];
+float beatPrior[BEAT_MAX_LAG + 1];
+uint8_t beatSweep = 0;            // Next lag to compute: 0, then BEAT_MIN_LAG up
+float beatEstLag = 0;             // Tempo estimate in frames per beat, 0 = none yet
+uint8_t beatDisagree = 0;
+float beatConfidence = 0;
+
+// Phase-locked loop, in frames
+float beatPeriod = 0;
+float beatNext = 0;               // Frame of the next predicted beat
+float beatBest = 0;               // Strongest onset near it so far
+float beatBestAt = 0;
+uint8_t beatHits = 0;             // One bit per predicted beat, 1 = it had an onset
+uint16_t beatQuiet = 0;           // Frames since the last onset
+
+// Published to loop(); read the pair with beatReadClock()
+volatile bool beatLocked = false;
+std::atomic<uint32_t> beatClockSeq{0};        // Odd while the audio task writes the pair
+std::atomic<uint32_t> beatPeriodUs{500000};
+std::atomic<uint32_t> beatAnchorUs{0};        // micros() of a beat
+
+// Counters
+uint32_t beatOnsets = 0;
+uint32_t beatTrackUs = 0;
+uint32_t beatMaxTrackUs = 0;
+
+// Audio task side
+inline void beatPublishClock(uint32_t anchorUs, uint32_t periodUs) {
+  uint32_t seq = beatClockSeq.load(std::memory_order_relaxed);
+  beatClockSeq.store(seq + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  beatAnchorUs.store(anchorUs, std::memory_order_relaxed);
+  beatPeriodUs.store(periodUs, std::memory_order_relaxed);
+  beatClockSeq.store(seq + 2, std::memory_order_release);
+}
+
+// Loop side: an anchor and period from the same update; retries while one is being written
+inline void beatReadClock(uint32_t& anchorUs, uint32_t& periodUs) {
+  uint32_t seq;
+  do {
+    seq = beatClockSeq.load(std::memory_order_acquire);
+    anchorUs = beatAnchorUs.load(std::memory_order_relaxed);
+    periodUs = beatPeriodUs.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+  } while ((seq & 1) || seq != beatClockSeq.load(std::memory_order_relaxed));
+}
+
+void beatTrackerBegin() {
+  for (uint8_t lag = BEAT_MIN_LAG; lag <= BEAT_MAX_LAG; lag++) {
+    float octaves = log2f(60.0f * BEAT_FRAME_HZ / lag / BEAT_PRIOR_BPM) / BEAT_PRIOR_OCTAVES;
+    beatPrior[lag] = expf(-0.5f * octaves * octaves);
+  }
+}
+
+// Onset strength of a frame, 0 = oldest kept
+inline float beatHistoryAt(uint16_t age) {
+  return beatNovelty[(beatHead + age) % BEAT_HISTORY];
+}
+
+// Mean product of the history with itself shifted by lag frames
+float beatAutocorrelation(uint8_t lag) {
+  float sum = 0;
+  for (uint16_t i = lag; i < BEAT_HISTORY; i++) sum += beatHistoryAt(i) * beatHistoryAt(i - lag);
+  return sum / (BEAT_HISTORY - lag);
+}
+
+// After a full sweep: best lag with sub-frame interpolation, and how far it stands out
+void beatEstimateTempo() {
+  float mean = 0;
+  for (uint8_t lag = BEAT_MIN_LAG; lag <= BEAT_MAX_LAG; lag++) mean += beatAcf[lag];
+  mean /= BEAT_MAX_LAG - BEAT_MIN_LAG + 1;
+
+  float score[BEAT_MAX_LAG + 2] = {0};
+  uint8_t best = BEAT_MIN_LAG;
+  for (uint8_t lag = BEAT_MIN_LAG; lag <= BEAT_MAX_LAG; lag++) {
+    score[lag] = (max(beatAcf[lag] - mean, 0.0f) + 0.5f * max(beatAcf[2 * lag] - mean, 0.0f)) * beatPrior[lag];
+    if (score[lag] > score[best]) best = lag;
+  }
+  beatConfidence = beatAcf[0] > mean ? (beatAcf[best] - mean) / (beatAcf[0] - mean) : 0;
+  if (score[best] <= 0 || beatConfidence < BEAT_LOCK_CONFIDENCE / 2) return;
+
+  float lag = best;
+  if (best > BEAT_MIN_LAG && best < BEAT_MAX_LAG) {
+    float a = score[best - 1], b = score[best], c = score[best + 1];
+    float denom = a - 2 * b + c;
+    if (denom < 0) lag += 0.5f * (a - c) / denom;
+  }
+
+  if (beatEstLag == 0) {
+    // First estimate: start the clock on the strongest onset of the last beat
+    float strongest = -1;
+    uint16_t at = 0;
+    for (uint16_t age = BEAT_HISTORY - (uint16_t)lag; age < BEAT_HISTORY; age++) {
+      if (beatHistoryAt(age) > strongest) {
+        strongest = beatHistoryAt(age);
+        at = age;
+      }
+    }
+    beatEstLag = beatPeriod = lag;
+    beatNext = (float)beatFrame - (BEAT_HISTORY - 1 - at) + lag;  // The newest history entry is this frame
+    beatBest = 0;
+  } else if (fabsf(lag - beatEstLag) < beatEstLag * 0.06f) {
+    beatEstLag += 0.25f * (lag - beatEstLag);
+    beatDisagree = 0;
+  } else if (++beatDisagree >= 3) {
+    beatEstLag = beatPeriod = lag;  // The music changed tempo
+    beatDisagree = 0;
+  }
+}
+
+// Once per audio frame, on the audio task
+void beatTrackFrame(const uint16_t* bandLog, uint32_t frameEndUs) {
+  unsigned long start = micros();
+
+  // 1. Onset strength
+  float flux = 0;
+  for (uint8_t band = 0; band < AUDIO_BANDS; band++) {
+    if (bandLog[band] > beatPrevLog[band]) flux += bandLog[band] - beatPrevLog[band];
+    beatPrevLog[band] = bandLog[band];
+  }
+  beatFluxMean += (flux - beatFluxMean) / 16;
+  float novelty = max(flux - beatFluxMean, 0.0f);
+  beatNovelty[beatHead] = novelty;
+  beatHead = (beatHead + 1) % BEAT_HISTORY;
+  bool onset = novelty > BEAT_ONSET_RATIO * beatFluxMean && novelty > 0;
+  if (onset) {
+    beatOnsets++;
+    beatQuiet = 0;
+  } else if (beatQuiet < 0xFFFF) {
+    beatQuiet++;
+  }
+
+  // 2. A slice of the autocorrelation sweep
+  for (uint8_t i = 0; i < BEAT_LAGS_PER_FRAME; i++) {
+    uint8_t lag = beatSweep == 0 ? 0 : BEAT_MIN_LAG + beatSweep - 1;
+    beatAcf[lag] = beatAutocorrelation(lag);
+    if (lag == BEAT_ACF_LAGS - 1) {
+      beatSweep = 0;
+      beatEstimateTempo();
+      break;
+    }
+    beatSweep++;
+  }
+
+  // 3. Beat clock
+  float frame = beatFrame++;
+  if (beatEstLag > 0) {
+    if (frame >= beatNext - BEAT_WINDOW * beatPeriod && novelty > beatBest) {
+      beatBest = novelty;
+      beatBestAt = frame;
+    }
+    if (frame >= beatNext + BEAT_WINDOW * beatPeriod) {
+      bool hit = beatBest > BEAT_ONSET_RATIO * beatFluxMean && beatBest > 0;
+      if (hit) {
+        float error = beatBestAt - beatNext;
+        beatNext += BEAT_PHASE_GAIN * error;
+        beatPeriod += BEAT_PERIOD_GAIN * error;
+      }
+      beatPeriod += BEAT_TEMPO_PULL * (beatEstLag - beatPeriod);
+      beatPeriod = constrain(beatPeriod, (float)BEAT_MIN_LAG, (float)BEAT_MAX_LAG);
+      beatHits = beatHits << 1 | hit;
+
+      // This frame's samples are centred half a frame before its end
+      beatPublishClock(frameEndUs - AUDIO_FRAME_US / 2 - (uint32_t)((frame - beatNext) * AUDIO_FRAME_US),
+                       beatPeriod * AUDIO_FRAME_US);
+      beatLocked = beatConfidence >= BEAT_LOCK_CONFIDENCE && __builtin_popcount(beatHits) >= BEAT_LOCK_HITS &&
+                   beatQuiet < BEAT_SILENCE_FRAMES;
+      beatNext += beatPeriod;
+      beatBest = 0;
+    }
+  }
+  if (beatQuiet >= BEAT_SILENCE_FRAMES) {
+    beatLocked = false;
+    beatEstLag = 0;  // Start over when the music comes back
+    beatHits = 0;
+  }
+
+  beatTrackUs = micros() - start;
+  if (beatTrackUs > beatMaxTrackUs) beatMaxTrackUs = beatTrackUs;
+}
+
+// -- BEAT CLOCK STATE VARIABLES (loop side) --
+uint32_t beatTicks = 0;
+uint32_t beatLastTickUs = 0;
+uint32_t beatTickPeriodUs = 500000;  // Period the last tick was timed with
+bool beatTickNow = false;  // A beat fired on this loop pass
+
+// Once per loop pass; true on the pass a beat falls on
+bool beatClockPoll() {
+  beatTickNow = false;
+  if (!beatLocked) return false;
+  uint32_t anchor, period;
+  beatReadClock(anchor, period);
+  uint32_t now = micros();
+  uint32_t sinceBeat = (now - anchor) % period;
+  if (now - beatLastTickUs < period / 2 || sinceBeat > period / 4) return false;
+  beatLastTickUs = now - sinceBeat;
+  beatTickPeriodUs = period;
+  beatTicks++;
+  beatTickNow = true;
+  return true;
+}
+
+uint16_t beatBpmX10() {
+  uint32_t period = beatPeriodUs.load(std::memory_order_relaxed);
+  return period ? 600000000UL / period : 0;
+}
+
+// "locked,bpm,confidence%,ticks,onsets,trackUs,maxTrackUs"
+void beatStats(char* out, size_t size) {
+  uint16_t bpm = beatBpmX10();
+  snprintf(out, size, "%u,%u.%u,%u,%lu,%lu,%lu,%lu", beatLocked ? 1 : 0, bpm / 10, bpm % 10,
+           (unsigned)(beatConfidence * 100), (unsigned long)beatTicks, (unsigned long)beatOnsets,
+           (unsigned long)beatTrackUs, (unsigned long)beatMaxTrackUs);
+}
+
+#endif
@@ -0,0 +1,1440 @@
+/*
+ * =========================================================
+ * CHOREO TRACKS - GENERATED, DO NOT EDIT
+ * =========================================================
+ * Compressed keyframe tracks for all six songs, generated by
+ * tools/choreo_encode.cpp from the song headers. Edit the
+ * song headers and regenerate instead.
+ * =========================================================
+ */
+
+#ifndef CHOREO_TRACKS_H
+#define CHOREO_TRACKS_H
+
+#include "keyframes.h"
+
+// Falling For You - 26 steps, 2865 bytes
+const uint8_t FALLING_TRACKS[] PROGMEM = {
+  34, 50, 1, 39, 50, 8, 40, 50, 2, 39, 50, 16, 40, 144, 3, 0, 90, 1, 80, 90, 
+  8, 79, 90, 2, 80, 90, 16, 79, 144, 3, 0, 90, 1, 79, 90, 8, 80, 90, 2, 79, 
+  90, 16, 80, 144, 3, 0, 90, 1, 80, 90, 8, 79, 90, 2, 80, 90, 16, 79, 144, 3, 
+  0, 90, 1, 79, 90, 8, 80, 90, 2, 79, 90, 16, 80, 144, 3, 0, 90, 1, 80, 90, 
+  8, 79, 90, 2, 80, 90, 16, 79, 144, 3, 0, 0, 192, 63, 10, 6, 4, 10, 6, 4, 
+  10, 200, 1, 0, 0, 128, 32, 9, 144, 3, 0, 13, 100, 1, 89, 100, 8, 90, 160, 1, 
+  4, 149, 1, 182, 2, 0, 160, 1, 1, 150, 1, 160, 1, 8, 149, 1, 70, 4, 60, 70, 
+  32, 59, 144, 3, 0, 0, 192, 63, 16, 12, 10, 16, 12, 10, 18, 250, 1, 0, 0, 128, 
+  32, 17, 144, 3, 0, 14, 130, 1, 1, 119, 130, 1, 8, 120, 80, 2, 69, 230, 1, 16, 
+  220, 1, 244, 3, 0, 110, 1, 100, 110, 8, 99, 90, 2, 80, 90, 16, 79, 172, 2, 0, 
+  0, 192, 63, 24, 16, 16, 24, 16, 16, 20, 172, 2, 0, 0, 128, 32, 19, 200, 1, 0, 
+  15, 90, 1, 80, 90, 8, 79, 220, 1, 4, 209, 1, 70, 32, 60, 144, 3, 0, 230, 1, 
+  4, 220, 1, 230, 1, 32, 219, 1, 172, 2, 0, 90, 1, 79, 90, 8, 80, 110, 4, 99, 
+  110, 32, 100, 200, 1, 0, 0, 192, 31, 36, 24, 20, 36, 24, 20, 216, 4, 0, 19, 70, 
+  1, 59, 40, 2, 29, 190, 1, 4, 179, 1, 172, 2, 0, 70, 8, 60, 190, 1, 16, 180, 
+  1, 40, 32, 30, 172, 2, 0, 40, 1, 30, 40, 8, 29, 40, 2, 30, 40, 16, 29, 40, 
+  4, 30, 40, 32, 29, 144, 3, 0, 0, 192, 63, 20, 10, 10, 20, 10, 10, 10, 250, 1, 
+  0, 0, 128, 32, 9, 200, 1, 0, 32, 100, 1, 89, 100, 8, 90, 60, 2, 49, 210, 1, 
+  16, 200, 1, 200, 1, 0, 30, 1, 20, 30, 8, 19, 20, 2, 10, 20, 16, 9, 200, 1, 
+  0, 30, 1, 20, 30, 8, 19, 20, 2, 10, 20, 16, 9, 200, 1, 0, 30, 1, 20, 30, 
+  8, 19, 20, 2, 10, 20, 16, 9, 200, 1, 0, 130, 1, 1, 120, 130, 1, 8, 119, 200, 
+  1, 0, 190, 1, 1, 179, 1, 190, 1, 8, 180, 1, 200, 1, 0, 0, 192, 13, 30, 20, 
+  10, 30, 200, 1, 0, 0, 192, 45, 19, 10, 20, 9, 12, 200, 1, 0, 0, 128, 32, 11, 
+  172, 2, 0, 54, 75, 1, 139, 1, 75, 8, 140, 1, 40, 2, 69, 115, 16, 220, 1, 150, 
+  1, 0, 145, 1, 1, 152, 2, 145, 1, 8, 151, 2, 165, 1, 2, 192, 2, 165, 1, 16, 
+  191, 2, 150, 1, 0, 145, 1, 1, 151, 2, 145, 1, 8, 152, 2, 165, 1, 2, 191, 2, 
+  165, 1, 16, 192, 2, 150, 1, 0, 145, 1, 1, 152, 2, 145, 1, 8, 151, 2, 165, 1, 
+  2, 192, 2, 165, 1, 16, 191, 2, 150, 1, 0, 145, 1, 1, 151, 2, 145, 1, 8, 152, 
+  2, 165, 1, 2, 191, 2, 165, 1, 16, 192, 2, 150, 1, 0, 145, 1, 1, 152, 2, 145, 
+  1, 8, 151, 2, 165, 1, 2, 192, 2, 165, 1, 16, 191, 2, 150, 1, 0, 145, 1, 1, 
+  151, 2, 145, 1, 8, 152, 2, 165, 1, 2, 191, 2, 165, 1, 16, 192, 2, 150, 1, 0, 
+  145, 1, 1, 152, 2, 145, 1, 8, 151, 2, 165, 1, 2, 192, 2, 165, 1, 16, 191, 2, 
+  150, 1, 0, 145, 1, 1, 151, 2, 145, 1, 8, 152, 2, 165, 1, 2, 191, 2, 165, 1, 
+  16, 192, 2, 150, 1, 0, 145, 1, 1, 152, 2, 145, 1, 8, 151, 2, 165, 1, 2, 192, 
+  2, 165, 1, 16, 191, 2, 150, 1, 0, 0, 192, 63, 40, 30, 30, 40, 30, 30, 20, 150, 
+  1, 0, 0, 128, 32, 19, 50, 0, 17, 105, 1, 59, 105, 8, 60, 30, 2, 9, 255, 1, 
+  16, 160, 1, 216, 4, 0, 90, 1, 80, 90, 8, 79, 60, 4, 49, 110, 32, 99, 244, 3, 
+  0, 150, 1, 1, 139, 1, 150, 1, 8, 140, 1, 140, 1, 4, 129, 1, 140, 1, 32, 130, 
+  1, 144, 3, 0, 0, 192, 31, 24, 16, 12, 24, 16, 12, 216, 4, 0, 25, 50, 0, 40, 
+  32, 30, 172, 2, 0, 100, 1, 89, 100, 8, 90, 250, 1, 0, 190, 1, 1, 180, 1, 190, 
+  1, 8, 179, 1, 250, 1, 0, 160, 1, 1, 149, 1, 160, 1, 8, 150, 1, 250, 1, 0, 
+  130, 1, 1, 120, 130, 1, 8, 119, 250, 1, 0, 100, 1, 89, 100, 8, 90, 250, 1, 0, 
+  70, 1, 60, 70, 8, 59, 250, 1, 0, 0, 192, 63, 12, 8, 6, 12, 8, 6, 10, 200, 
+  1, 0, 0, 128, 32, 9, 200, 1, 0, 18, 40, 1, 29, 40, 8, 30, 30, 2, 19, 180, 
+  1, 16, 170, 1, 60, 4, 49, 110, 32, 99, 244, 3, 0, 70, 1, 60, 70, 8, 59, 50, 
+  2, 40, 50, 16, 39, 90, 4, 79, 90, 32, 80, 244, 3, 0, 0, 192, 63, 16, 12, 8, 
+  16, 12, 8, 20, 180, 1, 0, 0, 128, 32, 19, 192, 2, 0, 21, 220, 1, 0, 30, 1, 
+  19, 30, 8, 20, 200, 1, 0, 30, 1, 19, 30, 8, 20, 200, 1, 0, 30, 1, 19, 30, 
+  8, 20, 200, 1, 0, 60, 2, 49, 210, 1, 16, 200, 1, 180, 1, 4, 169, 1, 30, 32, 
+  20, 144, 3, 0, 0, 192, 63, 28, 20, 16, 28, 20, 16, 18, 172, 2, 0, 0, 128, 32, 
+  5, 172, 2, 0, 0, 128, 32, 11, 200, 1, 0, 15, 130, 1, 1, 120, 130, 1, 8, 119, 
+  240, 1, 4, 229, 1, 90, 32, 80, 144, 3, 0, 162, 2, 4, 152, 2, 162, 2, 32, 151, 
+  2, 200, 1, 0, 160, 1, 1, 149, 1, 160, 1, 8, 150, 1, 172, 2, 0, 0, 192, 63, 
+  50, 36, 30, 50, 36, 30, 20, 222, 2, 0, 0, 128, 32, 19, 50, 0, 21, 100, 1, 89, 
+  60, 2, 49, 220, 1, 4, 209, 1, 200, 1, 0, 100, 8, 90, 210, 1, 16, 200, 1, 70, 
+  32, 60, 200, 1, 0, 40, 1, 30, 40, 8, 29, 30, 2, 20, 30, 16, 19, 40, 4, 30, 
+  40, 32, 29, 172, 2, 0, 70, 2, 60, 70, 16, 59, 200, 1, 0, 0, 192, 63, 32, 20, 
+  24, 32, 20, 24, 10, 144, 3, 0, 0, 128, 32, 9, 64, 48, 1, 149, 1, 42, 8, 130, 
+  1, 15, 2, 39, 69, 16, 220, 1, 120, 0, 90, 1, 162, 2, 81, 8, 131, 2, 84, 2, 
+  142, 2, 93, 16, 171, 2, 120, 0, 87, 1, 151, 2, 78, 8, 250, 1, 93, 2, 171, 2, 
+  87, 16, 152, 2, 120, 0, 87, 1, 152, 2, 75, 8, 239, 1, 90, 2, 162, 2, 90, 16, 
+  161, 2, 120, 0, 93, 1, 171, 2, 78, 8, 250, 1, 84, 2, 141, 2, 96, 16, 182, 2, 
+  120, 0, 93, 1, 172, 2, 84, 8, 141, 2, 87, 2, 152, 2, 96, 16, 181, 2, 120, 0, 
+  90, 1, 161, 2, 87, 8, 152, 2, 93, 2, 171, 2, 87, 16, 152, 2, 120, 0, 87, 1, 
+  152, 2, 84, 8, 141, 2, 93, 2, 172, 2, 90, 16, 161, 2, 120, 0, 87, 1, 151, 2, 
+  87, 8, 152, 2, 90, 2, 161, 2, 93, 16, 172, 2, 120, 0, 90, 1, 162, 2, 84, 8, 
+  141, 2, 93, 2, 172, 2, 93, 16, 171, 2, 120, 0, 87, 1, 151, 2, 81, 8, 132, 2, 
+  96, 2, 181, 2, 99, 16, 192, 2, 120, 0, 81, 1, 132, 2, 81, 8, 131, 2, 99, 2, 
+  192, 2, 99, 16, 191, 2, 120, 0, 0, 192, 63, 44, 32, 36, 36, 24, 28, 10, 120, 0, 
+  0, 128, 32, 9, 80, 0, 27, 200, 1, 1, 89, 200, 1, 8, 90, 80, 2, 29, 252, 2, 
+  16, 180, 1, 252, 2, 4, 179, 1, 80, 32, 30, 160, 6, 0, 20, 1, 9, 20, 8, 10, 
+  172, 2, 0, 30, 1, 20, 30, 8, 19, 172, 2, 0, 30, 1, 19, 30, 8, 20, 172, 2, 
+  0, 30, 1, 20, 30, 8, 19, 172, 2, 0, 30, 1, 19, 30, 8, 20, 172, 2, 0, 30, 
+  1, 20, 30, 8, 19, 172, 2, 0, 0, 192, 31, 32, 24, 20, 32, 24, 20, 188, 5, 0, 
+  45, 220, 1, 0, 25, 1, 39, 100, 0, 45, 1, 80, 100, 0, 25, 8, 39, 100, 0, 45, 
+  8, 80, 100, 0, 12, 2, 29, 57, 16, 180, 1, 150, 1, 0, 15, 2, 40, 15, 16, 39, 
+  150, 1, 0, 15, 2, 39, 15, 16, 40, 150, 1, 0, 15, 2, 40, 15, 16, 39, 150, 1, 
+  0, 15, 2, 39, 15, 16, 40, 150, 1, 0, 15, 2, 40, 15, 16, 39, 150, 1, 0, 15, 
+  2, 39, 15, 16, 40, 150, 1, 0, 15, 2, 40, 15, 16, 39, 150, 1, 0, 0, 192, 4, 
+  16, 24, 200, 1, 0, 0, 192, 4, 8, 7, 200, 1, 0, 0, 128, 32, 10, 100, 0, 0, 
+  128, 32, 9, 100, 0, 0, 128, 32, 20, 100, 0, 0, 128, 32, 19, 172, 2, 0, 38, 50, 
+  1, 39, 50, 8, 40, 172, 2, 0, 90, 1, 80, 90, 8, 79, 172, 2, 0, 110, 1, 99, 
+  110, 8, 100, 142, 2, 0, 130, 1, 1, 120, 130, 1, 8, 119, 142, 2, 0, 150, 1, 1, 
+  139, 1, 150, 1, 8, 140, 1, 240, 1, 0, 170, 1, 1, 160, 1, 170, 1, 8, 159, 1, 
+  240, 1, 0, 190, 1, 1, 179, 1, 190, 1, 8, 180, 1, 210, 1, 0, 210, 1, 1, 200, 
+  1, 210, 1, 8, 199, 1, 210, 1, 0, 230, 1, 1, 219, 1, 230, 1, 8, 220, 1, 180, 
+  1, 0, 250, 1, 1, 240, 1, 250, 1, 8, 239, 1, 180, 1, 0, 50, 2, 39, 200, 1, 
+  16, 190, 1, 160, 1, 4, 149, 1, 182, 2, 0, 0, 192, 63, 32, 24, 20, 32, 24, 20, 
+  10, 250, 1, 0, 0, 128, 32, 9, 250, 1, 0, 29, 70, 1, 59, 70, 8, 60, 20, 2, 
+  9, 170, 1, 16, 160, 1, 200, 1, 0, 40, 1, 29, 40, 8, 30, 100, 4, 89, 70, 32, 
+  59, 200, 1, 0, 20, 1, 10, 20, 8, 9, 30, 4, 20, 30, 32, 19, 200, 1, 0, 20, 
+  1, 10, 20, 8, 9, 30, 4, 20, 30, 32, 19, 200, 1, 0, 20, 1, 10, 20, 8, 9, 
+  30, 4, 20, 30, 32, 19, 200, 1, 0, 0, 192, 63, 36, 28, 24, 36, 28, 24, 20, 200, 
+  1, 0, 0, 128, 32, 19, 100, 0, 17, 170, 1, 1, 160, 1, 170, 1, 8, 159, 1, 132, 
+  2, 4, 249, 1, 110, 32, 100, 216, 4, 0, 202, 2, 4, 192, 2, 202, 2, 32, 191, 2, 
+  144, 3, 0, 190, 1, 1, 179, 1, 190, 1, 8, 180, 1, 40, 2, 30, 130, 1, 16, 120, 
+  244, 3, 0, 0, 192, 63, 60, 50, 40, 60, 50, 40, 20, 144, 3, 0, 0, 128, 32, 19, 
+  100, 0, 21, 130, 1, 1, 119, 80, 2, 69, 240, 1, 4, 229, 1, 172, 2, 0, 130, 1, 
+  8, 120, 230, 1, 16, 220, 1, 90, 32, 80, 172, 2, 0, 40, 1, 30, 40, 8, 29, 30, 
+  2, 20, 30, 16, 19, 30, 4, 20, 30, 32, 19, 144, 3, 0, 130, 1, 2, 120, 130, 1, 
+  16, 119, 172, 2, 0, 0, 192, 63, 40, 30, 30, 40, 30, 30, 10, 244, 3, 0, 0, 128, 
+  32, 9, 66, 4, 1, 9, 14, 8, 59, 10, 2, 39, 18, 16, 79, 10, 4, 39, 10, 32, 
+  40, 100, 0, 18, 1, 80, 26, 8, 120, 52, 2, 250, 1, 50, 16, 240, 1, 24, 4, 109, 
+  8, 32, 29, 100, 0, 22, 1, 99, 8, 8, 30, 8, 2, 29, 50, 16, 239, 1, 40, 4, 
+  190, 1, 42, 32, 199, 1, 100, 0, 26, 1, 120, 2, 0, 38, 2, 179, 1, 36, 16, 170, 
+  1, 6, 4, 19, 46, 32, 220, 1, 100, 0, 26, 1, 119, 26, 8, 119, 24, 2, 110, 4, 
+  16, 9, 22, 4, 99, 14, 32, 59, 100, 0, 10, 1, 39, 36, 8, 170, 1, 18, 2, 79, 
+  2, 0, 10, 4, 40, 6, 32, 20, 100, 0, 26, 1, 120, 4, 8, 9, 30, 2, 140, 1, 
+  2, 0, 16, 4, 70, 102, 0, 6, 1, 19, 52, 8, 249, 1, 18, 2, 79, 2, 0, 6, 
+  4, 19, 102, 0, 0, 192, 13, 50, 40, 30, 20, 150, 1, 0, 0, 192, 45, 19, 19, 20, 
+  20, 20, 50, 0, 0, 128, 32, 0, 50, 0, 0, 128, 32, 0, 50, 0, 0, 128, 32, 0, 
+  100, 0, 0, 128, 32, 19, 150, 1, 0, 66, 52, 1, 119, 52, 8, 120, 28, 2, 59, 88, 
+  16, 210, 1, 180, 1, 0, 100, 1, 240, 1, 100, 8, 239, 1, 124, 2, 172, 2, 124, 16, 
+  171, 2, 180, 1, 0, 100, 1, 239, 1, 100, 8, 240, 1, 124, 2, 171, 2, 124, 16, 172, 
+  2, 180, 1, 0, 100, 1, 240, 1, 100, 8, 239, 1, 124, 2, 172, 2, 124, 16, 171, 2, 
+  180, 1, 0, 100, 1, 239, 1, 100, 8, 240, 1, 124, 2, 171, 2, 124, 16, 172, 2, 180, 
+  1, 0, 100, 1, 240, 1, 100, 8, 239, 1, 124, 2, 172, 2, 124, 16, 171, 2, 180, 1, 
+  0, 100, 1, 239, 1, 100, 8, 240, 1, 124, 2, 171, 2, 124, 16, 172, 2, 180, 1, 0, 
+  100, 1, 240, 1, 100, 8, 239, 1, 124, 2, 172, 2, 124, 16, 171, 2, 180, 1, 0, 100, 
+  1, 239, 1, 100, 8, 240, 1, 124, 2, 171, 2, 124, 16, 172, 2, 180, 1, 0, 100, 1, 
+  240, 1, 100, 8, 239, 1, 124, 2, 172, 2, 124, 16, 171, 2, 180, 1, 0, 100, 1, 239, 
+  1, 100, 8, 240, 1, 124, 2, 171, 2, 124, 16, 172, 2, 180, 1, 0, 100, 1, 240, 1, 
+  100, 8, 239, 1, 124, 2, 172, 2, 124, 16, 171, 2, 180, 1, 0, 0, 192, 63, 44, 36, 
+  32, 44, 36, 32, 18, 200, 1, 0, 0, 128, 32, 5, 200, 1, 0, 0, 128, 32, 11, 200, 
+  1, 0, 9, 250, 1, 1, 89, 250, 1, 8, 90, 100, 2, 29, 219, 3, 16, 180, 1, 219, 
+  3, 4, 179, 1, 100, 32, 30, 248, 20, 0, 0, 192, 31, 32, 24, 20, 32, 24, 20, 188, 
+  5, 0, 50, 160, 1, 1, 149, 1, 160, 1, 8, 150, 1, 60, 2, 49, 60, 16, 50, 172, 
+  2, 0, 182, 2, 1, 172, 2, 182, 2, 8, 171, 2, 172, 2, 0, 152, 2, 1, 141, 2, 
+  152, 2, 8, 142, 2, 20, 2, 10, 20, 16, 9, 144, 3, 0, 250, 1, 1, 240, 1, 250, 
+  1, 8, 239, 1, 144, 3, 0, 220, 1, 1, 209, 1, 220, 1, 8, 210, 1, 20, 2, 10, 
+  20, 16, 9, 244, 3, 0, 190, 1, 1, 180, 1, 190, 1, 8, 179, 1, 244, 3, 0, 160, 
+  1, 1, 149, 1, 160, 1, 8, 150, 1, 20, 2, 10, 20, 16, 9, 216, 4, 0, 130, 1, 
+  1, 120, 130, 1, 8, 119, 216, 4, 0, 100, 1, 89, 100, 8, 90, 20, 2, 10, 20, 16, 
+  9, 188, 5, 0, 70, 1, 60, 70, 8, 59, 188, 5, 0, 50, 4, 39, 120, 32, 109, 144, 
+  3, 0, 30, 4, 19, 30, 32, 20, 144, 3, 0, 0, 192, 63, 24, 16, 12, 24, 16, 12, 
+  10, 250, 1, 0, 0, 128, 32, 9, 222, 2, 0, 35, 54, 1, 19, 54, 8, 20, 36, 2, 
+  10, 142, 2, 16, 140, 1, 72, 4, 29, 234, 1, 32, 119, 216, 4, 0, 20, 1, 10, 20, 
+  8, 9, 144, 3, 0, 30, 1, 20, 30, 8, 19, 144, 3, 0, 30, 1, 19, 30, 8, 20, 
+  144, 3, 0, 30, 1, 20, 30, 8, 19, 144, 3, 0, 30, 1, 19, 30, 8, 20, 144, 3, 
+  0, 30, 1, 20, 30, 8, 19, 144, 3, 0, 30, 1, 19, 30, 8, 20, 144, 3, 0, 30, 
+  1, 20, 30, 8, 19, 144, 3, 0, 0, 192, 63, 16, 10, 8, 16, 10, 8, 20, 200, 1, 
+  0, 0, 128, 32, 19, 172, 2, 0, 9, 80, 1, 29, 80, 8, 30, 20, 0, 192, 2, 16, 
+  150, 1, 200, 1, 4, 89, 140, 1, 32, 59, 248, 30, 0, 0, 192, 31, 10, 6, 4, 10, 
+  6, 4, 220, 11, 0
+};
+const uint16_t FALLING_STEP_OFFSETS[] PROGMEM = {
+  0, 111, 165, 220, 278, 348, 463, 708, 776, 869, 934, 1011, 
+  1076, 1152, 1386, 1480, 1618, 1771, 1868, 1942, 2022, 2229, 2482, 2522, 
+  2711, 2828
+};
+
+// Stereo Love - 28 steps, 6212 bytes
+const uint8_t STEREO_TRACKS[] PROGMEM = {
+  13, 210, 1, 0, 30, 1, 89, 30, 8, 90, 30, 2, 90, 21, 16, 60, 172, 2, 0, 57, 
+  1, 180, 1, 57, 8, 179, 1, 172, 2, 0, 0, 192, 63, 20, 10, 16, 20, 10, 16, 10, 
+  172, 2, 0, 0, 128, 32, 9, 200, 1, 0, 29, 28, 1, 59, 28, 8, 60, 76, 4, 179, 
+  1, 16, 32, 30, 250, 1, 0, 8, 1, 9, 8, 8, 10, 12, 4, 20, 12, 32, 19, 250, 
+  1, 0, 8, 1, 9, 8, 8, 10, 12, 4, 20, 12, 32, 19, 250, 1, 0, 8, 1, 9, 
+  8, 8, 10, 12, 4, 20, 12, 32, 19, 250, 1, 0, 40, 1, 29, 40, 8, 30, 10, 0, 
+  160, 1, 16, 150, 1, 144, 3, 0, 0, 192, 63, 30, 20, 24, 30, 20, 24, 20, 150, 1, 
+  0, 0, 128, 32, 19, 150, 1, 0, 49, 34, 1, 159, 1, 34, 8, 160, 1, 16, 2, 69, 
+  46, 16, 220, 1, 48, 4, 229, 1, 18, 32, 80, 200, 1, 0, 66, 1, 192, 2, 66, 8, 
+  191, 2, 150, 1, 0, 66, 1, 191, 2, 66, 8, 192, 2, 150, 1, 0, 66, 1, 192, 2, 
+  66, 8, 191, 2, 150, 1, 0, 66, 1, 191, 2, 66, 8, 192, 2, 150, 1, 0, 66, 1, 
+  192, 2, 66, 8, 191, 2, 150, 1, 0, 66, 1, 191, 2, 66, 8, 192, 2, 150, 1, 0, 
+  66, 1, 192, 2, 66, 8, 191, 2, 150, 1, 0, 66, 1, 191, 2, 66, 8, 192, 2, 150, 
+  1, 0, 66, 1, 192, 2, 66, 8, 191, 2, 150, 1, 0, 66, 1, 191, 2, 66, 8, 192, 
+  2, 150, 1, 0, 66, 1, 192, 2, 66, 8, 191, 2, 150, 1, 0, 66, 1, 191, 2, 66, 
+  8, 192, 2, 150, 1, 0, 0, 192, 13, 50, 40, 10, 30, 200, 1, 0, 0, 192, 36, 39, 
+  40, 10, 200, 1, 0, 0, 128, 32, 9, 100, 0, 86, 21, 1, 59, 21, 8, 60, 12, 2, 
+  29, 57, 16, 180, 1, 180, 1, 0, 21, 1, 60, 21, 8, 59, 12, 2, 30, 12, 16, 29, 
+  180, 1, 0, 21, 1, 59, 21, 8, 60, 12, 2, 29, 12, 16, 30, 180, 1, 0, 21, 1, 
+  60, 21, 8, 59, 12, 2, 30, 12, 16, 29, 180, 1, 0, 21, 1, 59, 21, 8, 60, 12, 
+  2, 29, 12, 16, 30, 180, 1, 0, 21, 1, 60, 21, 8, 59, 12, 2, 30, 12, 16, 29, 
+  180, 1, 0, 21, 1, 59, 21, 8, 60, 12, 2, 29, 12, 16, 30, 180, 1, 0, 21, 1, 
+  60, 21, 8, 59, 12, 2, 30, 12, 16, 29, 180, 1, 0, 21, 1, 59, 21, 8, 60, 12, 
+  2, 29, 12, 16, 30, 180, 1, 0, 21, 1, 60, 21, 8, 59, 12, 2, 30, 12, 16, 29, 
+  180, 1, 0, 21, 1, 59, 21, 8, 60, 12, 2, 29, 12, 16, 30, 180, 1, 0, 21, 1, 
+  60, 21, 8, 59, 12, 2, 30, 12, 16, 29, 180, 1, 0, 21, 1, 59, 21, 8, 60, 12, 
+  2, 29, 12, 16, 30, 180, 1, 0, 21, 1, 60, 21, 8, 59, 12, 2, 30, 12, 16, 29, 
+  180, 1, 0, 21, 1, 59, 21, 8, 60, 12, 2, 29, 12, 16, 30, 180, 1, 0, 21, 1, 
+  60, 21, 8, 59, 12, 2, 30, 12, 16, 29, 180, 1, 0, 0, 192, 13, 36, 24, 36, 24, 
+  200, 1, 0, 0, 192, 36, 19, 19, 18, 200, 1, 0, 0, 128, 32, 17, 200, 1, 0, 93, 
+  52, 1, 119, 24, 2, 49, 88, 4, 209, 1, 4, 0, 28, 16, 60, 28, 32, 59, 250, 1, 
+  0, 52, 1, 120, 60, 2, 140, 1, 52, 4, 120, 52, 8, 120, 60, 16, 140, 1, 52, 32, 
+  120, 250, 1, 0, 52, 1, 119, 60, 2, 139, 1, 52, 4, 119, 52, 8, 119, 60, 16, 139, 
+  1, 52, 32, 119, 250, 1, 0, 52, 1, 120, 60, 2, 140, 1, 52, 4, 120, 52, 8, 120, 
+  60, 16, 140, 1, 52, 32, 120, 250, 1, 0, 52, 1, 119, 60, 2, 139, 1, 52, 4, 119, 
+  52, 8, 119, 60, 16, 139, 1, 52, 32, 119, 250, 1, 0, 52, 1, 120, 60, 2, 140, 1, 
+  52, 4, 120, 52, 8, 120, 60, 16, 140, 1, 52, 32, 120, 250, 1, 0, 52, 1, 119, 60, 
+  2, 139, 1, 52, 4, 119, 52, 8, 119, 60, 16, 139, 1, 52, 32, 119, 250, 1, 0, 52, 
+  1, 120, 60, 2, 140, 1, 52, 4, 120, 52, 8, 120, 60, 16, 140, 1, 52, 32, 120, 250, 
+  1, 0, 52, 1, 119, 60, 2, 139, 1, 52, 4, 119, 52, 8, 119, 60, 16, 139, 1, 52, 
+  32, 119, 250, 1, 0, 52, 1, 120, 60, 2, 140, 1, 52, 4, 120, 52, 8, 120, 60, 16, 
+  140, 1, 52, 32, 120, 250, 1, 0, 52, 1, 119, 60, 2, 139, 1, 52, 4, 119, 52, 8, 
+  119, 60, 16, 139, 1, 52, 32, 119, 250, 1, 0, 52, 1, 120, 60, 2, 140, 1, 52, 4, 
+  120, 52, 8, 120, 60, 16, 140, 1, 52, 32, 120, 250, 1, 0, 0, 192, 4, 40, 16, 250, 
+  1, 0, 0, 192, 4, 23, 24, 250, 1, 0, 0, 128, 32, 12, 172, 2, 0, 0, 128, 32, 
+  6, 172, 2, 0, 0, 128, 32, 17, 21, 60, 1, 39, 60, 8, 40, 24, 2, 9, 204, 1, 
+  16, 160, 1, 72, 4, 49, 132, 1, 32, 99, 244, 3, 0, 70, 1, 60, 70, 8, 59, 30, 
+  4, 20, 30, 32, 19, 144, 3, 0, 165, 1, 1, 99, 165, 1, 8, 100, 165, 1, 4, 99, 
+  165, 1, 32, 100, 216, 4, 0, 0, 192, 63, 24, 16, 12, 24, 16, 12, 10, 250, 1, 0, 
+  0, 128, 32, 9, 150, 1, 0, 35, 21, 1, 19, 21, 8, 20, 14, 2, 9, 119, 16, 160, 
+  1, 142, 2, 0, 18, 1, 19, 18, 8, 20, 12, 2, 9, 12, 16, 10, 240, 1, 0, 20, 
+  1, 29, 20, 8, 30, 10, 2, 9, 10, 16, 10, 210, 1, 0, 12, 1, 19, 12, 8, 20, 
+  8, 2, 9, 8, 16, 10, 180, 1, 0, 12, 1, 29, 12, 8, 30, 6, 2, 9, 6, 16, 
+  10, 150, 1, 0, 57, 4, 179, 1, 12, 32, 30, 200, 1, 0, 57, 4, 180, 1, 57, 32, 
+  179, 1, 200, 1, 0, 0, 192, 45, 34, 24, 26, 26, 10, 120, 0, 0, 128, 32, 9, 130, 
+  1, 0, 82, 32, 1, 150, 1, 6, 8, 20, 16, 2, 70, 4, 16, 10, 6, 4, 20, 16, 
+  32, 69, 120, 0, 56, 1, 141, 2, 6, 8, 20, 14, 2, 59, 16, 16, 70, 4, 4, 10, 
+  12, 32, 49, 122, 0, 10, 8, 40, 36, 2, 170, 1, 36, 16, 169, 1, 12, 4, 49, 12, 
+  32, 50, 120, 0, 42, 1, 200, 1, 26, 8, 119, 36, 2, 169, 1, 34, 16, 160, 1, 30, 
+  4, 139, 1, 30, 32, 140, 1, 120, 0, 42, 1, 199, 1, 20, 8, 89, 18, 2, 80, 14, 
+  16, 60, 4, 4, 9, 36, 32, 169, 1, 120, 0, 28, 1, 130, 1, 34, 8, 160, 1, 24, 
+  2, 110, 34, 16, 159, 1, 32, 4, 150, 1, 24, 32, 110, 120, 0, 10, 1, 40, 22, 8, 
+  99, 2, 0, 44, 16, 210, 1, 32, 4, 149, 1, 30, 32, 139, 1, 120, 0, 12, 1, 50, 
+  8, 8, 29, 30, 2, 139, 1, 18, 16, 79, 10, 4, 39, 30, 32, 140, 1, 120, 0, 42, 
+  1, 199, 1, 52, 8, 250, 1, 16, 2, 70, 14, 16, 59, 44, 4, 210, 1, 8, 32, 30, 
+  120, 0, 12, 1, 50, 62, 8, 171, 2, 12, 2, 50, 24, 16, 109, 14, 4, 59, 36, 32, 
+  169, 1, 120, 0, 0, 192, 13, 56, 44, 24, 36, 150, 1, 0, 0, 192, 45, 31, 7, 32, 
+  8, 20, 80, 0, 0, 128, 32, 0, 80, 0, 0, 128, 32, 0, 80, 0, 0, 128, 32, 0, 
+  80, 0, 0, 128, 32, 0, 100, 0, 0, 128, 32, 19, 76, 40, 1, 89, 16, 2, 29, 150, 
+  1, 0, 64, 4, 149, 1, 150, 1, 0, 40, 8, 90, 76, 16, 180, 1, 176, 2, 0, 40, 
+  1, 90, 52, 2, 120, 28, 4, 60, 40, 8, 89, 52, 16, 119, 28, 32, 59, 200, 1, 0, 
+  40, 1, 89, 52, 2, 119, 150, 1, 0, 28, 4, 59, 150, 1, 0, 40, 8, 90, 52, 16, 
+  120, 150, 1, 0, 28, 32, 60, 150, 1, 0, 40, 1, 90, 52, 2, 120, 28, 4, 60, 40, 
+  8, 89, 52, 16, 119, 28, 32, 59, 200, 1, 0, 40, 1, 89, 52, 2, 119, 150, 1, 0, 
+  28, 4, 59, 150, 1, 0, 40, 8, 90, 52, 16, 120, 150, 1, 0, 28, 32, 60, 150, 1, 
+  0, 40, 1, 90, 52, 2, 120, 28, 4, 60, 40, 8, 89, 52, 16, 119, 28, 32, 59, 200, 
+  1, 0, 40, 1, 89, 52, 2, 119, 150, 1, 0, 28, 4, 59, 150, 1, 0, 40, 8, 90, 
+  52, 16, 120, 150, 1, 0, 28, 32, 60, 150, 1, 0, 40, 1, 90, 52, 2, 120, 28, 4, 
+  60, 40, 8, 89, 52, 16, 119, 28, 32, 59, 200, 1, 0, 0, 64, 40, 200, 1, 0, 0, 
+  128, 4, 40, 200, 1, 0, 0, 64, 19, 200, 1, 0, 0, 128, 36, 19, 10, 200, 1, 0, 
+  0, 128, 32, 9, 200, 1, 0, 114, 12, 1, 50, 227, 2, 0, 42, 16, 130, 1, 150, 1, 
+  0, 22, 1, 99, 100, 0, 10, 8, 40, 253, 1, 0, 6, 16, 10, 150, 1, 0, 4, 1, 
+  10, 100, 0, 20, 8, 89, 100, 0, 6, 2, 10, 150, 1, 0, 6, 16, 9, 150, 1, 0, 
+  16, 1, 70, 100, 0, 22, 8, 100, 100, 0, 12, 2, 29, 150, 1, 0, 12, 16, 30, 252, 
+  1, 0, 14, 8, 59, 150, 3, 0, 4, 1, 10, 100, 0, 6, 8, 19, 100, 0, 9, 2, 
+  20, 150, 1, 0, 6, 16, 10, 150, 1, 0, 8, 1, 29, 100, 0, 14, 8, 60, 100, 0, 
+  6, 2, 10, 150, 1, 0, 15, 16, 39, 252, 1, 0, 6, 8, 20, 100, 0, 6, 2, 10, 
+  175, 2, 0, 28, 4, 129, 1, 80, 0, 18, 4, 80, 80, 0, 22, 32, 99, 80, 0, 18, 
+  32, 80, 80, 0, 18, 4, 79, 80, 0, 18, 4, 80, 80, 0, 18, 32, 79, 80, 0, 18, 
+  32, 80, 80, 0, 18, 4, 79, 80, 0, 18, 4, 80, 80, 0, 18, 32, 79, 80, 0, 18, 
+  32, 80, 80, 0, 18, 4, 79, 80, 0, 18, 4, 80, 80, 0, 18, 32, 79, 80, 0, 18, 
+  32, 80, 80, 0, 18, 4, 79, 80, 0, 18, 4, 80, 80, 0, 18, 32, 79, 80, 0, 18, 
+  32, 80, 80, 0, 18, 4, 79, 80, 0, 18, 4, 80, 80, 0, 18, 32, 79, 80, 0, 18, 
+  32, 80, 80, 0, 0, 64, 30, 100, 0, 0, 64, 9, 100, 0, 0, 128, 4, 30, 100, 0, 
+  0, 128, 36, 9, 10, 80, 0, 0, 128, 32, 9, 20, 0, 0, 128, 32, 20, 80, 0, 0, 
+  128, 32, 19, 20, 0, 0, 128, 32, 10, 80, 0, 0, 128, 32, 9, 220, 1, 0, 19, 105, 
+  1, 59, 105, 8, 60, 45, 2, 19, 142, 2, 16, 170, 1, 216, 4, 0, 132, 1, 1, 100, 
+  132, 1, 8, 99, 24, 4, 9, 180, 1, 32, 139, 1, 244, 3, 0, 210, 1, 1, 129, 1, 
+  210, 1, 8, 130, 1, 225, 1, 4, 139, 1, 225, 1, 32, 140, 1, 216, 4, 0, 0, 192, 
+  63, 28, 20, 16, 28, 20, 16, 10, 172, 2, 0, 0, 128, 32, 9, 200, 1, 0, 49, 18, 
+  1, 9, 18, 8, 10, 9, 0, 144, 1, 16, 150, 1, 99, 4, 99, 54, 32, 49, 222, 2, 
+  0, 24, 1, 19, 24, 8, 20, 16, 2, 9, 16, 16, 10, 16, 4, 9, 16, 32, 10, 172, 
+  2, 0, 14, 1, 9, 14, 8, 10, 14, 0, 14, 4, 9, 14, 32, 10, 250, 1, 0, 18, 
+  1, 19, 18, 8, 20, 12, 2, 9, 12, 16, 10, 12, 4, 9, 12, 32, 10, 200, 1, 0, 
+  15, 1, 19, 15, 8, 20, 10, 2, 9, 10, 16, 10, 10, 4, 9, 10, 32, 10, 150, 1, 
+  0, 8, 1, 9, 8, 8, 10, 8, 0, 8, 4, 9, 8, 32, 10, 100, 0, 40, 1, 29, 
+  40, 8, 30, 30, 2, 19, 30, 16, 20, 172, 2, 0, 0, 192, 63, 44, 32, 28, 44, 32, 
+  28, 20, 200, 1, 0, 0, 128, 32, 19, 100, 0, 99, 17, 1, 159, 1, 8, 8, 70, 26, 
+  2, 250, 1, 17, 16, 160, 1, 6, 4, 49, 2, 32, 10, 100, 0, 27, 1, 132, 2, 5, 
+  8, 39, 20, 2, 189, 1, 23, 16, 219, 1, 11, 4, 99, 20, 32, 189, 1, 100, 0, 7, 
+  1, 59, 11, 8, 99, 18, 2, 170, 1, 16, 16, 150, 1, 9, 4, 79, 21, 32, 200, 1, 
+  100, 0, 6, 1, 49, 24, 8, 230, 1, 24, 2, 229, 1, 15, 16, 139, 1, 3, 4, 20, 
+  4, 32, 29, 100, 0, 16, 1, 149, 1, 23, 8, 219, 1, 7, 2, 60, 11, 16, 100, 26, 
+  4, 250, 1, 10, 32, 90, 100, 0, 10, 1, 90, 3, 8, 19, 7, 2, 60, 7, 16, 59, 
+  28, 4, 141, 2, 12, 32, 109, 100, 0, 15, 1, 140, 1, 5, 8, 40, 2, 2, 10, 3, 
+  16, 20, 8, 4, 70, 16, 32, 149, 1, 100, 0, 7, 1, 59, 9, 8, 80, 13, 2, 120, 
+  3, 16, 20, 12, 4, 110, 101, 0, 18, 1, 169, 1, 11, 8, 100, 32, 2, 181, 2, 3, 
+  16, 20, 10, 4, 89, 11, 32, 100, 100, 0, 18, 1, 170, 1, 19, 8, 179, 1, 29, 2, 
+  152, 2, 17, 16, 160, 1, 12, 4, 110, 13, 32, 119, 100, 0, 11, 1, 100, 2, 8, 10, 
+  9, 2, 79, 18, 16, 169, 1, 4, 4, 30, 17, 32, 160, 1, 100, 0, 12, 1, 109, 10, 
+  8, 90, 2, 2, 9, 3, 16, 19, 23, 4, 219, 1, 14, 32, 129, 1, 100, 0, 0, 192, 
+  13, 60, 50, 20, 40, 120, 0, 0, 192, 45, 39, 9, 40, 10, 20, 60, 0, 0, 128, 32, 
+  0, 60, 0, 0, 128, 32, 0, 60, 0, 0, 128, 32, 0, 60, 0, 0, 128, 32, 0, 60, 
+  0, 0, 128, 32, 0, 80, 0, 0, 128, 32, 19, 180, 1, 0, 145, 1, 42, 1, 129, 1, 
+  42, 8, 130, 1, 21, 2, 59, 66, 16, 210, 1, 200, 1, 0, 81, 1, 132, 2, 81, 8, 
+  131, 2, 93, 2, 172, 2, 93, 16, 171, 2, 200, 1, 0, 81, 1, 131, 2, 81, 8, 132, 
+  2, 93, 2, 171, 2, 93, 16, 172, 2, 200, 1, 0, 81, 1, 132, 2, 81, 8, 131, 2, 
+  93, 2, 172, 2, 93, 16, 171, 2, 200, 1, 0, 81, 1, 131, 2, 81, 8, 132, 2, 93, 
+  2, 171, 2, 93, 16, 172, 2, 200, 1, 0, 81, 1, 132, 2, 81, 8, 131, 2, 93, 2, 
+  172, 2, 93, 16, 171, 2, 200, 1, 0, 81, 1, 131, 2, 81, 8, 132, 2, 93, 2, 171, 
+  2, 93, 16, 172, 2, 200, 1, 0, 81, 1, 132, 2, 81, 8, 131, 2, 93, 2, 172, 2, 
+  93, 16, 171, 2, 200, 1, 0, 81, 1, 131, 2, 81, 8, 132, 2, 93, 2, 171, 2, 93, 
+  16, 172, 2, 200, 1, 0, 81, 1, 132, 2, 81, 8, 131, 2, 93, 2, 172, 2, 93, 16, 
+  171, 2, 200, 1, 0, 81, 1, 131, 2, 81, 8, 132, 2, 93, 2, 171, 2, 93, 16, 172, 
+  2, 200, 1, 0, 81, 1, 132, 2, 81, 8, 131, 2, 93, 2, 172, 2, 93, 16, 171, 2, 
+  200, 1, 0, 81, 1, 131, 2, 81, 8, 132, 2, 93, 2, 171, 2, 93, 16, 172, 2, 200, 
+  1, 0, 81, 1, 132, 2, 81, 8, 131, 2, 93, 2, 172, 2, 93, 16, 171, 2, 200, 1, 
+  0, 81, 1, 131, 2, 81, 8, 132, 2, 93, 2, 171, 2, 93, 16, 172, 2, 200, 1, 0, 
+  81, 1, 132, 2, 81, 8, 131, 2, 93, 2, 172, 2, 93, 16, 171, 2, 200, 1, 0, 57, 
+  4, 179, 1, 12, 32, 30, 150, 1, 0, 57, 4, 180, 1, 57, 32, 179, 1, 150, 1, 0, 
+  57, 4, 179, 1, 57, 32, 180, 1, 150, 1, 0, 57, 4, 180, 1, 57, 32, 179, 1, 150, 
+  1, 0, 57, 4, 179, 1, 57, 32, 180, 1, 150, 1, 0, 57, 4, 180, 1, 57, 32, 179, 
+  1, 150, 1, 0, 57, 4, 179, 1, 57, 32, 180, 1, 150, 1, 0, 57, 4, 180, 1, 57, 
+  32, 179, 1, 150, 1, 0, 57, 4, 179, 1, 57, 32, 180, 1, 150, 1, 0, 57, 4, 180, 
+  1, 57, 32, 179, 1, 150, 1, 0, 57, 4, 179, 1, 57, 32, 180, 1, 150, 1, 0, 57, 
+  4, 180, 1, 57, 32, 179, 1, 150, 1, 0, 57, 4, 179, 1, 57, 32, 180, 1, 150, 1, 
+  0, 57, 4, 180, 1, 57, 32, 179, 1, 150, 1, 0, 57, 4, 179, 1, 57, 32, 180, 1, 
+  150, 1, 0, 57, 4, 180, 1, 57, 32, 179, 1, 150, 1, 0, 57, 4, 179, 1, 57, 32, 
+  180, 1, 150, 1, 0, 57, 4, 180, 1, 57, 32, 179, 1, 150, 1, 0, 57, 4, 179, 1, 
+  57, 32, 180, 1, 150, 1, 0, 57, 4, 180, 1, 57, 32, 179, 1, 150, 1, 0, 0, 192, 
+  45, 48, 36, 48, 36, 18, 250, 1, 0, 0, 128, 32, 5, 250, 1, 0, 0, 128, 32, 11, 
+  19, 40, 1, 39, 40, 8, 40, 172, 2, 0, 10, 2, 39, 40, 16, 190, 1, 150, 1, 0, 
+  48, 4, 29, 156, 1, 32, 119, 144, 3, 0, 18, 1, 49, 18, 8, 50, 200, 1, 0, 120, 
+  1, 110, 120, 8, 109, 144, 3, 0, 0, 192, 45, 32, 24, 32, 24, 10, 172, 2, 0, 0, 
+  128, 32, 9, 200, 1, 0, 121, 68, 1, 159, 1, 36, 2, 79, 96, 4, 229, 1, 6, 0, 
+  42, 16, 60, 42, 32, 59, 172, 2, 0, 102, 1, 160, 1, 108, 2, 170, 1, 90, 4, 140, 
+  1, 68, 8, 160, 1, 72, 16, 170, 1, 60, 32, 140, 1, 172, 2, 0, 68, 1, 159, 1, 
+  72, 2, 169, 1, 60, 4, 139, 1, 102, 8, 159, 1, 108, 16, 169, 1, 90, 32, 139, 1, 
+  172, 2, 0, 102, 1, 160, 1, 108, 2, 170, 1, 90, 4, 140, 1, 68, 8, 160, 1, 72, 
+  16, 170, 1, 60, 32, 140, 1, 172, 2, 0, 68, 1, 159, 1, 72, 2, 169, 1, 60, 4, 
+  139, 1, 102, 8, 159, 1, 108, 16, 169, 1, 90, 32, 139, 1, 172, 2, 0, 102, 1, 160, 
+  1, 108, 2, 170, 1, 90, 4, 140, 1, 68, 8, 160, 1, 72, 16, 170, 1, 60, 32, 140, 
+  1, 172, 2, 0, 68, 1, 159, 1, 72, 2, 169, 1, 60, 4, 139, 1, 102, 8, 159, 1, 
+  108, 16, 169, 1, 90, 32, 139, 1, 172, 2, 0, 102, 1, 160, 1, 108, 2, 170, 1, 90, 
+  4, 140, 1, 68, 8, 160, 1, 72, 16, 170, 1, 60, 32, 140, 1, 172, 2, 0, 68, 1, 
+  159, 1, 72, 2, 169, 1, 60, 4, 139, 1, 102, 8, 159, 1, 108, 16, 169, 1, 90, 32, 
+  139, 1, 172, 2, 0, 102, 1, 160, 1, 108, 2, 170, 1, 90, 4, 140, 1, 68, 8, 160, 
+  1, 72, 16, 170, 1, 60, 32, 140, 1, 172, 2, 0, 68, 1, 159, 1, 72, 2, 169, 1, 
+  60, 4, 139, 1, 102, 8, 159, 1, 108, 16, 169, 1, 90, 32, 139, 1, 172, 2, 0, 102, 
+  1, 160, 1, 108, 2, 170, 1, 90, 4, 140, 1, 68, 8, 160, 1, 72, 16, 170, 1, 60, 
+  32, 140, 1, 172, 2, 0, 68, 1, 159, 1, 72, 2, 169, 1, 60, 4, 139, 1, 102, 8, 
+  159, 1, 108, 16, 169, 1, 90, 32, 139, 1, 172, 2, 0, 102, 1, 160, 1, 108, 2, 170, 
+  1, 90, 4, 140, 1, 68, 8, 160, 1, 72, 16, 170, 1, 60, 32, 140, 1, 172, 2, 0, 
+  68, 1, 159, 1, 72, 2, 169, 1, 60, 4, 139, 1, 102, 8, 159, 1, 108, 16, 169, 1, 
+  90, 32, 139, 1, 172, 2, 0, 102, 1, 160, 1, 108, 2, 170, 1, 90, 4, 140, 1, 68, 
+  8, 160, 1, 72, 16, 170, 1, 60, 32, 140, 1, 172, 2, 0, 0, 192, 4, 50, 10, 144, 
+  3, 0, 0, 192, 4, 39, 40, 144, 3, 0, 0, 128, 32, 12, 144, 3, 0, 0, 128, 32, 
+  6, 144, 3, 0, 0, 128, 32, 17, 36, 80, 1, 29, 80, 8, 30, 40, 2, 10, 172, 2, 
+  16, 140, 1, 160, 6, 0, 240, 1, 4, 149, 1, 231, 4, 0, 195, 1, 4, 120, 195, 1, 
+  32, 119, 216, 4, 0, 180, 1, 4, 109, 180, 1, 32, 110, 216, 4, 0, 165, 1, 4, 100, 
+  165, 1, 32, 99, 216, 4, 0, 150, 1, 4, 89, 150, 1, 32, 90, 216, 4, 0, 135, 1, 
+  4, 80, 135, 1, 32, 79, 216, 4, 0, 120, 4, 69, 120, 32, 70, 216, 4, 0, 105, 4, 
+  60, 105, 32, 59, 216, 4, 0, 0, 192, 4, 20, 28, 244, 3, 0, 0, 192, 4, 8, 7, 
+  244, 3, 0, 0, 128, 32, 10, 180, 1, 0, 0, 128, 32, 9, 164, 3, 0, 63, 33, 1, 
+  19, 33, 8, 20, 11, 0, 176, 1, 16, 150, 1, 121, 4, 99, 55, 32, 39, 204, 3, 0, 
+  30, 1, 19, 30, 8, 20, 20, 2, 9, 20, 16, 10, 20, 4, 9, 174, 3, 0, 27, 1, 
+  19, 27, 8, 20, 18, 2, 9, 18, 16, 10, 18, 4, 9, 18, 32, 10, 252, 2, 0, 24, 
+  1, 19, 24, 8, 20, 16, 2, 9, 16, 16, 10, 16, 4, 9, 16, 32, 10, 212, 2, 0, 
+  21, 1, 19, 21, 8, 20, 14, 2, 9, 14, 16, 10, 21, 4, 19, 21, 32, 20, 172, 2, 
+  0, 18, 1, 19, 18, 8, 20, 12, 0, 12, 4, 9, 12, 32, 10, 132, 2, 0, 15, 1, 
+  19, 15, 8, 20, 10, 2, 9, 10, 16, 10, 10, 4, 9, 10, 32, 10, 220, 1, 0, 12, 
+  1, 19, 12, 8, 20, 8, 2, 9, 8, 16, 10, 8, 4, 9, 8, 32, 10, 200, 1, 0, 
+  20, 2, 9, 20, 16, 10, 40, 4, 29, 40, 32, 30, 144, 3, 0, 0, 192, 63, 56, 44, 
+  36, 56, 44, 36, 20, 172, 2, 0, 0, 128, 32, 19, 100, 0, 139, 1, 10, 1, 89, 11, 
+  8, 99, 12, 2, 110, 24, 16, 230, 1, 4, 4, 30, 18, 32, 169, 1, 90, 0, 10, 1, 
+  89, 24, 8, 230, 1, 11, 2, 100, 24, 16, 229, 1, 25, 4, 239, 1, 18, 32, 170, 1, 
+  90, 0, 26, 1, 250, 1, 17, 8, 159, 1, 24, 2, 229, 1, 3, 16, 20, 5, 4, 40, 
+  5, 32, 40, 90, 0, 2, 1, 10, 1, 0, 26, 2, 250, 1, 14, 16, 129, 1, 8, 4, 
+  70, 3, 32, 20, 90, 0, 3, 1, 19, 1, 0, 25, 2, 239, 1, 6, 16, 50, 13, 4, 
+  119, 2, 32, 10, 90, 0, 11, 1, 100, 9, 8, 80, 22, 2, 210, 1, 24, 16, 230, 1, 
+  22, 4, 210, 1, 2, 32, 9, 90, 0, 21, 1, 199, 1, 10, 8, 90, 22, 2, 209, 1, 
+  21, 16, 199, 1, 5, 4, 39, 15, 32, 139, 1, 90, 0, 8, 1, 70, 13, 8, 119, 20, 
+  2, 190, 1, 19, 16, 180, 1, 19, 4, 179, 1, 13, 32, 120, 90, 0, 9, 1, 80, 15, 
+  8, 140, 1, 20, 2, 189, 1, 2, 16, 9, 18, 4, 170, 1, 9, 32, 79, 90, 0, 9, 
+  1, 79, 1, 0, 6, 2, 50, 3, 16, 20, 4, 4, 30, 16, 32, 149, 1, 90, 0, 4, 
+  1, 30, 12, 8, 109, 23, 2, 220, 1, 1, 0, 3, 4, 20, 26, 32, 250, 1, 90, 0, 
+  21, 1, 199, 1, 8, 8, 70, 32, 2, 181, 2, 7, 16, 59, 20, 4, 189, 1, 2, 32, 
+  10, 90, 0, 6, 1, 50, 5, 8, 40, 13, 2, 120, 11, 16, 99, 12, 4, 110, 9, 32, 
+  79, 90, 0, 5, 1, 39, 5, 8, 39, 8, 2, 70, 1, 0, 11, 4, 99, 5, 32, 39, 
+  90, 0, 6, 1, 50, 16, 8, 149, 1, 8, 2, 70, 23, 16, 220, 1, 16, 4, 150, 1, 
+  5, 32, 40, 90, 0, 0, 192, 13, 14, 20, 48, 24, 150, 1, 0, 0, 192, 13, 12, 36, 
+  8, 16, 150, 1, 0, 0, 192, 13, 32, 17, 5, 17, 150, 1, 0, 0, 192, 13, 29, 6, 
+  7, 28, 150, 1, 0, 0, 192, 13, 10, 14, 23, 11, 150, 1, 0, 0, 192, 13, 21, 17, 
+  44, 12, 150, 1, 0, 0, 192, 13, 14, 18, 7, 21, 150, 1, 0, 0, 192, 13, 6, 35, 
+  6, 6, 150, 1, 0, 0, 128, 32, 20, 50, 0, 0, 128, 32, 0, 50, 0, 0, 128, 32, 
+  0, 50, 0, 0, 128, 32, 0, 50, 0, 0, 128, 32, 0, 50, 0, 0, 128, 32, 0, 50, 
+  0, 0, 128, 32, 0, 50, 0, 0, 128, 32, 0, 60, 0, 0, 128, 32, 19, 162, 2, 0, 
+  176, 1, 32, 1, 149, 1, 32, 8, 150, 1, 16, 2, 69, 46, 16, 220, 1, 46, 4, 219, 
+  1, 16, 32, 70, 140, 1, 0, 62, 1, 172, 2, 62, 8, 171, 2, 66, 2, 192, 2, 66, 
+  16, 191, 2, 54, 4, 132, 2, 54, 32, 131, 2, 140, 1, 0, 62, 1, 171, 2, 62, 8, 
+  172, 2, 66, 2, 191, 2, 66, 16, 192, 2, 54, 4, 131, 2, 54, 32, 132, 2, 140, 1, 
+  0, 62, 1, 172, 2, 62, 8, 171, 2, 66, 2, 192, 2, 66, 16, 191, 2, 54, 4, 132, 
+  2, 54, 32, 131, 2, 140, 1, 0, 62, 1, 171, 2, 62, 8, 172, 2, 66, 2, 191, 2, 
+  66, 16, 192, 2, 54, 4, 131, 2, 54, 32, 132, 2, 140, 1, 0, 62, 1, 172, 2, 62, 
+  8, 171, 2, 66, 2, 192, 2, 66, 16, 191, 2, 54, 4, 132, 2, 54, 32, 131, 2, 140, 
+  1, 0, 62, 1, 171, 2, 62, 8, 172, 2, 66, 2, 191, 2, 66, 16, 192, 2, 54, 4, 
+  131, 2, 54, 32, 132, 2, 140, 1, 0, 62, 1, 172, 2, 62, 8, 171, 2, 66, 2, 192, 
+  2, 66, 16, 191, 2, 54, 4, 132, 2, 54, 32, 131, 2, 140, 1, 0, 62, 1, 171, 2, 
+  62, 8, 172, 2, 66, 2, 191, 2, 66, 16, 192, 2, 54, 4, 131, 2, 54, 32, 132, 2, 
+  140, 1, 0, 62, 1, 172, 2, 62, 8, 171, 2, 66, 2, 192, 2, 66, 16, 191, 2, 54, 
+  4, 132, 2, 54, 32, 131, 2, 140, 1, 0, 62, 1, 171, 2, 62, 8, 172, 2, 66, 2, 
+  191, 2, 66, 16, 192, 2, 54, 4, 131, 2, 54, 32, 132, 2, 140, 1, 0, 62, 1, 172, 
+  2, 62, 8, 171, 2, 66, 2, 192, 2, 66, 16, 191, 2, 54, 4, 132, 2, 54, 32, 131, 
+  2, 140, 1, 0, 62, 1, 171, 2, 62, 8, 172, 2, 66, 2, 191, 2, 66, 16, 192, 2, 
+  54, 4, 131, 2, 54, 32, 132, 2, 140, 1, 0, 62, 1, 172, 2, 62, 8, 171, 2, 66, 
+  2, 192, 2, 66, 16, 191, 2, 54, 4, 132, 2, 54, 32, 131, 2, 140, 1, 0, 62, 1, 
+  171, 2, 62, 8, 172, 2, 66, 2, 191, 2, 66, 16, 192, 2, 54, 4, 131, 2, 54, 32, 
+  132, 2, 140, 1, 0, 62, 1, 172, 2, 62, 8, 171, 2, 66, 2, 192, 2, 66, 16, 191, 
+  2, 54, 4, 132, 2, 54, 32, 131, 2, 140, 1, 0, 62, 1, 171, 2, 62, 8, 172, 2, 
+  66, 2, 191, 2, 66, 16, 192, 2, 54, 4, 131, 2, 54, 32, 132, 2, 140, 1, 0, 62, 
+  1, 172, 2, 62, 8, 171, 2, 66, 2, 192, 2, 66, 16, 191, 2, 54, 4, 132, 2, 54, 
+  32, 131, 2, 140, 1, 0, 62, 1, 171, 2, 62, 8, 172, 2, 66, 2, 191, 2, 66, 16, 
+  192, 2, 54, 4, 131, 2, 54, 32, 132, 2, 140, 1, 0, 62, 1, 172, 2, 62, 8, 171, 
+  2, 66, 2, 192, 2, 66, 16, 191, 2, 54, 4, 132, 2, 54, 32, 131, 2, 140, 1, 0, 
+  62, 1, 171, 2, 62, 8, 172, 2, 66, 2, 191, 2, 66, 16, 192, 2, 54, 4, 131, 2, 
+  54, 32, 132, 2, 140, 1, 0, 62, 1, 172, 2, 62, 8, 171, 2, 66, 2, 192, 2, 66, 
+  16, 191, 2, 54, 4, 132, 2, 54, 32, 131, 2, 140, 1, 0, 62, 1, 171, 2, 62, 8, 
+  172, 2, 66, 2, 191, 2, 66, 16, 192, 2, 54, 4, 131, 2, 54, 32, 132, 2, 140, 1, 
+  0, 62, 1, 172, 2, 62, 8, 171, 2, 66, 2, 192, 2, 66, 16, 191, 2, 54, 4, 132, 
+  2, 54, 32, 131, 2, 140, 1, 0, 0, 192, 13, 52, 40, 40, 48, 150, 1, 0, 0, 192, 
+  45, 11, 8, 12, 7, 10, 180, 1, 0, 0, 128, 32, 10, 180, 1, 0, 0, 128, 32, 19, 
+  200, 1, 0, 24, 60, 1, 89, 60, 8, 90, 24, 2, 29, 114, 16, 180, 1, 172, 2, 0, 
+  12, 4, 29, 39, 32, 119, 200, 1, 0, 156, 1, 4, 119, 156, 1, 32, 120, 144, 3, 0, 
+  112, 1, 130, 1, 112, 8, 129, 1, 172, 2, 0, 27, 1, 79, 27, 8, 80, 150, 1, 0, 
+  56, 1, 60, 56, 8, 59, 144, 3, 0, 0, 192, 45, 36, 28, 36, 28, 10, 222, 2, 0, 
+  0, 128, 32, 9, 50, 0, 46, 91, 1, 119, 91, 8, 120, 35, 2, 39, 140, 1, 16, 190, 
+  1, 144, 3, 0, 66, 4, 209, 1, 21, 32, 60, 200, 1, 0, 36, 1, 30, 36, 8, 29, 
+  18, 2, 10, 18, 16, 9, 244, 3, 0, 16, 4, 30, 16, 32, 29, 250, 1, 0, 44, 1, 
+  30, 44, 8, 29, 22, 2, 10, 22, 16, 9, 216, 4, 0, 20, 4, 30, 20, 32, 29, 172, 
+  2, 0, 52, 1, 30, 52, 8, 29, 26, 2, 10, 26, 16, 9, 188, 5, 0, 24, 4, 30, 
+  24, 32, 29, 222, 2, 0, 0, 192, 4, 44, 44, 172, 2, 0, 0, 192, 4, 7, 7, 144, 
+  3, 0, 0, 192, 4, 7, 7, 244, 3, 0, 0, 128, 32, 10, 200, 1, 0, 0, 128, 32, 
+  9, 100, 0, 0, 128, 32, 10, 100, 0, 0, 128, 32, 9, 144, 3, 0, 86, 28, 1, 129, 
+  1, 26, 8, 120, 14, 2, 59, 38, 16, 180, 1, 44, 4, 209, 1, 8, 32, 30, 130, 1, 
+  0, 6, 1, 19, 6, 8, 20, 8, 2, 30, 8, 16, 30, 6, 4, 20, 4, 32, 10, 130, 
+  1, 0, 4, 1, 10, 4, 0, 4, 16, 9, 6, 4, 20, 4, 32, 10, 130, 1, 0, 4, 
+  1, 10, 2, 0, 6, 2, 19, 4, 0, 8, 32, 29, 130, 1, 0, 6, 1, 19, 4, 8, 
+  9, 2, 0, 6, 16, 19, 10, 4, 39, 10, 32, 40, 132, 1, 0, 4, 8, 9, 4, 0, 
+  6, 4, 20, 10, 32, 39, 130, 1, 0, 6, 1, 20, 4, 8, 10, 8, 2, 30, 4, 0, 
+  10, 32, 40, 130, 1, 0, 6, 1, 19, 4, 0, 6, 16, 20, 6, 4, 19, 12, 32, 49, 
+  136, 1, 0, 6, 16, 19, 12, 4, 50, 132, 1, 0, 6, 1, 20, 8, 8, 29, 6, 2, 
+  19, 6, 16, 20, 8, 4, 29, 8, 32, 30, 130, 1, 0, 0, 192, 13, 48, 36, 32, 44, 
+  200, 1, 0, 0, 192, 45, 15, 8, 16, 7, 20, 90, 0, 0, 128, 32, 19, 10, 0, 0, 
+  128, 32, 20, 90, 0, 0, 128, 32, 19, 10, 0, 0, 128, 32, 20, 90, 0, 0, 128, 32, 
+  19, 10, 0, 0, 128, 32, 20, 90, 0, 0, 128, 32, 19, 10, 0, 0, 128, 32, 20, 90, 
+  0, 0, 128, 32, 19, 10, 0, 0, 128, 32, 20, 90, 0, 0, 128, 32, 19, 182, 2, 0, 
+  65, 48, 1, 29, 48, 8, 30, 12, 0, 192, 1, 16, 150, 1, 244, 3, 0, 48, 4, 49, 
+  88, 32, 99, 172, 2, 0, 4, 4, 10, 4, 32, 9, 100, 0, 24, 4, 19, 24, 32, 20, 
+  172, 2, 0, 16, 4, 10, 16, 32, 9, 172, 2, 0, 4, 4, 10, 4, 32, 9, 100, 0, 
+  24, 4, 19, 24, 32, 20, 172, 2, 0, 16, 4, 10, 16, 32, 9, 172, 2, 0, 4, 4, 
+  10, 4, 32, 9, 100, 0, 24, 4, 19, 24, 32, 20, 172, 2, 0, 16, 4, 10, 16, 32, 
+  9, 172, 2, 0, 4, 4, 10, 4, 32, 9, 100, 0, 24, 4, 19, 24, 32, 20, 172, 2, 
+  0, 16, 4, 10, 16, 32, 9, 172, 2, 0, 4, 4, 10, 4, 32, 9, 100, 0, 24, 4, 
+  19, 24, 32, 20, 172, 2, 0, 16, 4, 10, 16, 32, 9, 172, 2, 0, 4, 4, 10, 4, 
+  32, 9, 100, 0, 24, 4, 19, 24, 32, 20, 172, 2, 0, 0, 192, 45, 28, 20, 28, 20, 
+  10, 200, 1, 0, 0, 128, 32, 0, 50, 0, 0, 128, 32, 9, 222, 2, 0, 43, 104, 1, 
+  119, 104, 8, 120, 32, 2, 29, 152, 1, 16, 180, 1, 250, 1, 0, 64, 4, 149, 1, 154, 
+  1, 0, 30, 1, 20, 30, 8, 19, 242, 2, 0, 10, 4, 10, 10, 32, 9, 150, 1, 0, 
+  36, 1, 20, 36, 8, 19, 218, 3, 0, 12, 4, 10, 12, 32, 9, 150, 1, 0, 42, 1, 
+  20, 42, 8, 19, 28, 2, 10, 28, 16, 9, 166, 4, 0, 14, 4, 10, 14, 32, 9, 150, 
+  1, 0, 48, 1, 20, 48, 8, 19, 170, 5, 0, 54, 1, 20, 54, 8, 19, 36, 2, 10, 
+  36, 16, 9, 238, 5, 0, 0, 192, 4, 32, 32, 172, 2, 0, 0, 192, 4, 7, 7, 144, 
+  3, 0, 0, 192, 36, 7, 7, 20, 250, 1, 0, 0, 128, 32, 19, 222, 2, 0, 54, 60, 
+  1, 39, 60, 8, 40, 144, 3, 0, 108, 1, 80, 108, 8, 79, 144, 3, 0, 117, 1, 79, 
+  117, 8, 80, 244, 3, 0, 117, 1, 80, 117, 8, 79, 244, 3, 0, 112, 1, 69, 112, 8, 
+  70, 216, 4, 0, 98, 1, 60, 98, 8, 59, 216, 4, 0, 105, 1, 59, 105, 8, 60, 188, 
+  5, 0, 105, 1, 60, 105, 8, 59, 188, 5, 0, 96, 1, 49, 96, 8, 50, 160, 6, 0, 
+  80, 1, 40, 80, 8, 39, 160, 6, 0, 68, 1, 29, 68, 8, 30, 132, 7, 0, 51, 1, 
+  20, 51, 8, 19, 132, 7, 0, 54, 1, 19, 54, 8, 20, 232, 7, 0, 54, 1, 20, 54, 
+  8, 19, 232, 7, 0, 38, 1, 9, 38, 8, 10, 190, 17, 0, 60, 2, 30, 195, 1, 16, 
+  120, 105, 4, 59, 150, 1, 32, 89, 216, 4, 0, 0, 192, 63, 12, 8, 6, 12, 8, 6, 
+  20, 180, 1, 0, 0, 128, 32, 19, 192, 2, 0, 43, 54, 1, 19, 54, 8, 20, 36, 2, 
+  10, 142, 2, 16, 140, 1, 188, 5, 0, 90, 1, 50, 90, 8, 49, 45, 4, 19, 210, 1, 
+  32, 129, 1, 216, 4, 0, 200, 1, 1, 89, 200, 1, 8, 90, 200, 1, 4, 89, 200, 1, 
+  32, 90, 160, 6, 0, 24, 1, 10, 24, 8, 9, 144, 3, 0, 36, 1, 20, 36, 8, 19, 
+  144, 3, 0, 36, 1, 19, 36, 8, 20, 144, 3, 0, 36, 1, 20, 36, 8, 19, 144, 3, 
+  0, 36, 1, 19, 36, 8, 20, 144, 3, 0, 36, 1, 20, 36, 8, 19, 144, 3, 0, 36, 
+  1, 19, 36, 8, 20, 144, 3, 0, 36, 1, 20, 36, 8, 19, 144, 3, 0, 0, 192, 45, 
+  16, 10, 16, 10, 10, 150, 1, 0, 0, 128, 32, 9, 194, 3, 0, 9, 100, 1, 29, 100, 
+  8, 30, 25, 0, 144, 3, 16, 150, 1, 250, 1, 4, 89, 175, 1, 32, 59, 152, 59, 0, 
+  0, 192, 31, 10, 6, 4, 10, 6, 4, 220, 11, 0
+};
+const uint16_t STEREO_STEP_OFFSETS[] PROGMEM = {
+  0, 50, 148, 331, 599, 908, 987, 1102, 1372, 1607, 1918, 1998, 
+  2151, 2474, 3020, 3086, 3548, 3677, 3874, 4340, 5023, 5106, 5256, 5520, 
+  5717, 5858, 6031, 6175
+};
+
+// Faded - 30 steps, 4932 bytes
+const uint8_t FADED_TRACKS[] PROGMEM = {
+  30, 40, 1, 9, 40, 8, 10, 40, 2, 10, 172, 2, 16, 140, 1, 160, 6, 0, 150, 1, 
+  4, 49, 147, 2, 32, 99, 188, 5, 0, 30, 1, 9, 30, 8, 10, 216, 4, 0, 75, 1, 
+  40, 75, 8, 39, 216, 4, 0, 75, 1, 39, 75, 8, 40, 216, 4, 0, 75, 1, 40, 75, 
+  8, 39, 216, 4, 0, 75, 1, 39, 75, 8, 40, 216, 4, 0, 75, 1, 40, 75, 8, 39, 
+  216, 4, 0, 0, 192, 63, 12, 8, 6, 12, 8, 6, 10, 150, 1, 0, 0, 128, 32, 9, 
+  138, 5, 0, 17, 90, 1, 39, 90, 8, 40, 54, 2, 19, 196, 2, 16, 170, 1, 188, 5, 
+  0, 60, 2, 40, 60, 16, 39, 30, 4, 9, 225, 1, 32, 139, 1, 244, 3, 0, 96, 1, 
+  49, 96, 8, 50, 216, 4, 0, 0, 192, 45, 16, 12, 20, 16, 20, 120, 0, 0, 128, 32, 
+  19, 224, 3, 0, 19, 98, 1, 59, 98, 8, 60, 56, 2, 29, 138, 2, 16, 180, 1, 216, 
+  4, 0, 120, 1, 90, 120, 8, 89, 36, 4, 19, 168, 1, 32, 129, 1, 244, 3, 0, 64, 
+  1, 29, 64, 8, 30, 128, 1, 4, 69, 128, 1, 32, 70, 144, 3, 0, 0, 192, 45, 24, 
+  16, 24, 16, 10, 200, 1, 0, 0, 128, 32, 9, 172, 2, 0, 29, 60, 1, 39, 60, 8, 
+  40, 24, 2, 9, 204, 1, 16, 160, 1, 144, 3, 0, 24, 1, 10, 24, 8, 9, 168, 3, 
+  0, 24, 1, 10, 24, 8, 9, 24, 2, 10, 24, 16, 9, 144, 3, 0, 24, 1, 10, 24, 
+  8, 9, 168, 3, 0, 160, 2, 4, 149, 1, 234, 4, 0, 234, 1, 4, 120, 234, 1, 32, 
+  119, 216, 4, 0, 0, 192, 4, 20, 28, 144, 3, 0, 0, 192, 4, 8, 7, 144, 3, 0, 
+  0, 128, 32, 18, 172, 2, 0, 0, 128, 32, 17, 144, 3, 0, 32, 28, 1, 9, 28, 8, 
+  10, 14, 0, 224, 1, 16, 150, 1, 184, 3, 0, 39, 1, 19, 39, 8, 20, 26, 2, 9, 
+  26, 16, 10, 252, 2, 0, 24, 1, 9, 24, 8, 10, 24, 2, 9, 24, 16, 10, 192, 2, 
+  0, 33, 1, 19, 33, 8, 20, 22, 2, 9, 22, 16, 10, 132, 2, 0, 30, 1, 19, 30, 
+  8, 20, 20, 2, 9, 20, 16, 10, 200, 1, 0, 160, 1, 4, 189, 1, 40, 32, 40, 144, 
+  3, 0, 0, 192, 45, 32, 24, 32, 24, 20, 250, 1, 0, 0, 128, 32, 19, 150, 1, 0, 
+  70, 36, 1, 110, 15, 8, 39, 15, 2, 40, 33, 16, 100, 18, 4, 49, 18, 32, 49, 130, 
+  1, 0, 69, 1, 219, 1, 6, 8, 10, 3, 0, 33, 16, 99, 24, 4, 70, 39, 32, 119, 
+  130, 1, 0, 33, 1, 100, 33, 8, 99, 3, 0, 54, 16, 170, 1, 42, 4, 129, 1, 9, 
+  32, 20, 130, 1, 0, 30, 1, 89, 18, 8, 50, 12, 2, 29, 3, 0, 21, 4, 59, 48, 
+  32, 150, 1, 130, 1, 0, 12, 1, 30, 48, 8, 150, 1, 12, 2, 30, 63, 16, 199, 1, 
+  18, 4, 50, 6, 32, 9, 130, 1, 0, 45, 1, 140, 1, 15, 8, 40, 57, 2, 180, 1, 
+  36, 16, 110, 9, 4, 20, 12, 32, 30, 130, 1, 0, 30, 1, 89, 6, 8, 10, 6, 2, 
+  10, 30, 16, 89, 6, 4, 9, 45, 32, 139, 1, 130, 1, 0, 30, 1, 89, 60, 8, 189, 
+  1, 3, 0, 63, 16, 200, 1, 12, 4, 30, 27, 32, 80, 130, 1, 0, 0, 192, 13, 44, 
+  32, 36, 40, 150, 1, 0, 0, 192, 45, 7, 8, 8, 7, 20, 80, 0, 0, 128, 32, 0, 
+  80, 0, 0, 128, 32, 0, 80, 0, 0, 128, 32, 0, 80, 0, 0, 128, 32, 0, 90, 0, 
+  0, 128, 32, 19, 190, 1, 0, 33, 48, 1, 29, 48, 8, 30, 172, 2, 0, 52, 2, 29, 
+  247, 1, 16, 180, 1, 142, 2, 4, 169, 1, 45, 32, 20, 196, 2, 0, 28, 4, 10, 28, 
+  32, 9, 144, 3, 0, 22, 2, 10, 22, 16, 9, 39, 4, 20, 39, 32, 19, 136, 4, 0, 
+  24, 4, 10, 24, 32, 9, 216, 4, 0, 18, 2, 10, 18, 16, 9, 33, 4, 20, 33, 32, 
+  19, 188, 5, 0, 75, 2, 40, 75, 16, 39, 45, 4, 20, 45, 32, 19, 244, 3, 0, 0, 
+  192, 45, 28, 20, 28, 20, 10, 180, 1, 0, 0, 128, 32, 9, 164, 3, 0, 19, 60, 1, 
+  19, 60, 8, 20, 40, 2, 10, 172, 2, 16, 140, 1, 160, 6, 0, 64, 1, 29, 64, 8, 
+  30, 108, 4, 49, 198, 1, 32, 99, 188, 5, 0, 98, 1, 60, 98, 8, 59, 144, 1, 4, 
+  79, 144, 1, 32, 80, 216, 4, 0, 0, 192, 45, 22, 14, 26, 18, 20, 160, 1, 0, 0, 
+  128, 32, 19, 156, 4, 0, 38, 54, 1, 19, 54, 8, 20, 20, 0, 192, 2, 16, 150, 1, 
+  216, 4, 0, 54, 1, 20, 54, 8, 19, 128, 5, 0, 54, 1, 19, 54, 8, 20, 128, 5, 
+  0, 54, 1, 20, 54, 8, 19, 40, 2, 10, 40, 16, 9, 216, 4, 0, 54, 1, 19, 54, 
+  8, 20, 128, 5, 0, 54, 1, 20, 54, 8, 19, 40, 2, 10, 40, 16, 9, 216, 4, 0, 
+  136, 2, 4, 109, 110, 32, 39, 160, 6, 0, 110, 4, 40, 110, 32, 39, 160, 6, 0, 0, 
+  192, 4, 16, 24, 244, 3, 0, 0, 192, 4, 8, 7, 244, 3, 0, 0, 128, 32, 10, 120, 
+  0, 0, 128, 32, 9, 168, 5, 0, 49, 22, 1, 9, 22, 8, 10, 11, 0, 176, 1, 16, 
+  150, 1, 143, 1, 4, 99, 78, 32, 49, 232, 2, 0, 20, 1, 9, 20, 8, 10, 20, 2, 
+  9, 20, 16, 10, 24, 4, 9, 24, 32, 10, 192, 2, 0, 27, 1, 19, 27, 8, 20, 18, 
+  0, 22, 4, 9, 22, 32, 10, 152, 2, 0, 16, 1, 9, 16, 8, 10, 16, 2, 9, 16, 
+  16, 10, 20, 4, 9, 20, 32, 10, 240, 1, 0, 21, 1, 19, 21, 8, 20, 14, 2, 9, 
+  14, 16, 10, 18, 4, 9, 18, 32, 10, 200, 1, 0, 12, 1, 9, 12, 8, 10, 12, 0, 
+  16, 4, 9, 16, 32, 10, 160, 1, 0, 40, 1, 29, 40, 8, 30, 20, 2, 9, 20, 16, 
+  10, 172, 2, 0, 0, 192, 45, 40, 32, 40, 32, 20, 172, 2, 0, 0, 128, 32, 19, 100, 
+  0, 94, 24, 1, 110, 28, 8, 130, 1, 28, 2, 130, 1, 16, 16, 70, 10, 4, 39, 8, 
+  32, 30, 110, 0, 48, 1, 229, 1, 40, 8, 189, 1, 10, 2, 40, 30, 16, 140, 1, 4, 
+  4, 9, 20, 32, 89, 110, 0, 28, 1, 130, 1, 16, 8, 69, 14, 2, 60, 38, 16, 179, 
+  1, 16, 4, 69, 18, 32, 80, 112, 0, 30, 8, 140, 1, 10, 2, 39, 18, 16, 80, 8, 
+  4, 29, 32, 32, 149, 1, 110, 0, 28, 1, 129, 1, 6, 8, 19, 36, 2, 169, 1, 6, 
+  16, 20, 6, 4, 19, 28, 32, 130, 1, 110, 0, 36, 1, 170, 1, 12, 8, 50, 16, 2, 
+  69, 2, 0, 22, 4, 100, 26, 32, 119, 110, 0, 10, 1, 39, 8, 8, 29, 56, 2, 142, 
+  2, 8, 16, 30, 2, 0, 4, 32, 9, 110, 0, 12, 1, 49, 22, 8, 99, 14, 2, 59, 
+  40, 16, 189, 1, 12, 4, 49, 24, 32, 110, 110, 0, 4, 1, 10, 44, 8, 210, 1, 42, 
+  2, 199, 1, 2, 0, 14, 4, 60, 20, 32, 89, 110, 0, 20, 1, 89, 4, 8, 9, 4, 
+  2, 9, 22, 16, 100, 26, 4, 119, 112, 0, 0, 192, 13, 50, 40, 36, 42, 140, 1, 0, 
+  0, 192, 13, 7, 4, 10, 2, 140, 1, 0, 0, 192, 13, 4, 3, 7, 1, 140, 1, 0, 
+  0, 192, 13, 4, 13, 3, 7, 140, 1, 0, 0, 192, 13, 13, 8, 6, 2, 140, 1, 0, 
+  0, 192, 13, 16, 7, 1, 7, 140, 1, 0, 0, 128, 32, 20, 60, 0, 0, 128, 32, 0, 
+  60, 0, 0, 128, 32, 0, 60, 0, 0, 128, 32, 0, 60, 0, 0, 128, 32, 0, 60, 0, 
+  0, 128, 32, 0, 70, 0, 0, 128, 32, 19, 240, 1, 0, 122, 20, 1, 39, 20, 8, 40, 
+  12, 2, 19, 72, 16, 170, 1, 160, 1, 0, 20, 1, 40, 20, 8, 39, 12, 2, 20, 12, 
+  16, 19, 160, 1, 0, 20, 1, 39, 20, 8, 40, 12, 2, 19, 12, 16, 20, 160, 1, 0, 
+  20, 1, 40, 20, 8, 39, 12, 2, 20, 12, 16, 19, 160, 1, 0, 20, 1, 39, 20, 8, 
+  40, 12, 2, 19, 12, 16, 20, 160, 1, 0, 20, 1, 40, 20, 8, 39, 12, 2, 20, 12, 
+  16, 19, 160, 1, 0, 20, 1, 39, 20, 8, 40, 12, 2, 19, 12, 16, 20, 160, 1, 0, 
+  20, 1, 40, 20, 8, 39, 12, 2, 20, 12, 16, 19, 160, 1, 0, 20, 1, 39, 20, 8, 
+  40, 12, 2, 19, 12, 16, 20, 160, 1, 0, 20, 1, 40, 20, 8, 39, 12, 2, 20, 12, 
+  16, 19, 160, 1, 0, 20, 1, 39, 20, 8, 40, 12, 2, 19, 12, 16, 20, 160, 1, 0, 
+  20, 1, 40, 20, 8, 39, 12, 2, 20, 12, 16, 19, 160, 1, 0, 20, 1, 39, 20, 8, 
+  40, 12, 2, 19, 12, 16, 20, 160, 1, 0, 20, 1, 40, 20, 8, 39, 12, 2, 20, 12, 
+  16, 19, 160, 1, 0, 20, 1, 39, 20, 8, 40, 12, 2, 19, 12, 16, 20, 160, 1, 0, 
+  20, 1, 40, 20, 8, 39, 12, 2, 20, 12, 16, 19, 160, 1, 0, 42, 4, 129, 1, 9, 
+  32, 19, 120, 0, 27, 4, 80, 27, 32, 79, 120, 0, 27, 4, 79, 27, 32, 80, 120, 0, 
+  27, 4, 80, 27, 32, 79, 120, 0, 27, 4, 79, 27, 32, 80, 120, 0, 27, 4, 80, 27, 
+  32, 79, 120, 0, 27, 4, 79, 27, 32, 80, 120, 0, 27, 4, 80, 27, 32, 79, 120, 0, 
+  27, 4, 79, 27, 32, 80, 120, 0, 27, 4, 80, 27, 32, 79, 120, 0, 27, 4, 79, 27, 
+  32, 80, 120, 0, 27, 4, 80, 27, 32, 79, 120, 0, 0, 192, 4, 36, 36, 200, 1, 0, 
+  0, 192, 36, 11, 11, 10, 200, 1, 0, 0, 128, 32, 9, 172, 2, 0, 43, 64, 1, 29, 
+  64, 8, 30, 36, 2, 9, 178, 2, 16, 160, 1, 216, 4, 0, 56, 1, 29, 56, 8, 30, 
+  64, 4, 29, 208, 1, 32, 119, 244, 3, 0, 162, 1, 1, 80, 162, 1, 8, 79, 140, 1, 
+  4, 59, 140, 1, 32, 60, 216, 4, 0, 48, 1, 29, 48, 8, 30, 144, 3, 0, 36, 1, 
+  20, 36, 8, 19, 144, 3, 0, 36, 1, 19, 36, 8, 20, 144, 3, 0, 36, 1, 20, 36, 
+  8, 19, 144, 3, 0, 36, 1, 19, 36, 8, 20, 144, 3, 0, 36, 1, 20, 36, 8, 19, 
+  144, 3, 0, 36, 1, 19, 36, 8, 20, 144, 3, 0, 36, 1, 20, 36, 8, 19, 144, 3, 
+  0, 0, 192, 36, 20, 20, 10, 150, 1, 0, 0, 128, 32, 9, 166, 4, 0, 99, 208, 1, 
+  0, 25, 1, 39, 150, 1, 0, 45, 1, 80, 150, 1, 0, 25, 8, 39, 150, 1, 0, 45, 
+  8, 80, 150, 1, 0, 9, 2, 19, 54, 16, 170, 1, 120, 0, 15, 2, 40, 15, 16, 39, 
+  120, 0, 36, 4, 109, 15, 32, 39, 100, 0, 15, 4, 40, 15, 32, 39, 100, 0, 15, 2, 
+  39, 15, 16, 40, 120, 0, 15, 2, 40, 15, 16, 39, 120, 0, 15, 4, 39, 15, 32, 40, 
+  100, 0, 15, 4, 40, 15, 32, 39, 100, 0, 15, 2, 39, 15, 16, 40, 120, 0, 15, 2, 
+  40, 15, 16, 39, 120, 0, 15, 4, 39, 15, 32, 40, 100, 0, 15, 4, 40, 15, 32, 39, 
+  100, 0, 15, 2, 39, 15, 16, 40, 120, 0, 15, 2, 40, 15, 16, 39, 120, 0, 15, 4, 
+  39, 15, 32, 40, 100, 0, 15, 4, 40, 15, 32, 39, 100, 0, 15, 2, 39, 15, 16, 40, 
+  120, 0, 15, 2, 40, 15, 16, 39, 120, 0, 15, 4, 39, 15, 32, 40, 100, 0, 15, 4, 
+  40, 15, 32, 39, 100, 0, 15, 2, 39, 15, 16, 40, 120, 0, 15, 2, 40, 15, 16, 39, 
+  120, 0, 15, 4, 39, 15, 32, 40, 100, 0, 15, 4, 40, 15, 32, 39, 100, 0, 0, 64, 
+  24, 150, 1, 0, 0, 64, 7, 150, 1, 0, 0, 128, 4, 24, 150, 1, 0, 0, 128, 36, 
+  7, 10, 80, 0, 0, 128, 32, 9, 120, 0, 0, 128, 32, 20, 80, 0, 0, 128, 32, 19, 
+  120, 0, 0, 128, 32, 10, 60, 0, 0, 128, 32, 9, 212, 2, 0, 31, 34, 1, 9, 34, 
+  8, 10, 19, 0, 176, 2, 16, 150, 1, 136, 4, 0, 32, 1, 9, 32, 8, 10, 220, 3, 
+  0, 30, 1, 9, 30, 8, 10, 34, 2, 9, 34, 16, 10, 232, 2, 0, 28, 1, 9, 28, 
+  8, 10, 184, 2, 0, 39, 1, 19, 39, 8, 20, 30, 2, 9, 30, 16, 10, 200, 1, 0, 
+  168, 1, 4, 129, 1, 36, 32, 19, 144, 3, 0, 70, 4, 39, 70, 32, 40, 244, 3, 0, 
+  0, 192, 45, 28, 20, 28, 20, 10, 200, 1, 0, 0, 128, 32, 9, 172, 2, 0, 58, 26, 
+  1, 9, 26, 8, 10, 13, 0, 208, 1, 16, 150, 1, 143, 1, 4, 99, 65, 32, 39, 187, 
+  2, 0, 33, 1, 19, 33, 8, 20, 22, 2, 9, 22, 16, 10, 22, 4, 9, 163, 2, 0, 
+  27, 1, 19, 27, 8, 20, 18, 2, 9, 18, 16, 10, 18, 4, 9, 18, 32, 10, 245, 1, 
+  0, 21, 1, 19, 21, 8, 20, 14, 2, 9, 14, 16, 10, 14, 4, 9, 14, 32, 10, 210, 
+  1, 0, 15, 1, 19, 15, 8, 20, 10, 2, 9, 10, 16, 10, 15, 4, 19, 15, 32, 20, 
+  175, 1, 0, 6, 1, 9, 6, 8, 10, 6, 0, 6, 4, 9, 6, 32, 10, 140, 1, 0, 
+  3, 1, 19, 3, 8, 20, 2, 2, 9, 2, 16, 10, 2, 4, 9, 2, 32, 10, 105, 0, 
+  20, 1, 9, 20, 8, 10, 20, 2, 9, 20, 16, 10, 30, 4, 19, 30, 32, 20, 144, 3, 
+  0, 0, 192, 45, 50, 40, 50, 40, 20, 144, 3, 0, 0, 128, 32, 19, 100, 0, 117, 6, 
+  1, 50, 2, 8, 9, 1, 0, 2, 16, 10, 23, 4, 219, 1, 6, 32, 49, 90, 0, 6, 
+  1, 50, 5, 8, 40, 2, 2, 9, 22, 16, 210, 1, 3, 4, 19, 6, 32, 50, 90, 0, 
+  20, 1, 189, 1, 7, 8, 59, 13, 2, 120, 16, 16, 149, 1, 5, 4, 40, 5, 32, 39, 
+  90, 0, 3, 1, 19, 15, 8, 140, 1, 9, 2, 79, 3, 16, 19, 11, 4, 100, 8, 32, 
+  69, 90, 0, 4, 1, 30, 6, 8, 50, 21, 2, 200, 1, 3, 16, 20, 10, 4, 89, 9, 
+  32, 80, 90, 0, 10, 1, 90, 24, 8, 229, 1, 31, 2, 171, 2, 9, 16, 80, 22, 4, 
+  210, 1, 11, 32, 100, 90, 0, 12, 1, 109, 23, 8, 220, 1, 9, 2, 80, 6, 16, 49, 
+  12, 4, 109, 7, 32, 59, 90, 0, 6, 1, 50, 18, 8, 169, 1, 21, 2, 200, 1, 15, 
+  16, 139, 1, 2, 4, 10, 3, 32, 20, 90, 0, 6, 1, 50, 6, 8, 50, 4, 2, 30, 
+  22, 16, 210, 1, 4, 4, 30, 2, 32, 10, 91, 0, 9, 8, 79, 27, 2, 131, 2, 6, 
+  16, 49, 3, 4, 19, 18, 32, 169, 1, 90, 0, 10, 1, 89, 11, 8, 100, 5, 2, 39, 
+  8, 16, 69, 14, 4, 129, 1, 4, 32, 29, 90, 0, 23, 1, 220, 1, 18, 8, 169, 1, 
+  29, 2, 152, 2, 3, 16, 19, 2, 4, 10, 13, 32, 120, 90, 0, 0, 192, 13, 40, 16, 
+  56, 22, 120, 0, 0, 192, 13, 10, 6, 13, 26, 120, 0, 0, 192, 13, 15, 4, 12, 23, 
+  120, 0, 0, 192, 13, 5, 9, 13, 14, 120, 0, 0, 192, 13, 6, 4, 18, 15, 120, 0, 
+  0, 192, 13, 16, 10, 5, 24, 120, 0, 0, 192, 13, 23, 12, 7, 9, 120, 0, 0, 192, 
+  13, 4, 7, 19, 12, 120, 0, 0, 128, 32, 20, 50, 0, 0, 128, 32, 0, 50, 0, 0, 
+  128, 32, 0, 50, 0, 0, 128, 32, 0, 50, 0, 0, 128, 32, 0, 50, 0, 0, 128, 32, 
+  0, 50, 0, 0, 128, 32, 0, 50, 0, 0, 128, 32, 0, 60, 0, 0, 128, 32, 19, 162, 
+  2, 0, 148, 1, 42, 1, 129, 1, 42, 8, 130, 1, 21, 2, 59, 66, 16, 210, 1, 66, 
+  4, 209, 1, 21, 32, 60, 140, 1, 0, 81, 1, 132, 2, 81, 8, 131, 2, 93, 2, 172, 
+  2, 93, 16, 171, 2, 75, 4, 240, 1, 75, 32, 239, 1, 140, 1, 0, 81, 1, 131, 2, 
+  81, 8, 132, 2, 93, 2, 171, 2, 93, 16, 172, 2, 75, 4, 239, 1, 75, 32, 240, 1, 
+  140, 1, 0, 81, 1, 132, 2, 81, 8, 131, 2, 93, 2, 172, 2, 93, 16, 171, 2, 75, 
+  4, 240, 1, 75, 32, 239, 1, 140, 1, 0, 81, 1, 131, 2, 81, 8, 132, 2, 93, 2, 
+  171, 2, 93, 16, 172, 2, 75, 4, 239, 1, 75, 32, 240, 1, 140, 1, 0, 81, 1, 132, 
+  2, 81, 8, 131, 2, 93, 2, 172, 2, 93, 16, 171, 2, 75, 4, 240, 1, 75, 32, 239, 
+  1, 140, 1, 0, 81, 1, 131, 2, 81, 8, 132, 2, 93, 2, 171, 2, 93, 16, 172, 2, 
+  75, 4, 239, 1, 75, 32, 240, 1, 140, 1, 0, 81, 1, 132, 2, 81, 8, 131, 2, 93, 
+  2, 172, 2, 93, 16, 171, 2, 75, 4, 240, 1, 75, 32, 239, 1, 140, 1, 0, 81, 1, 
+  131, 2, 81, 8, 132, 2, 93, 2, 171, 2, 93, 16, 172, 2, 75, 4, 239, 1, 75, 32, 
+  240, 1, 140, 1, 0, 81, 1, 132, 2, 81, 8, 131, 2, 93, 2, 172, 2, 93, 16, 171, 
+  2, 75, 4, 240, 1, 75, 32, 239, 1, 140, 1, 0, 81, 1, 131, 2, 81, 8, 132, 2, 
+  93, 2, 171, 2, 93, 16, 172, 2, 75, 4, 239, 1, 75, 32, 240, 1, 140, 1, 0, 81, 
+  1, 132, 2, 81, 8, 131, 2, 93, 2, 172, 2, 93, 16, 171, 2, 75, 4, 240, 1, 75, 
+  32, 239, 1, 140, 1, 0, 81, 1, 131, 2, 81, 8, 132, 2, 93, 2, 171, 2, 93, 16, 
+  172, 2, 75, 4, 239, 1, 75, 32, 240, 1, 140, 1, 0, 81, 1, 132, 2, 81, 8, 131, 
+  2, 93, 2, 172, 2, 93, 16, 171, 2, 75, 4, 240, 1, 75, 32, 239, 1, 140, 1, 0, 
+  81, 1, 131, 2, 81, 8, 132, 2, 93, 2, 171, 2, 93, 16, 172, 2, 75, 4, 239, 1, 
+  75, 32, 240, 1, 140, 1, 0, 81, 1, 132, 2, 81, 8, 131, 2, 93, 2, 172, 2, 93, 
+  16, 171, 2, 75, 4, 240, 1, 75, 32, 239, 1, 140, 1, 0, 81, 1, 131, 2, 81, 8, 
+  132, 2, 93, 2, 171, 2, 93, 16, 172, 2, 75, 4, 239, 1, 75, 32, 240, 1, 140, 1, 
+  0, 81, 1, 132, 2, 81, 8, 131, 2, 93, 2, 172, 2, 93, 16, 171, 2, 75, 4, 240, 
+  1, 75, 32, 239, 1, 140, 1, 0, 81, 1, 131, 2, 81, 8, 132, 2, 93, 2, 171, 2, 
+  93, 16, 172, 2, 75, 4, 239, 1, 75, 32, 240, 1, 140, 1, 0, 81, 1, 132, 2, 81, 
+  8, 131, 2, 93, 2, 172, 2, 93, 16, 171, 2, 75, 4, 240, 1, 75, 32, 239, 1, 140, 
+  1, 0, 0, 192, 13, 56, 44, 44, 36, 150, 1, 0, 0, 192, 45, 11, 7, 12, 8, 18, 
+  180, 1, 0, 0, 128, 32, 5, 180, 1, 0, 0, 128, 32, 11, 200, 1, 0, 8, 225, 1, 
+  1, 79, 225, 1, 8, 80, 75, 2, 19, 194, 3, 16, 170, 1, 144, 3, 4, 149, 1, 161, 
+  21, 0, 0, 192, 13, 36, 28, 36, 28, 160, 6, 0, 47, 100, 1, 89, 100, 8, 90, 40, 
+  2, 29, 190, 1, 16, 180, 1, 144, 3, 0, 210, 1, 4, 129, 1, 30, 32, 9, 172, 2, 
+  0, 26, 1, 10, 26, 8, 9, 210, 4, 0, 36, 32, 9, 144, 3, 0, 32, 1, 10, 32, 
+  8, 9, 250, 9, 0, 57, 1, 20, 57, 8, 19, 38, 2, 10, 38, 16, 9, 210, 6, 0, 
+  48, 4, 10, 48, 32, 9, 216, 4, 0, 44, 1, 10, 44, 8, 9, 148, 8, 0, 54, 4, 
+  10, 54, 32, 9, 188, 5, 0, 75, 1, 20, 75, 8, 19, 50, 2, 10, 50, 16, 9, 254, 
+  8, 0, 60, 4, 10, 60, 32, 9, 160, 6, 0, 40, 1, 10, 40, 8, 9, 60, 2, 20, 
+  60, 16, 19, 188, 5, 0, 0, 192, 45, 28, 20, 28, 20, 10, 180, 1, 0, 0, 128, 32, 
+  9, 164, 3, 0, 49, 80, 1, 89, 80, 8, 90, 172, 2, 0, 40, 2, 29, 190, 1, 16, 
+  180, 1, 250, 1, 0, 168, 1, 4, 129, 1, 24, 32, 9, 200, 1, 0, 22, 1, 10, 22, 
+  8, 9, 173, 7, 0, 30, 32, 9, 172, 2, 0, 56, 1, 30, 56, 8, 29, 188, 5, 0, 
+  32, 2, 10, 32, 16, 9, 166, 4, 0, 36, 4, 10, 36, 32, 9, 144, 3, 0, 51, 1, 
+  20, 51, 8, 19, 132, 7, 0, 38, 2, 10, 38, 16, 9, 188, 5, 0, 42, 4, 10, 42, 
+  32, 9, 244, 3, 0, 100, 1, 30, 100, 8, 29, 50, 2, 10, 50, 16, 9, 75, 4, 20, 
+  75, 32, 19, 160, 6, 0, 0, 192, 4, 34, 34, 144, 3, 0, 0, 192, 4, 5, 5, 216, 
+  4, 0, 0, 192, 4, 5, 5, 160, 6, 0, 0, 128, 32, 20, 150, 1, 0, 0, 128, 32, 
+  19, 222, 2, 0, 29, 70, 1, 39, 70, 8, 40, 28, 2, 9, 238, 1, 16, 160, 1, 216, 
+  4, 0, 48, 1, 29, 48, 8, 30, 42, 4, 19, 196, 1, 32, 129, 1, 244, 3, 0, 144, 
+  1, 1, 80, 144, 1, 8, 79, 198, 1, 4, 99, 198, 1, 32, 100, 216, 4, 0, 36, 1, 
+  20, 36, 8, 19, 60, 2, 40, 60, 16, 39, 244, 3, 0, 208, 1, 1, 119, 208, 1, 8, 
+  120, 72, 4, 29, 72, 32, 30, 216, 4, 0, 0, 192, 45, 32, 24, 32, 24, 10, 152, 2, 
+  0, 0, 128, 32, 9, 220, 1, 0, 103, 3, 0, 24, 8, 69, 36, 2, 110, 18, 16, 50, 
+  3, 0, 6, 32, 9, 120, 0, 9, 1, 19, 30, 8, 90, 3, 0, 36, 16, 109, 33, 4, 
+  99, 123, 0, 24, 1, 69, 24, 8, 69, 15, 2, 40, 15, 16, 40, 12, 4, 30, 123, 0, 
+  6, 1, 9, 3, 0, 6, 2, 9, 6, 16, 10, 21, 4, 60, 36, 32, 109, 120, 0, 12, 
+  1, 30, 3, 0, 12, 2, 30, 45, 16, 140, 1, 24, 4, 69, 15, 32, 40, 120, 0, 9, 
+  1, 19, 18, 8, 49, 27, 2, 79, 6, 16, 9, 30, 4, 89, 15, 32, 39, 120, 0, 51, 
+  1, 160, 1, 18, 8, 50, 18, 2, 50, 15, 16, 40, 51, 4, 160, 1, 24, 32, 70, 120, 
+  0, 6, 1, 9, 9, 8, 19, 30, 2, 89, 51, 16, 159, 1, 36, 4, 109, 21, 32, 60, 
+  120, 0, 12, 1, 30, 6, 8, 10, 42, 2, 130, 1, 36, 16, 110, 21, 4, 59, 24, 32, 
+  69, 123, 0, 6, 8, 9, 60, 2, 189, 1, 39, 16, 119, 57, 4, 180, 1, 9, 32, 19, 
+  120, 0, 0, 192, 13, 30, 34, 44, 24, 160, 1, 0, 0, 192, 13, 12, 13, 2, 14, 160, 
+  1, 0, 0, 192, 13, 11, 16, 17, 4, 160, 1, 0, 0, 192, 13, 10, 9, 12, 9, 160, 
+  1, 0, 0, 192, 13, 4, 8, 3, 6, 160, 1, 0, 0, 192, 13, 11, 5, 8, 4, 160, 
+  1, 0, 0, 128, 32, 20, 80, 0, 0, 128, 32, 19, 10, 0, 0, 128, 32, 20, 80, 0, 
+  0, 128, 32, 19, 10, 0, 0, 128, 32, 20, 80, 0, 0, 128, 32, 19, 10, 0, 0, 128, 
+  32, 20, 80, 0, 0, 128, 32, 19, 10, 0, 0, 128, 32, 20, 80, 0, 0, 128, 32, 19, 
+  10, 0, 0, 128, 32, 20, 80, 0, 0, 128, 32, 19, 182, 2, 0, 43, 48, 1, 19, 48, 
+  8, 20, 32, 2, 10, 240, 1, 16, 140, 1, 216, 4, 0, 144, 2, 4, 149, 1, 161, 3, 
+  0, 221, 1, 4, 120, 221, 1, 32, 119, 144, 3, 0, 176, 1, 4, 99, 176, 1, 32, 100, 
+  166, 4, 0, 144, 1, 4, 80, 144, 1, 32, 79, 166, 4, 0, 120, 4, 69, 120, 32, 70, 
+  188, 5, 0, 105, 4, 60, 105, 32, 59, 188, 5, 0, 84, 4, 49, 84, 32, 50, 210, 6, 
+  0, 70, 4, 40, 70, 32, 39, 210, 6, 0, 52, 4, 29, 52, 32, 30, 232, 7, 0, 39, 
+  4, 20, 39, 32, 19, 232, 7, 0, 40, 1, 10, 40, 8, 9, 40, 4, 9, 40, 32, 10, 
+  188, 5, 0, 0, 192, 45, 24, 16, 24, 16, 20, 200, 1, 0, 0, 128, 32, 19, 144, 3, 
+  0, 47, 80, 1, 29, 80, 8, 30, 20, 0, 192, 2, 16, 150, 1, 160, 6, 0, 72, 1, 
+  30, 72, 8, 29, 132, 1, 4, 49, 242, 1, 32, 99, 188, 5, 0, 175, 1, 4, 59, 175, 
+  1, 32, 60, 160, 6, 0, 30, 1, 9, 30, 8, 10, 244, 3, 0, 45, 1, 20, 45, 8, 
+  19, 244, 3, 0, 45, 1, 19, 45, 8, 20, 244, 3, 0, 45, 1, 20, 45, 8, 19, 244, 
+  3, 0, 45, 1, 19, 45, 8, 20, 244, 3, 0, 45, 1, 20, 45, 8, 19, 244, 3, 0, 
+  45, 1, 19, 45, 8, 20, 244, 3, 0, 45, 1, 20, 45, 8, 19, 244, 3, 0, 45, 1, 
+  19, 45, 8, 20, 244, 3, 0, 45, 1, 20, 45, 8, 19, 244, 3, 0, 0, 192, 45, 20, 
+  12, 20, 12, 10, 160, 1, 0, 0, 128, 32, 9, 156, 4, 0, 32, 144, 1, 1, 69, 144, 
+  1, 8, 70, 54, 2, 19, 196, 2, 16, 170, 1, 244, 3, 0, 44, 1, 10, 44, 8, 9, 
+  232, 5, 0, 52, 1, 10, 52, 8, 9, 184, 7, 0, 60, 1, 10, 60, 8, 9, 136, 9, 
+  0, 68, 1, 10, 68, 8, 9, 68, 2, 10, 68, 16, 9, 148, 10, 0, 76, 1, 10, 76, 
+  8, 9, 168, 12, 0, 147, 2, 4, 99, 150, 1, 32, 49, 160, 6, 0, 75, 4, 20, 75, 
+  32, 19, 160, 6, 0, 0, 192, 45, 16, 10, 16, 10, 20, 180, 1, 0, 0, 128, 32, 19, 
+  136, 4, 0, 30, 75, 0, 247, 2, 16, 140, 1, 132, 7, 0, 200, 1, 4, 89, 120, 32, 
+  49, 208, 5, 0, 40, 32, 9, 148, 40, 0, 36, 1, 9, 36, 8, 10, 216, 4, 0, 54, 
+  1, 20, 54, 8, 19, 216, 4, 0, 54, 1, 19, 54, 8, 20, 216, 4, 0, 54, 1, 20, 
+  54, 8, 19, 216, 4, 0, 54, 1, 19, 54, 8, 20, 216, 4, 0, 54, 1, 20, 54, 8, 
+  19, 216, 4, 0, 0, 192, 45, 12, 8, 12, 8, 10, 120, 0, 0, 128, 32, 9, 168, 5, 
+  0, 31, 125, 1, 39, 125, 8, 40, 216, 4, 0, 150, 1, 2, 39, 216, 4, 16, 190, 1, 
+  190, 31, 0, 80, 1, 10, 80, 8, 9, 176, 9, 0, 90, 2, 10, 90, 16, 9, 184, 28, 
+  0, 100, 1, 10, 100, 8, 9, 192, 12, 0, 110, 2, 10, 110, 16, 9, 200, 36, 0, 120, 
+  1, 10, 120, 8, 9, 208, 15, 0, 130, 1, 2, 10, 130, 1, 16, 9, 142, 12, 0, 172, 
+  2, 4, 89, 210, 1, 32, 59, 232, 7, 0, 0, 192, 45, 8, 6, 8, 6, 20, 100, 0, 
+  0, 128, 32, 19, 188, 5, 0, 14, 138, 20, 0, 194, 3, 16, 140, 1, 134, 8, 0, 60, 
+  16, 10, 232, 7, 0, 144, 3, 4, 89, 240, 1, 32, 49, 132, 12, 0, 80, 32, 9, 220, 
+  11, 0, 0, 192, 45, 6, 4, 6, 4, 10, 60, 0, 0, 128, 32, 9, 172, 7, 0, 7, 
+  135, 1, 0, 208, 5, 16, 150, 1, 194, 3, 4, 89, 187, 2, 32, 59, 172, 152, 1, 0, 
+  0, 192, 31, 4, 2, 2, 4, 2, 2, 184, 23, 0
+};
+const uint16_t FADED_STEP_OFFSETS[] PROGMEM = {
+  0, 103, 164, 234, 334, 440, 667, 777, 846, 968, 1121, 1433, 
+  1796, 1937, 2215, 2318, 2498, 2882, 3457, 3492, 3644, 3804, 3908, 4235, 
+  4381, 4534, 4643, 4741, 4847, 4899
+};
+
+// Alone - 38 steps, 5062 bytes
+const uint8_t ALONE_TRACKS[] PROGMEM = {
+  29, 30, 0, 160, 1, 16, 150, 1, 172, 2, 0, 30, 1, 19, 30, 8, 20, 200, 1, 0, 
+  50, 1, 40, 50, 8, 39, 200, 1, 0, 50, 1, 39, 50, 8, 40, 200, 1, 0, 50, 1, 
+  40, 50, 8, 39, 200, 1, 0, 50, 1, 39, 50, 8, 40, 200, 1, 0, 50, 1, 40, 50, 
+  8, 39, 200, 1, 0, 50, 1, 39, 50, 8, 40, 200, 1, 0, 50, 1, 40, 50, 8, 39, 
+  200, 1, 0, 0, 192, 31, 56, 52, 4, 56, 52, 10, 244, 3, 0, 31, 40, 1, 39, 40, 
+  8, 40, 128, 1, 4, 149, 1, 130, 2, 0, 72, 1, 80, 72, 8, 79, 104, 4, 120, 104, 
+  32, 119, 250, 1, 0, 20, 2, 29, 95, 16, 180, 1, 100, 0, 25, 2, 40, 25, 16, 39, 
+  100, 0, 25, 2, 39, 25, 16, 40, 100, 0, 25, 2, 40, 25, 16, 39, 100, 0, 25, 2, 
+  39, 25, 16, 40, 100, 0, 25, 2, 40, 25, 16, 39, 100, 0, 0, 192, 63, 24, 16, 10, 
+  24, 16, 12, 10, 150, 1, 0, 0, 128, 32, 9, 150, 1, 0, 24, 70, 1, 59, 70, 8, 
+  60, 30, 2, 19, 180, 1, 16, 170, 1, 144, 3, 0, 40, 1, 29, 40, 8, 30, 120, 4, 
+  109, 50, 32, 39, 172, 2, 0, 40, 1, 30, 40, 8, 29, 50, 4, 40, 50, 32, 39, 172, 
+  2, 0, 40, 1, 30, 40, 8, 29, 50, 4, 40, 50, 32, 39, 172, 2, 0, 0, 192, 63, 
+  30, 20, 16, 30, 20, 16, 18, 200, 1, 0, 0, 128, 32, 17, 144, 3, 0, 39, 40, 1, 
+  29, 40, 8, 30, 20, 2, 9, 170, 1, 16, 160, 1, 200, 1, 0, 24, 1, 29, 24, 8, 
+  30, 120, 0, 78, 1, 120, 78, 8, 119, 120, 0, 78, 1, 119, 78, 8, 120, 120, 0, 78, 
+  1, 120, 78, 8, 119, 120, 0, 78, 1, 119, 78, 8, 120, 120, 0, 78, 1, 120, 78, 8, 
+  119, 120, 0, 78, 1, 119, 78, 8, 120, 120, 0, 78, 1, 120, 78, 8, 119, 120, 0, 78, 
+  1, 119, 78, 8, 120, 120, 0, 78, 1, 120, 78, 8, 119, 120, 0, 0, 192, 45, 40, 30, 
+  40, 30, 20, 200, 1, 0, 0, 128, 32, 19, 100, 0, 27, 120, 1, 89, 120, 8, 90, 72, 
+  2, 49, 252, 1, 16, 200, 1, 240, 1, 4, 189, 1, 60, 32, 40, 244, 3, 0, 20, 1, 
+  9, 20, 8, 10, 150, 1, 0, 30, 1, 20, 30, 8, 19, 150, 1, 0, 30, 1, 19, 30, 
+  8, 20, 150, 1, 0, 30, 1, 20, 30, 8, 19, 150, 1, 0, 30, 1, 19, 30, 8, 20, 
+  150, 1, 0, 30, 1, 20, 30, 8, 19, 150, 1, 0, 0, 192, 13, 50, 36, 50, 36, 144, 
+  3, 0, 88, 45, 1, 139, 1, 45, 8, 140, 1, 24, 2, 69, 69, 16, 220, 1, 66, 4, 
+  209, 1, 21, 32, 60, 100, 0, 87, 1, 152, 2, 87, 8, 151, 2, 99, 2, 192, 2, 99, 
+  16, 191, 2, 75, 4, 240, 1, 75, 32, 239, 1, 100, 0, 87, 1, 151, 2, 87, 8, 152, 
+  2, 99, 2, 191, 2, 99, 16, 192, 2, 75, 4, 239, 1, 75, 32, 240, 1, 100, 0, 87, 
+  1, 152, 2, 87, 8, 151, 2, 99, 2, 192, 2, 99, 16, 191, 2, 75, 4, 240, 1, 75, 
+  32, 239, 1, 100, 0, 87, 1, 151, 2, 87, 8, 152, 2, 99, 2, 191, 2, 99, 16, 192, 
+  2, 75, 4, 239, 1, 75, 32, 240, 1, 100, 0, 87, 1, 152, 2, 87, 8, 151, 2, 99, 
+  2, 192, 2, 99, 16, 191, 2, 75, 4, 240, 1, 75, 32, 239, 1, 100, 0, 87, 1, 151, 
+  2, 87, 8, 152, 2, 99, 2, 191, 2, 99, 16, 192, 2, 75, 4, 239, 1, 75, 32, 240, 
+  1, 100, 0, 87, 1, 152, 2, 87, 8, 151, 2, 99, 2, 192, 2, 99, 16, 191, 2, 75, 
+  4, 240, 1, 75, 32, 239, 1, 100, 0, 87, 1, 151, 2, 87, 8, 152, 2, 99, 2, 191, 
+  2, 99, 16, 192, 2, 75, 4, 239, 1, 75, 32, 240, 1, 100, 0, 87, 1, 152, 2, 87, 
+  8, 151, 2, 99, 2, 192, 2, 99, 16, 191, 2, 75, 4, 240, 1, 75, 32, 239, 1, 100, 
+  0, 87, 1, 151, 2, 87, 8, 152, 2, 99, 2, 191, 2, 99, 16, 192, 2, 75, 4, 239, 
+  1, 75, 32, 240, 1, 100, 0, 87, 1, 152, 2, 87, 8, 151, 2, 99, 2, 192, 2, 99, 
+  16, 191, 2, 75, 4, 240, 1, 75, 32, 239, 1, 100, 0, 0, 192, 45, 70, 50, 70, 50, 
+  20, 120, 0, 0, 128, 32, 19, 30, 0, 26, 48, 1, 109, 44, 8, 100, 28, 2, 59, 84, 
+  16, 200, 1, 154, 1, 0, 12, 8, 20, 158, 1, 0, 8, 1, 9, 4, 0, 8, 2, 10, 
+  154, 1, 0, 8, 1, 10, 8, 8, 9, 4, 0, 8, 16, 9, 150, 1, 0, 48, 4, 149, 
+  1, 80, 0, 39, 4, 120, 163, 1, 0, 39, 32, 119, 80, 0, 0, 192, 4, 60, 40, 150, 
+  1, 0, 0, 192, 4, 19, 20, 200, 1, 0, 29, 103, 0, 15, 1, 39, 50, 0, 27, 1, 
+  80, 50, 0, 15, 1, 39, 203, 1, 0, 15, 8, 40, 50, 0, 27, 8, 79, 50, 0, 15, 
+  8, 40, 100, 0, 10, 2, 39, 40, 16, 190, 1, 80, 0, 12, 2, 50, 14, 16, 59, 164, 
+  1, 0, 6, 2, 19, 82, 0, 10, 2, 39, 14, 16, 60, 80, 0, 16, 2, 70, 6, 16, 
+  19, 80, 0, 0, 192, 13, 24, 16, 24, 16, 172, 2, 0, 26, 30, 1, 19, 30, 8, 20, 
+  20, 2, 10, 150, 1, 16, 140, 1, 60, 4, 49, 110, 32, 99, 144, 3, 0, 30, 1, 19, 
+  30, 8, 20, 172, 2, 0, 90, 1, 80, 90, 8, 79, 172, 2, 0, 70, 1, 59, 70, 8, 
+  60, 172, 2, 0, 50, 1, 40, 50, 8, 39, 172, 2, 0, 30, 1, 19, 30, 8, 20, 236, 
+  4, 0, 0, 192, 45, 36, 24, 36, 24, 10, 180, 1, 0, 0, 128, 32, 9, 220, 1, 0, 
+  19, 105, 1, 59, 105, 8, 60, 45, 2, 19, 142, 2, 16, 170, 1, 216, 4, 0, 40, 1, 
+  29, 40, 8, 30, 140, 1, 4, 129, 1, 30, 32, 19, 144, 3, 0, 190, 1, 1, 180, 1, 
+  190, 1, 8, 179, 1, 90, 4, 80, 90, 32, 79, 144, 3, 0, 0, 192, 4, 44, 32, 172, 
+  2, 0, 0, 192, 4, 11, 12, 172, 2, 0, 42, 40, 1, 29, 40, 8, 30, 20, 2, 9, 
+  170, 1, 16, 160, 1, 220, 1, 0, 40, 1, 29, 40, 8, 30, 30, 2, 19, 30, 16, 20, 
+  190, 1, 0, 40, 1, 29, 40, 8, 30, 20, 2, 9, 20, 16, 10, 160, 1, 0, 40, 1, 
+  29, 40, 8, 30, 30, 2, 19, 30, 16, 20, 130, 1, 0, 180, 1, 4, 169, 1, 30, 32, 
+  20, 200, 1, 0, 170, 1, 4, 160, 1, 170, 1, 32, 159, 1, 200, 1, 0, 170, 1, 4, 
+  159, 1, 170, 1, 32, 160, 1, 200, 1, 0, 170, 1, 4, 160, 1, 170, 1, 32, 159, 1, 
+  200, 1, 0, 170, 1, 4, 159, 1, 170, 1, 32, 160, 1, 200, 1, 0, 170, 1, 4, 160, 
+  1, 170, 1, 32, 159, 1, 200, 1, 0, 0, 192, 45, 56, 40, 56, 40, 12, 250, 1, 0, 
+  0, 128, 32, 11, 200, 1, 0, 9, 162, 1, 1, 79, 162, 1, 8, 80, 90, 2, 39, 232, 
+  2, 16, 190, 1, 214, 2, 4, 179, 1, 72, 32, 30, 168, 15, 0, 0, 192, 13, 64, 48, 
+  64, 48, 144, 3, 0, 34, 130, 1, 1, 119, 130, 1, 8, 120, 80, 2, 69, 230, 1, 16, 
+  220, 1, 240, 1, 4, 229, 1, 90, 32, 80, 244, 3, 0, 20, 1, 9, 20, 8, 10, 100, 
+  0, 30, 1, 20, 30, 8, 19, 100, 0, 30, 1, 19, 30, 8, 20, 100, 0, 30, 1, 20, 
+  30, 8, 19, 100, 0, 30, 1, 19, 30, 8, 20, 100, 0, 30, 1, 20, 30, 8, 19, 100, 
+  0, 30, 1, 19, 30, 8, 20, 100, 0, 30, 1, 20, 30, 8, 19, 100, 0, 0, 192, 45, 
+  76, 56, 76, 56, 20, 172, 2, 0, 0, 128, 32, 19, 64, 16, 1, 70, 8, 8, 30, 26, 
+  2, 120, 18, 16, 80, 20, 4, 89, 14, 32, 59, 80, 0, 8, 1, 29, 10, 8, 40, 6, 
+  2, 20, 6, 16, 19, 22, 4, 99, 14, 32, 60, 82, 0, 22, 8, 99, 28, 2, 129, 1, 
+  34, 16, 160, 1, 18, 4, 80, 6, 32, 20, 80, 0, 34, 1, 159, 1, 20, 8, 89, 24, 
+  2, 110, 34, 16, 159, 1, 18, 4, 80, 44, 32, 209, 1, 80, 0, 10, 1, 40, 10, 8, 
+  40, 4, 2, 10, 4, 16, 10, 10, 4, 39, 40, 32, 190, 1, 80, 0, 36, 1, 170, 1, 
+  16, 8, 69, 4, 2, 10, 10, 16, 39, 16, 4, 69, 18, 32, 79, 80, 0, 36, 1, 169, 
+  1, 30, 8, 140, 1, 20, 2, 90, 18, 16, 79, 4, 4, 10, 4, 32, 9, 80, 0, 30, 
+  1, 140, 1, 26, 8, 120, 48, 2, 229, 1, 2, 0, 24, 4, 109, 14, 32, 59, 80, 0, 
+  0, 192, 13, 84, 64, 56, 40, 120, 0, 0, 192, 36, 27, 28, 20, 50, 0, 0, 128, 32, 
+  0, 50, 0, 0, 128, 32, 0, 100, 0, 0, 128, 32, 19, 68, 56, 1, 129, 1, 56, 8, 
+  130, 1, 32, 2, 69, 92, 16, 220, 1, 120, 0, 108, 1, 132, 2, 108, 8, 131, 2, 132, 
+  1, 2, 192, 2, 132, 1, 16, 191, 2, 120, 0, 108, 1, 131, 2, 108, 8, 132, 2, 132, 
+  1, 2, 191, 2, 132, 1, 16, 192, 2, 120, 0, 108, 1, 132, 2, 108, 8, 131, 2, 132, 
+  1, 2, 192, 2, 132, 1, 16, 191, 2, 120, 0, 108, 1, 131, 2, 108, 8, 132, 2, 132, 
+  1, 2, 191, 2, 132, 1, 16, 192, 2, 120, 0, 108, 1, 132, 2, 108, 8, 131, 2, 132, 
+  1, 2, 192, 2, 132, 1, 16, 191, 2, 120, 0, 108, 1, 131, 2, 108, 8, 132, 2, 132, 
+  1, 2, 191, 2, 132, 1, 16, 192, 2, 120, 0, 108, 1, 132, 2, 108, 8, 131, 2, 132, 
+  1, 2, 192, 2, 132, 1, 16, 191, 2, 120, 0, 108, 1, 131, 2, 108, 8, 132, 2, 132, 
+  1, 2, 191, 2, 132, 1, 16, 192, 2, 120, 0, 108, 1, 132, 2, 108, 8, 131, 2, 132, 
+  1, 2, 192, 2, 132, 1, 16, 191, 2, 120, 0, 108, 1, 131, 2, 108, 8, 132, 2, 132, 
+  1, 2, 191, 2, 132, 1, 16, 192, 2, 120, 0, 108, 1, 132, 2, 108, 8, 131, 2, 132, 
+  1, 2, 192, 2, 132, 1, 16, 191, 2, 120, 0, 100, 4, 189, 1, 25, 32, 40, 100, 0, 
+  105, 4, 200, 1, 105, 32, 199, 1, 100, 0, 0, 192, 13, 72, 52, 72, 52, 200, 1, 0, 
+  19, 216, 1, 0, 56, 1, 59, 150, 1, 0, 56, 8, 60, 150, 1, 0, 32, 2, 29, 150, 
+  1, 0, 152, 1, 16, 180, 1, 150, 1, 0, 140, 1, 4, 129, 1, 200, 1, 0, 90, 4, 
+  80, 200, 1, 0, 30, 32, 19, 200, 1, 0, 90, 32, 79, 200, 1, 0, 0, 192, 13, 36, 
+  28, 36, 28, 172, 2, 0, 33, 48, 1, 29, 48, 8, 30, 12, 0, 192, 1, 16, 150, 1, 
+  244, 3, 0, 40, 1, 29, 40, 8, 30, 100, 4, 89, 70, 32, 59, 222, 2, 0, 30, 1, 
+  20, 30, 8, 19, 40, 4, 30, 40, 32, 29, 222, 2, 0, 30, 1, 20, 30, 8, 19, 40, 
+  4, 30, 40, 32, 29, 222, 2, 0, 30, 1, 20, 30, 8, 19, 40, 4, 30, 40, 32, 29, 
+  222, 2, 0, 0, 192, 4, 48, 32, 250, 1, 0, 0, 192, 4, 15, 16, 250, 1, 0, 0, 
+  128, 32, 10, 220, 1, 0, 0, 128, 32, 9, 180, 1, 0, 50, 30, 1, 19, 30, 8, 20, 
+  20, 2, 9, 170, 1, 16, 160, 1, 180, 1, 0, 30, 1, 19, 30, 8, 20, 20, 2, 9, 
+  20, 16, 10, 160, 1, 0, 40, 1, 29, 40, 8, 30, 20, 2, 9, 20, 16, 10, 140, 1, 
+  0, 30, 1, 19, 30, 8, 20, 20, 2, 9, 20, 16, 10, 120, 0, 40, 1, 29, 40, 8, 
+  30, 30, 2, 19, 30, 16, 20, 132, 2, 0, 125, 1, 240, 1, 125, 8, 239, 1, 150, 1, 
+  0, 125, 1, 239, 1, 125, 8, 240, 1, 150, 1, 0, 125, 1, 240, 1, 125, 8, 239, 1, 
+  150, 1, 0, 125, 1, 239, 1, 125, 8, 240, 1, 150, 1, 0, 125, 1, 240, 1, 125, 8, 
+  239, 1, 150, 1, 0, 125, 1, 239, 1, 125, 8, 240, 1, 150, 1, 0, 125, 1, 240, 1, 
+  125, 8, 239, 1, 150, 1, 0, 0, 192, 45, 60, 44, 60, 44, 10, 200, 1, 0, 0, 128, 
+  32, 9, 200, 1, 0, 26, 40, 0, 80, 2, 30, 132, 2, 16, 120, 80, 4, 29, 132, 2, 
+  32, 119, 160, 6, 0, 75, 1, 39, 75, 8, 40, 144, 3, 0, 135, 1, 1, 80, 135, 1, 
+  8, 79, 144, 3, 0, 135, 1, 1, 79, 135, 1, 8, 80, 144, 3, 0, 135, 1, 1, 80, 
+  135, 1, 8, 79, 144, 3, 0, 135, 1, 1, 79, 135, 1, 8, 80, 144, 3, 0, 135, 1, 
+  1, 80, 135, 1, 8, 79, 144, 3, 0, 0, 192, 13, 28, 20, 28, 20, 216, 4, 0, 24, 
+  30, 1, 19, 30, 8, 20, 20, 2, 10, 150, 1, 16, 140, 1, 172, 2, 0, 20, 1, 9, 
+  20, 8, 10, 60, 4, 49, 110, 32, 99, 250, 1, 0, 40, 1, 29, 40, 8, 30, 50, 4, 
+  40, 50, 32, 39, 250, 1, 0, 40, 1, 29, 40, 8, 30, 50, 4, 40, 50, 32, 39, 250, 
+  1, 0, 0, 192, 45, 40, 32, 40, 32, 20, 200, 1, 0, 0, 128, 32, 19, 100, 0, 9, 
+  220, 1, 1, 99, 220, 1, 8, 100, 120, 2, 49, 164, 3, 16, 200, 1, 184, 3, 4, 209, 
+  1, 140, 1, 32, 60, 224, 16, 0, 0, 192, 13, 80, 60, 80, 60, 244, 3, 0, 87, 12, 
+  1, 110, 13, 8, 120, 1, 0, 7, 16, 60, 3, 4, 20, 9, 32, 79, 60, 0, 4, 1, 
+  29, 29, 8, 151, 2, 25, 2, 240, 1, 10, 16, 89, 3, 4, 20, 61, 0, 20, 1, 189, 
+  1, 11, 8, 100, 21, 2, 199, 1, 7, 16, 60, 20, 4, 189, 1, 6, 32, 50, 60, 0, 
+  28, 1, 142, 2, 6, 8, 49, 8, 2, 69, 8, 16, 70, 1, 0, 16, 32, 149, 1, 60, 
+  0, 8, 1, 69, 14, 8, 130, 1, 19, 2, 180, 1, 22, 16, 209, 1, 3, 4, 19, 19, 
+  32, 180, 1, 60, 0, 15, 1, 139, 1, 13, 8, 120, 19, 2, 179, 1, 31, 16, 172, 2, 
+  12, 4, 110, 18, 32, 169, 1, 61, 0, 28, 8, 141, 2, 29, 2, 152, 2, 21, 16, 199, 
+  1, 8, 4, 69, 18, 32, 170, 1, 60, 0, 22, 1, 210, 1, 1, 0, 13, 2, 119, 1, 
+  0, 9, 4, 79, 17, 32, 159, 1, 60, 0, 32, 1, 181, 2, 23, 8, 220, 1, 14, 2, 
+  129, 1, 9, 16, 80, 21, 4, 200, 1, 14, 32, 130, 1, 60, 0, 16, 1, 150, 1, 12, 
+  8, 109, 1, 0, 2, 16, 9, 6, 4, 49, 15, 32, 139, 1, 60, 0, 0, 192, 13, 66, 
+  42, 64, 36, 100, 0, 0, 192, 13, 15, 26, 2, 10, 100, 0, 0, 192, 5, 30, 25, 2, 
+  100, 0, 0, 192, 12, 9, 13, 3, 100, 0, 0, 192, 13, 7, 8, 14, 16, 100, 0, 0, 
+  128, 32, 20, 30, 0, 0, 128, 32, 0, 30, 0, 0, 128, 32, 0, 30, 0, 0, 128, 32, 
+  0, 80, 0, 0, 128, 32, 19, 91, 45, 1, 139, 1, 45, 8, 140, 1, 27, 2, 79, 72, 
+  16, 230, 1, 100, 0, 87, 1, 152, 2, 87, 8, 151, 2, 105, 2, 212, 2, 105, 16, 211, 
+  2, 100, 0, 87, 1, 151, 2, 87, 8, 152, 2, 105, 2, 211, 2, 105, 16, 212, 2, 100, 
+  0, 87, 1, 152, 2, 87, 8, 151, 2, 105, 2, 212, 2, 105, 16, 211, 2, 100, 0, 87, 
+  1, 151, 2, 87, 8, 152, 2, 105, 2, 211, 2, 105, 16, 212, 2, 100, 0, 87, 1, 152, 
+  2, 87, 8, 151, 2, 105, 2, 212, 2, 105, 16, 211, 2, 100, 0, 87, 1, 151, 2, 87, 
+  8, 152, 2, 105, 2, 211, 2, 105, 16, 212, 2, 100, 0, 87, 1, 152, 2, 87, 8, 151, 
+  2, 105, 2, 212, 2, 105, 16, 211, 2, 100, 0, 87, 1, 151, 2, 87, 8, 152, 2, 105, 
+  2, 211, 2, 105, 16, 212, 2, 100, 0, 87, 1, 152, 2, 87, 8, 151, 2, 105, 2, 212, 
+  2, 105, 16, 211, 2, 100, 0, 87, 1, 151, 2, 87, 8, 152, 2, 105, 2, 211, 2, 105, 
+  16, 212, 2, 100, 0, 87, 1, 152, 2, 87, 8, 151, 2, 105, 2, 212, 2, 105, 16, 211, 
+  2, 100, 0, 87, 1, 151, 2, 87, 8, 152, 2, 105, 2, 211, 2, 105, 16, 212, 2, 100, 
+  0, 87, 1, 152, 2, 87, 8, 151, 2, 105, 2, 212, 2, 105, 16, 211, 2, 100, 0, 87, 
+  1, 151, 2, 87, 8, 152, 2, 105, 2, 211, 2, 105, 16, 212, 2, 100, 0, 87, 1, 152, 
+  2, 87, 8, 151, 2, 105, 2, 212, 2, 105, 16, 211, 2, 100, 0, 96, 4, 229, 1, 36, 
+  32, 80, 150, 1, 0, 116, 4, 152, 2, 116, 32, 151, 2, 150, 1, 0, 0, 192, 45, 76, 
+  56, 64, 48, 18, 150, 1, 0, 0, 128, 32, 5, 150, 1, 0, 0, 128, 32, 11, 73, 105, 
+  0, 18, 1, 49, 83, 0, 33, 1, 100, 21, 8, 59, 80, 0, 12, 1, 29, 15, 8, 40, 
+  80, 0, 15, 1, 39, 6, 8, 10, 80, 0, 15, 1, 40, 83, 0, 9, 1, 19, 21, 8, 
+  60, 80, 0, 4, 2, 9, 34, 16, 160, 1, 60, 0, 10, 2, 40, 10, 16, 39, 60, 0, 
+  10, 2, 39, 10, 16, 40, 60, 0, 10, 2, 40, 10, 16, 39, 60, 0, 10, 2, 39, 10, 
+  16, 40, 60, 0, 10, 2, 40, 10, 16, 39, 60, 0, 10, 2, 39, 10, 16, 40, 60, 0, 
+  10, 2, 40, 10, 16, 39, 60, 0, 10, 2, 39, 10, 16, 40, 60, 0, 10, 2, 40, 10, 
+  16, 39, 60, 0, 10, 2, 39, 10, 16, 40, 60, 0, 10, 2, 40, 10, 16, 39, 60, 0, 
+  10, 2, 39, 10, 16, 40, 60, 0, 10, 2, 40, 10, 16, 39, 60, 0, 10, 2, 39, 10, 
+  16, 40, 60, 0, 10, 2, 40, 10, 16, 39, 60, 0, 0, 64, 40, 100, 0, 0, 128, 4, 
+  52, 100, 0, 0, 64, 7, 100, 0, 0, 128, 4, 27, 172, 2, 0, 34, 126, 1, 59, 126, 
+  8, 60, 72, 2, 29, 214, 2, 16, 180, 1, 160, 2, 4, 149, 1, 206, 5, 0, 40, 1, 
+  29, 40, 8, 30, 40, 4, 30, 40, 32, 29, 144, 3, 0, 40, 1, 30, 40, 8, 29, 50, 
+  4, 40, 50, 32, 39, 144, 3, 0, 40, 1, 30, 40, 8, 29, 50, 4, 40, 50, 32, 39, 
+  144, 3, 0, 40, 1, 30, 40, 8, 29, 50, 4, 40, 50, 32, 39, 144, 3, 0, 0, 192, 
+  4, 56, 40, 172, 2, 0, 0, 192, 4, 15, 16, 172, 2, 0, 0, 128, 32, 10, 250, 1, 
+  0, 0, 128, 32, 9, 150, 1, 0, 66, 30, 1, 19, 30, 8, 20, 20, 2, 9, 170, 1, 
+  16, 160, 1, 70, 4, 59, 90, 32, 79, 175, 1, 0, 30, 1, 19, 30, 8, 20, 20, 2, 
+  9, 20, 16, 10, 20, 4, 10, 30, 32, 19, 150, 1, 0, 30, 1, 19, 30, 8, 20, 20, 
+  2, 9, 20, 16, 10, 40, 4, 30, 40, 32, 29, 125, 0, 30, 1, 19, 30, 8, 20, 20, 
+  2, 9, 20, 16, 10, 30, 4, 20, 30, 32, 19, 100, 0, 30, 1, 19, 30, 8, 20, 20, 
+  2, 9, 20, 16, 10, 40, 4, 30, 40, 32, 29, 203, 1, 0, 84, 1, 200, 1, 84, 8, 
+  199, 1, 120, 0, 84, 1, 199, 1, 84, 8, 200, 1, 120, 0, 84, 1, 200, 1, 84, 8, 
+  199, 1, 120, 0, 84, 1, 199, 1, 84, 8, 200, 1, 120, 0, 84, 1, 200, 1, 84, 8, 
+  199, 1, 120, 0, 84, 1, 199, 1, 84, 8, 200, 1, 120, 0, 84, 1, 200, 1, 84, 8, 
+  199, 1, 120, 0, 84, 1, 199, 1, 84, 8, 200, 1, 120, 0, 84, 1, 200, 1, 84, 8, 
+  199, 1, 120, 0, 0, 192, 45, 68, 52, 68, 52, 20, 152, 2, 0, 0, 128, 32, 19, 20, 
+  0, 45, 197, 2, 1, 119, 197, 2, 8, 120, 200, 1, 2, 69, 191, 4, 16, 220, 1, 216, 
+  4, 4, 229, 1, 225, 1, 32, 80, 232, 7, 0, 6, 1, 9, 6, 8, 10, 100, 0, 9, 
+  1, 20, 9, 8, 19, 100, 0, 9, 1, 19, 9, 8, 20, 100, 0, 9, 1, 20, 9, 8, 
+  19, 100, 0, 9, 1, 19, 9, 8, 20, 100, 0, 9, 1, 20, 9, 8, 19, 100, 0, 9, 
+  1, 19, 9, 8, 20, 100, 0, 9, 1, 20, 9, 8, 19, 100, 0, 9, 1, 19, 9, 8, 
+  20, 100, 0, 9, 1, 20, 9, 8, 19, 100, 0, 9, 1, 19, 9, 8, 20, 100, 0, 9, 
+  1, 20, 9, 8, 19, 100, 0, 0, 192, 13, 88, 68, 88, 68, 144, 3, 0, 109, 12, 1, 
+  110, 6, 8, 49, 11, 2, 100, 11, 16, 99, 17, 4, 159, 1, 11, 32, 99, 50, 0, 5, 
+  1, 40, 12, 8, 110, 7, 2, 59, 13, 16, 120, 1, 0, 13, 32, 120, 50, 0, 4, 1, 
+  29, 2, 8, 10, 5, 2, 40, 17, 16, 160, 1, 13, 4, 120, 2, 32, 9, 50, 0, 5, 
+  1, 40, 16, 8, 149, 1, 3, 2, 20, 2, 16, 10, 10, 4, 90, 11, 32, 99, 50, 0, 
+  12, 1, 109, 26, 8, 250, 1, 12, 2, 110, 1, 0, 20, 4, 189, 1, 15, 32, 140, 1, 
+  50, 0, 17, 1, 159, 1, 26, 8, 249, 1, 19, 2, 179, 1, 5, 16, 40, 10, 4, 90, 
+  9, 32, 79, 50, 0, 28, 1, 142, 2, 10, 8, 90, 21, 2, 200, 1, 25, 16, 239, 1, 
+  4, 4, 29, 4, 32, 30, 50, 0, 14, 1, 129, 1, 9, 8, 80, 1, 0, 3, 16, 20, 
+  14, 4, 130, 1, 22, 32, 209, 1, 50, 0, 7, 1, 59, 3, 8, 20, 19, 2, 179, 1, 
+  22, 16, 210, 1, 1, 0, 12, 32, 110, 50, 0, 5, 1, 39, 7, 8, 59, 9, 2, 80, 
+  30, 16, 161, 2, 26, 4, 249, 1, 21, 32, 200, 1, 50, 0, 8, 1, 69, 15, 8, 139, 
+  1, 1, 0, 21, 16, 200, 1, 23, 4, 220, 1, 19, 32, 179, 1, 50, 0, 19, 1, 180, 
+  1, 3, 8, 19, 6, 2, 50, 7, 16, 59, 20, 4, 189, 1, 9, 32, 80, 50, 0, 0, 
+  192, 13, 74, 68, 86, 62, 80, 0, 0, 192, 13, 10, 25, 13, 19, 80, 0, 0, 192, 13, 
+  19, 2, 3, 2, 80, 0, 0, 192, 13, 14, 14, 1, 12, 80, 0, 0, 192, 13, 3, 5, 
+  5, 2, 80, 0, 0, 192, 13, 13, 9, 10, 13, 80, 0, 0, 128, 32, 20, 20, 0, 0, 
+  128, 32, 0, 20, 0, 0, 128, 32, 0, 20, 0, 0, 128, 32, 0, 20, 0, 0, 128, 32, 
+  0, 20, 0, 0, 128, 32, 0, 60, 0, 0, 128, 32, 19, 108, 32, 1, 149, 1, 32, 8, 
+  150, 1, 20, 2, 89, 50, 16, 240, 1, 80, 0, 62, 1, 172, 2, 62, 8, 171, 2, 74, 
+  2, 232, 2, 74, 16, 231, 2, 80, 0, 62, 1, 171, 2, 62, 8, 172, 2, 74, 2, 231, 
+  2, 74, 16, 232, 2, 80, 0, 62, 1, 172, 2, 62, 8, 171, 2, 74, 2, 232, 2, 74, 
+  16, 231, 2, 80, 0, 62, 1, 171, 2, 62, 8, 172, 2, 74, 2, 231, 2, 74, 16, 232, 
+  2, 80, 0, 62, 1, 172, 2, 62, 8, 171, 2, 74, 2, 232, 2, 74, 16, 231, 2, 80, 
+  0, 62, 1, 171, 2, 62, 8, 172, 2, 74, 2, 231, 2, 74, 16, 232, 2, 80, 0, 62, 
+  1, 172, 2, 62, 8, 171, 2, 74, 2, 232, 2, 74, 16, 231, 2, 80, 0, 62, 1, 171, 
+  2, 62, 8, 172, 2, 74, 2, 231, 2, 74, 16, 232, 2, 80, 0, 62, 1, 172, 2, 62, 
+  8, 171, 2, 74, 2, 232, 2, 74, 16, 231, 2, 80, 0, 62, 1, 171, 2, 62, 8, 172, 
+  2, 74, 2, 231, 2, 74, 16, 232, 2, 80, 0, 62, 1, 172, 2, 62, 8, 171, 2, 74, 
+  2, 232, 2, 74, 16, 231, 2, 80, 0, 62, 1, 171, 2, 62, 8, 172, 2, 74, 2, 231, 
+  2, 74, 16, 232, 2, 80, 0, 62, 1, 172, 2, 62, 8, 171, 2, 74, 2, 232, 2, 74, 
+  16, 231, 2, 80, 0, 62, 1, 171, 2, 62, 8, 172, 2, 74, 2, 231, 2, 74, 16, 232, 
+  2, 80, 0, 62, 1, 172, 2, 62, 8, 171, 2, 74, 2, 232, 2, 74, 16, 231, 2, 80, 
+  0, 62, 1, 171, 2, 62, 8, 172, 2, 74, 2, 231, 2, 74, 16, 232, 2, 80, 0, 62, 
+  1, 172, 2, 62, 8, 171, 2, 74, 2, 232, 2, 74, 16, 231, 2, 80, 0, 62, 1, 171, 
+  2, 62, 8, 172, 2, 74, 2, 231, 2, 74, 16, 232, 2, 80, 0, 62, 1, 172, 2, 62, 
+  8, 171, 2, 74, 2, 232, 2, 74, 16, 231, 2, 80, 0, 78, 4, 249, 1, 33, 32, 100, 
+  100, 0, 99, 4, 192, 2, 99, 32, 191, 2, 100, 0, 0, 192, 13, 84, 64, 72, 56, 200, 
+  1, 0, 9, 134, 3, 1, 119, 134, 3, 8, 120, 240, 1, 2, 69, 178, 5, 16, 220, 1, 
+  178, 5, 4, 219, 1, 240, 1, 32, 70, 128, 21, 0, 0, 192, 13, 80, 60, 80, 60, 160, 
+  6, 0, 32, 90, 1, 80, 90, 8, 79, 90, 2, 80, 80, 16, 70, 150, 1, 0, 50, 1, 
+  39, 50, 8, 40, 40, 2, 29, 40, 16, 30, 200, 1, 0, 50, 1, 39, 50, 8, 40, 40, 
+  2, 29, 40, 16, 30, 250, 1, 0, 50, 1, 39, 50, 8, 40, 40, 2, 29, 40, 16, 30, 
+  172, 2, 0, 50, 1, 39, 50, 8, 40, 40, 2, 29, 40, 16, 30, 222, 2, 0, 180, 1, 
+  4, 109, 75, 32, 39, 244, 3, 0, 0, 192, 45, 56, 40, 56, 40, 10, 200, 1, 0, 0, 
+  128, 32, 9, 200, 1, 0, 33, 60, 1, 19, 60, 8, 20, 40, 2, 10, 172, 2, 16, 140, 
+  1, 120, 4, 49, 220, 1, 32, 99, 160, 6, 0, 20, 1, 9, 20, 8, 10, 222, 2, 0, 
+  70, 1, 60, 70, 8, 59, 222, 2, 0, 70, 1, 59, 70, 8, 60, 222, 2, 0, 70, 1, 
+  60, 70, 8, 59, 222, 2, 0, 70, 1, 59, 70, 8, 60, 222, 2, 0, 70, 1, 60, 70, 
+  8, 59, 222, 2, 0, 70, 1, 59, 70, 8, 60, 222, 2, 0, 70, 1, 60, 70, 8, 59, 
+  222, 2, 0, 0, 192, 13, 44, 32, 44, 32, 244, 3, 0, 28, 90, 1, 39, 90, 8, 40, 
+  36, 2, 9, 178, 2, 16, 160, 1, 188, 5, 0, 30, 1, 19, 30, 8, 20, 80, 4, 69, 
+  90, 32, 79, 244, 3, 0, 20, 1, 10, 20, 8, 9, 30, 4, 20, 30, 32, 19, 244, 3, 
+  0, 20, 1, 10, 20, 8, 9, 30, 4, 20, 30, 32, 19, 244, 3, 0, 0, 192, 4, 36, 
+  28, 172, 2, 0, 0, 192, 4, 7, 8, 172, 2, 0, 0, 128, 32, 20, 150, 1, 0, 0, 
+  128, 32, 19, 194, 3, 0, 9, 50, 1, 9, 50, 8, 10, 75, 2, 20, 222, 2, 16, 130, 
+  1, 100, 4, 29, 197, 2, 32, 119, 248, 40, 0, 0, 192, 13, 24, 16, 24, 16, 188, 5, 
+  0, 28, 60, 0, 120, 2, 30, 134, 3, 16, 120, 210, 1, 4, 59, 172, 2, 32, 89, 176, 
+  9, 0, 20, 1, 9, 20, 8, 10, 194, 3, 0, 30, 1, 20, 30, 8, 19, 194, 3, 0, 
+  30, 1, 19, 30, 8, 20, 194, 3, 0, 30, 1, 20, 30, 8, 19, 194, 3, 0, 30, 1, 
+  19, 30, 8, 20, 194, 3, 0, 30, 1, 20, 30, 8, 19, 194, 3, 0, 0, 192, 45, 16, 
+  12, 16, 12, 10, 100, 0, 0, 128, 32, 9, 188, 5, 0, 12, 70, 1, 9, 70, 8, 10, 
+  175, 1, 2, 40, 164, 3, 16, 110, 187, 2, 4, 79, 152, 2, 32, 69, 248, 10, 0, 30, 
+  1, 9, 30, 8, 10, 216, 4, 0, 0, 192, 31, 12, 8, 6, 12, 8, 6, 216, 4, 0, 
+  9, 160, 1, 1, 29, 160, 1, 8, 30, 240, 1, 2, 50, 184, 3, 16, 100, 144, 3, 4, 
+  89, 152, 2, 32, 59, 128, 52, 0, 0, 192, 31, 8, 6, 4, 8, 6, 4, 232, 7, 0, 
+  6, 100, 0, 244, 3, 2, 90, 222, 2, 16, 60, 244, 3, 4, 89, 222, 2, 32, 59, 200, 
+  56, 0
+};
+const uint16_t ALONE_STEP_OFFSETS[] PROGMEM = {
+  0, 95, 194, 277, 392, 482, 809, 890, 973, 1060, 1130, 1287, 
+  1325, 1432, 1633, 1900, 1966, 2073, 2245, 2339, 2419, 2458, 2747, 3078, 
+  3275, 3388, 3601, 3737, 4093, 4482, 4522, 4626, 4733, 4826, 4861, 4953, 
+  5000, 5040
+};
+
+// Mastie Mashup - 35 steps, 5303 bytes
+const uint8_t NEURAL_TRACKS[] PROGMEM = {
+  17, 178, 2, 0, 30, 2, 90, 150, 1, 0, 21, 16, 60, 150, 1, 0, 30, 4, 89, 150, 
+  1, 0, 21, 32, 59, 150, 1, 0, 15, 1, 19, 15, 8, 20, 200, 1, 0, 25, 1, 40, 
+  25, 8, 39, 200, 1, 0, 0, 192, 13, 4, 2, 4, 2, 144, 3, 0, 15, 16, 1, 29, 
+  84, 0, 16, 8, 30, 64, 16, 150, 1, 80, 0, 64, 4, 149, 1, 172, 9, 0, 24, 1, 
+  30, 24, 8, 29, 60, 2, 90, 60, 16, 89, 42, 4, 60, 42, 32, 59, 0, 192, 13, 8, 
+  6, 8, 6, 172, 2, 0, 25, 50, 1, 39, 100, 0, 20, 2, 10, 100, 0, 140, 1, 4, 
+  129, 1, 100, 0, 50, 8, 40, 100, 0, 150, 1, 16, 140, 1, 100, 0, 30, 32, 19, 100, 
+  0, 30, 1, 19, 30, 8, 20, 200, 1, 0, 30, 1, 20, 30, 8, 19, 200, 1, 0, 30, 
+  1, 20, 30, 8, 19, 200, 1, 0, 0, 192, 45, 12, 10, 12, 10, 10, 120, 0, 0, 128, 
+  32, 9, 180, 1, 0, 48, 15, 1, 19, 15, 8, 20, 20, 2, 30, 65, 16, 120, 150, 1, 
+  0, 25, 1, 40, 25, 8, 39, 65, 2, 120, 65, 16, 119, 150, 1, 0, 25, 1, 39, 25, 
+  8, 40, 65, 2, 119, 65, 16, 120, 150, 1, 0, 25, 1, 40, 25, 8, 39, 65, 2, 120, 
+  65, 16, 119, 150, 1, 0, 25, 1, 39, 25, 8, 40, 65, 2, 119, 65, 16, 120, 150, 1, 
+  0, 25, 1, 40, 25, 8, 39, 65, 2, 120, 65, 16, 119, 150, 1, 0, 25, 1, 39, 25, 
+  8, 40, 65, 2, 119, 65, 16, 120, 150, 1, 0, 25, 1, 40, 25, 8, 39, 65, 2, 120, 
+  65, 16, 119, 150, 1, 0, 42, 4, 129, 1, 9, 32, 19, 100, 0, 27, 4, 80, 27, 32, 
+  79, 100, 0, 0, 192, 13, 16, 12, 16, 12, 250, 1, 0, 26, 70, 1, 59, 20, 2, 9, 
+  160, 1, 4, 149, 1, 200, 1, 0, 70, 8, 60, 170, 1, 16, 160, 1, 210, 1, 0, 30, 
+  1, 20, 30, 8, 19, 30, 2, 20, 30, 16, 19, 250, 1, 0, 40, 1, 30, 40, 8, 29, 
+  50, 2, 40, 50, 16, 39, 250, 1, 0, 40, 1, 30, 40, 8, 29, 50, 2, 40, 50, 16, 
+  39, 250, 1, 0, 0, 192, 45, 20, 16, 12, 8, 18, 200, 1, 0, 0, 128, 32, 17, 200, 
+  1, 0, 41, 32, 1, 29, 32, 8, 30, 24, 2, 20, 112, 16, 130, 1, 104, 4, 119, 32, 
+  32, 29, 144, 3, 0, 6, 1, 9, 6, 8, 10, 100, 0, 9, 1, 20, 9, 8, 19, 100, 
+  0, 9, 1, 19, 9, 8, 20, 100, 0, 9, 1, 20, 9, 8, 19, 100, 0, 9, 1, 19, 
+  9, 8, 20, 100, 0, 9, 1, 20, 9, 8, 19, 100, 0, 9, 1, 19, 9, 8, 20, 100, 
+  0, 9, 1, 20, 9, 8, 19, 100, 0, 9, 1, 19, 9, 8, 20, 100, 0, 9, 1, 20, 
+  9, 8, 19, 100, 0, 0, 192, 45, 24, 20, 24, 20, 20, 150, 1, 0, 0, 128, 32, 19, 
+  150, 1, 0, 88, 22, 1, 99, 22, 8, 100, 12, 2, 49, 42, 16, 200, 1, 40, 4, 189, 
+  1, 10, 32, 40, 80, 0, 42, 1, 200, 1, 42, 8, 199, 1, 58, 2, 152, 2, 58, 16, 
+  151, 2, 42, 4, 200, 1, 42, 32, 199, 1, 80, 0, 42, 1, 199, 1, 42, 8, 200, 1, 
+  58, 2, 151, 2, 58, 16, 152, 2, 42, 4, 199, 1, 42, 32, 200, 1, 80, 0, 42, 1, 
+  200, 1, 42, 8, 199, 1, 58, 2, 152, 2, 58, 16, 151, 2, 42, 4, 200, 1, 42, 32, 
+  199, 1, 80, 0, 42, 1, 199, 1, 42, 8, 200, 1, 58, 2, 151, 2, 58, 16, 152, 2, 
+  42, 4, 199, 1, 42, 32, 200, 1, 80, 0, 42, 1, 200, 1, 42, 8, 199, 1, 58, 2, 
+  152, 2, 58, 16, 151, 2, 42, 4, 200, 1, 42, 32, 199, 1, 80, 0, 42, 1, 199, 1, 
+  42, 8, 200, 1, 58, 2, 151, 2, 58, 16, 152, 2, 42, 4, 199, 1, 42, 32, 200, 1, 
+  80, 0, 42, 1, 200, 1, 42, 8, 199, 1, 58, 2, 152, 2, 58, 16, 151, 2, 42, 4, 
+  200, 1, 42, 32, 199, 1, 80, 0, 42, 1, 199, 1, 42, 8, 200, 1, 58, 2, 151, 2, 
+  58, 16, 152, 2, 42, 4, 199, 1, 42, 32, 200, 1, 80, 0, 42, 1, 200, 1, 42, 8, 
+  199, 1, 58, 2, 152, 2, 58, 16, 151, 2, 42, 4, 200, 1, 42, 32, 199, 1, 80, 0, 
+  42, 1, 199, 1, 42, 8, 200, 1, 58, 2, 151, 2, 58, 16, 152, 2, 42, 4, 199, 1, 
+  42, 32, 200, 1, 80, 0, 42, 1, 200, 1, 42, 8, 199, 1, 58, 2, 152, 2, 58, 16, 
+  151, 2, 42, 4, 200, 1, 42, 32, 199, 1, 80, 0, 0, 192, 45, 32, 24, 32, 24, 20, 
+  100, 0, 0, 128, 32, 19, 50, 0, 66, 28, 1, 59, 28, 8, 60, 120, 0, 36, 1, 80, 
+  36, 8, 79, 120, 0, 36, 1, 79, 36, 8, 80, 120, 0, 36, 1, 80, 36, 8, 79, 120, 
+  0, 36, 1, 79, 36, 8, 80, 120, 0, 36, 1, 80, 36, 8, 79, 120, 0, 36, 1, 79, 
+  36, 8, 80, 120, 0, 36, 1, 80, 36, 8, 79, 123, 0, 48, 16, 150, 1, 48, 4, 149, 
+  1, 103, 0, 21, 2, 60, 21, 16, 59, 39, 4, 120, 39, 32, 119, 100, 0, 21, 2, 59, 
+  21, 16, 60, 39, 4, 119, 39, 32, 120, 100, 0, 21, 2, 60, 21, 16, 59, 39, 4, 120, 
+  39, 32, 119, 100, 0, 21, 2, 59, 21, 16, 60, 39, 4, 119, 39, 32, 120, 100, 0, 21, 
+  2, 60, 21, 16, 59, 39, 4, 120, 39, 32, 119, 100, 0, 21, 2, 59, 21, 16, 60, 39, 
+  4, 119, 39, 32, 120, 100, 0, 21, 2, 60, 21, 16, 59, 39, 4, 120, 39, 32, 119, 100, 
+  0, 0, 192, 4, 28, 20, 150, 1, 0, 0, 192, 4, 7, 8, 200, 1, 0, 33, 30, 1, 
+  19, 30, 8, 20, 40, 2, 30, 130, 1, 16, 120, 144, 3, 0, 30, 1, 19, 30, 8, 20, 
+  110, 4, 99, 60, 32, 49, 200, 1, 0, 20, 2, 9, 20, 16, 10, 200, 1, 0, 20, 1, 
+  10, 20, 8, 9, 30, 4, 20, 30, 32, 19, 200, 1, 0, 30, 2, 20, 30, 16, 19, 200, 
+  1, 0, 20, 1, 10, 20, 8, 9, 30, 4, 20, 30, 32, 19, 200, 1, 0, 30, 2, 20, 
+  30, 16, 19, 200, 1, 0, 0, 192, 45, 24, 16, 24, 16, 10, 180, 1, 0, 0, 128, 32, 
+  9, 170, 1, 0, 39, 120, 1, 89, 120, 8, 90, 48, 2, 29, 228, 1, 16, 180, 1, 228, 
+  1, 4, 179, 1, 48, 32, 30, 244, 3, 0, 90, 1, 80, 90, 8, 79, 130, 1, 2, 120, 
+  130, 1, 16, 119, 150, 1, 0, 20, 1, 9, 20, 8, 10, 30, 2, 19, 30, 16, 20, 150, 
+  1, 0, 30, 1, 19, 30, 8, 20, 30, 2, 19, 30, 16, 20, 150, 1, 0, 20, 1, 9, 
+  20, 8, 10, 40, 2, 29, 40, 16, 30, 150, 1, 0, 30, 1, 19, 30, 8, 20, 30, 2, 
+  19, 30, 16, 20, 150, 1, 0, 80, 1, 70, 80, 8, 69, 100, 2, 90, 100, 16, 89, 172, 
+  2, 0, 0, 192, 13, 16, 12, 16, 12, 144, 3, 0, 60, 15, 1, 19, 15, 8, 20, 40, 
+  2, 70, 45, 16, 80, 160, 1, 0, 25, 1, 40, 25, 8, 39, 25, 2, 40, 25, 16, 39, 
+  160, 1, 0, 28, 1, 59, 28, 8, 60, 28, 2, 59, 28, 16, 60, 140, 1, 0, 36, 1, 
+  80, 36, 8, 79, 36, 2, 80, 36, 16, 79, 140, 1, 0, 36, 1, 109, 36, 8, 110, 33, 
+  2, 99, 33, 16, 100, 120, 0, 45, 1, 140, 1, 45, 8, 139, 1, 39, 2, 120, 39, 16, 
+  119, 120, 0, 34, 1, 159, 1, 34, 8, 160, 1, 30, 2, 139, 1, 30, 16, 140, 1, 100, 
+  0, 38, 1, 180, 1, 38, 8, 179, 1, 34, 2, 160, 1, 34, 16, 159, 1, 100, 0, 22, 
+  1, 209, 1, 22, 8, 210, 1, 19, 2, 179, 1, 19, 16, 180, 1, 80, 0, 25, 1, 240, 
+  1, 25, 8, 239, 1, 21, 2, 200, 1, 21, 16, 199, 1, 80, 0, 54, 4, 169, 1, 9, 
+  32, 20, 100, 0, 51, 4, 160, 1, 51, 32, 159, 1, 100, 0, 0, 192, 45, 32, 24, 32, 
+  24, 12, 200, 1, 0, 0, 128, 32, 11, 200, 1, 0, 85, 8, 1, 30, 18, 8, 79, 38, 
+  2, 180, 1, 6, 16, 19, 10, 4, 39, 62, 0, 20, 1, 89, 16, 8, 70, 36, 2, 169, 
+  1, 38, 16, 180, 1, 4, 4, 9, 12, 32, 49, 60, 0, 4, 1, 9, 10, 8, 39, 24, 
+  2, 110, 26, 16, 119, 4, 4, 9, 12, 32, 50, 60, 0, 4, 1, 10, 2, 0, 8, 2, 
+  30, 12, 16, 50, 12, 4, 49, 6, 32, 19, 60, 0, 22, 1, 100, 12, 8, 49, 12, 2, 
+  49, 30, 16, 139, 1, 16, 4, 69, 4, 32, 10, 60, 0, 18, 1, 79, 22, 8, 100, 10, 
+  2, 39, 10, 16, 40, 26, 4, 120, 16, 32, 69, 60, 0, 6, 1, 20, 24, 8, 110, 6, 
+  2, 19, 16, 16, 69, 8, 4, 29, 12, 32, 49, 60, 0, 8, 1, 30, 2, 0, 34, 2, 
+  160, 1, 36, 16, 170, 1, 14, 4, 60, 10, 32, 40, 60, 0, 8, 1, 29, 26, 8, 119, 
+  4, 2, 10, 34, 16, 159, 1, 6, 4, 20, 24, 32, 110, 60, 0, 16, 1, 70, 12, 8, 
+  49, 8, 2, 29, 36, 16, 170, 1, 12, 4, 49, 24, 32, 109, 60, 0, 30, 1, 49, 50, 
+  8, 90, 150, 1, 0, 15, 1, 19, 10, 8, 10, 155, 1, 0, 15, 8, 19, 150, 1, 0, 
+  0, 192, 13, 34, 22, 38, 18, 100, 0, 0, 192, 5, 9, 9, 5, 100, 0, 0, 192, 13, 
+  6, 2, 4, 10, 100, 0, 0, 192, 13, 3, 8, 11, 13, 144, 3, 0, 11, 30, 1, 9, 
+  30, 8, 10, 105, 2, 60, 150, 1, 16, 90, 165, 1, 4, 99, 90, 32, 49, 152, 18, 0, 
+  0, 192, 45, 20, 16, 20, 16, 10, 150, 1, 0, 0, 128, 32, 9, 250, 1, 0, 38, 50, 
+  1, 39, 20, 2, 10, 140, 1, 4, 129, 1, 250, 1, 0, 50, 8, 40, 150, 1, 16, 140, 
+  1, 30, 32, 19, 250, 1, 0, 30, 1, 19, 30, 8, 20, 20, 2, 9, 20, 16, 10, 20, 
+  4, 10, 20, 32, 9, 200, 1, 0, 20, 1, 10, 20, 8, 9, 40, 2, 30, 40, 16, 29, 
+  30, 4, 20, 30, 32, 19, 200, 1, 0, 30, 1, 20, 30, 8, 19, 40, 2, 30, 40, 16, 
+  29, 30, 4, 20, 30, 32, 19, 200, 1, 0, 20, 1, 10, 20, 8, 9, 40, 2, 30, 40, 
+  16, 29, 30, 4, 20, 30, 32, 19, 200, 1, 0, 0, 192, 13, 28, 20, 16, 12, 222, 2, 
+  0, 63, 20, 1, 39, 20, 8, 40, 12, 2, 20, 56, 16, 130, 1, 120, 0, 8, 1, 10, 
+  8, 8, 9, 128, 1, 0, 8, 1, 10, 8, 8, 9, 128, 1, 0, 8, 1, 10, 8, 8, 
+  9, 128, 1, 0, 8, 1, 9, 8, 8, 10, 8, 2, 10, 8, 16, 9, 100, 0, 8, 1, 
+  10, 8, 8, 9, 108, 0, 8, 1, 10, 8, 8, 9, 108, 0, 8, 1, 10, 8, 8, 9, 
+  108, 0, 8, 1, 9, 8, 8, 10, 12, 2, 20, 12, 16, 19, 80, 0, 8, 1, 10, 8, 
+  8, 9, 88, 0, 8, 1, 10, 8, 8, 9, 88, 0, 8, 1, 10, 8, 8, 9, 88, 0, 
+  8, 1, 9, 8, 8, 10, 8, 2, 10, 8, 16, 9, 60, 0, 8, 1, 10, 8, 8, 9, 
+  68, 0, 8, 1, 10, 8, 8, 9, 68, 0, 8, 1, 10, 8, 8, 9, 68, 0, 120, 4, 
+  109, 50, 32, 39, 172, 2, 0, 0, 192, 45, 32, 24, 32, 24, 20, 200, 1, 0, 0, 128, 
+  32, 19, 100, 0, 74, 20, 1, 29, 80, 0, 65, 2, 120, 80, 0, 80, 4, 149, 1, 80, 
+  0, 35, 8, 60, 80, 0, 20, 16, 30, 80, 0, 20, 32, 29, 206, 4, 0, 15, 1, 20, 
+  80, 0, 15, 2, 20, 80, 0, 15, 4, 20, 80, 0, 15, 8, 20, 80, 0, 15, 16, 20, 
+  80, 0, 15, 32, 20, 80, 0, 20, 32, 29, 80, 0, 20, 16, 29, 80, 0, 20, 8, 29, 
+  80, 0, 20, 4, 29, 80, 0, 20, 2, 29, 80, 0, 20, 1, 29, 80, 0, 30, 1, 50, 
+  80, 0, 30, 2, 50, 80, 0, 30, 4, 50, 80, 0, 30, 8, 50, 80, 0, 30, 16, 50, 
+  80, 0, 30, 32, 50, 80, 0, 35, 32, 59, 80, 0, 35, 16, 59, 80, 0, 35, 8, 59, 
+  80, 0, 35, 4, 59, 80, 0, 35, 2, 59, 80, 0, 35, 1, 59, 80, 0, 48, 1, 50, 
+  100, 0, 16, 2, 9, 100, 0, 72, 4, 80, 100, 0, 40, 8, 39, 100, 0, 48, 16, 50, 
+  100, 0, 16, 32, 9, 100, 0, 0, 192, 13, 24, 18, 24, 18, 144, 3, 0, 93, 27, 1, 
+  79, 27, 8, 80, 12, 2, 29, 57, 16, 180, 1, 54, 4, 169, 1, 9, 32, 20, 100, 0, 
+  51, 1, 160, 1, 51, 8, 159, 1, 75, 2, 240, 1, 75, 16, 239, 1, 51, 4, 160, 1, 
+  51, 32, 159, 1, 100, 0, 51, 1, 159, 1, 51, 8, 160, 1, 75, 2, 239, 1, 75, 16, 
+  240, 1, 51, 4, 159, 1, 51, 32, 160, 1, 100, 0, 51, 1, 160, 1, 51, 8, 159, 1, 
+  75, 2, 240, 1, 75, 16, 239, 1, 51, 4, 160, 1, 51, 32, 159, 1, 100, 0, 51, 1, 
+  159, 1, 51, 8, 160, 1, 75, 2, 239, 1, 75, 16, 240, 1, 51, 4, 159, 1, 51, 32, 
+  160, 1, 100, 0, 51, 1, 160, 1, 51, 8, 159, 1, 75, 2, 240, 1, 75, 16, 239, 1, 
+  51, 4, 160, 1, 51, 32, 159, 1, 100, 0, 51, 1, 159, 1, 51, 8, 160, 1, 75, 2, 
+  239, 1, 75, 16, 240, 1, 51, 4, 159, 1, 51, 32, 160, 1, 100, 0, 51, 1, 160, 1, 
+  51, 8, 159, 1, 75, 2, 240, 1, 75, 16, 239, 1, 51, 4, 160, 1, 51, 32, 159, 1, 
+  100, 0, 51, 1, 159, 1, 51, 8, 160, 1, 75, 2, 239, 1, 75, 16, 240, 1, 51, 4, 
+  159, 1, 51, 32, 160, 1, 100, 0, 51, 1, 160, 1, 51, 8, 159, 1, 75, 2, 240, 1, 
+  75, 16, 239, 1, 51, 4, 160, 1, 51, 32, 159, 1, 100, 0, 51, 1, 159, 1, 51, 8, 
+  160, 1, 75, 2, 239, 1, 75, 16, 240, 1, 51, 4, 159, 1, 51, 32, 160, 1, 100, 0, 
+  51, 1, 160, 1, 51, 8, 159, 1, 75, 2, 240, 1, 75, 16, 239, 1, 51, 4, 160, 1, 
+  51, 32, 159, 1, 100, 0, 142, 2, 1, 169, 1, 142, 2, 8, 170, 1, 134, 3, 2, 249, 
+  1, 134, 3, 16, 250, 1, 244, 3, 0, 0, 192, 45, 36, 28, 36, 28, 10, 120, 0, 0, 
+  128, 32, 9, 80, 0, 44, 160, 1, 1, 149, 1, 160, 1, 8, 150, 1, 40, 2, 29, 190, 
+  1, 16, 180, 1, 200, 1, 4, 189, 1, 50, 32, 40, 50, 0, 40, 1, 30, 40, 8, 29, 
+  30, 2, 20, 30, 16, 19, 30, 4, 20, 30, 32, 19, 80, 0, 40, 1, 30, 40, 8, 29, 
+  30, 2, 20, 30, 16, 19, 30, 4, 20, 30, 32, 19, 110, 0, 40, 1, 30, 40, 8, 29, 
+  40, 2, 30, 40, 16, 29, 30, 4, 20, 30, 32, 19, 140, 1, 0, 40, 1, 30, 40, 8, 
+  29, 30, 2, 20, 30, 16, 19, 30, 4, 20, 30, 32, 19, 170, 1, 0, 48, 1, 30, 48, 
+  8, 29, 48, 2, 30, 48, 16, 29, 36, 4, 20, 36, 32, 19, 144, 3, 0, 0, 192, 13, 
+  12, 8, 12, 8, 172, 2, 0, 28, 26, 1, 119, 26, 8, 120, 14, 2, 59, 44, 16, 210, 
+  1, 44, 4, 209, 1, 14, 32, 60, 234, 3, 0, 40, 1, 30, 40, 8, 29, 50, 2, 40, 
+  50, 16, 39, 150, 1, 0, 40, 1, 30, 40, 8, 29, 50, 2, 40, 50, 16, 39, 150, 1, 
+  0, 40, 1, 30, 40, 8, 29, 50, 2, 40, 50, 16, 39, 150, 1, 0, 0, 192, 45, 40, 
+  32, 40, 32, 18, 200, 1, 0, 0, 128, 32, 5, 200, 1, 0, 0, 128, 32, 11, 200, 1, 
+  0, 56, 24, 1, 109, 22, 8, 100, 10, 2, 39, 38, 16, 180, 1, 40, 4, 189, 1, 14, 
+  32, 60, 80, 0, 6, 1, 20, 4, 8, 9, 4, 2, 10, 4, 0, 4, 32, 10, 80, 0, 
+  4, 1, 9, 2, 0, 6, 2, 19, 2, 0, 6, 4, 20, 8, 32, 29, 80, 0, 4, 1, 
+  9, 6, 8, 20, 4, 2, 9, 6, 16, 20, 4, 4, 9, 8, 32, 30, 86, 0, 4, 16, 
+  9, 8, 4, 29, 82, 0, 4, 1, 10, 4, 8, 9, 4, 2, 10, 4, 16, 9, 2, 0, 
+  14, 32, 59, 84, 0, 8, 2, 30, 2, 0, 6, 4, 20, 6, 32, 20, 84, 0, 6, 2, 
+  19, 4, 16, 10, 2, 0, 6, 32, 19, 80, 0, 40, 1, 10, 40, 8, 9, 40, 2, 10, 
+  40, 16, 9, 40, 4, 10, 60, 32, 20, 192, 10, 0, 0, 192, 13, 44, 36, 44, 36, 244, 
+  3, 0, 91, 216, 1, 0, 18, 1, 49, 24, 8, 70, 57, 2, 180, 1, 103, 0, 6, 1, 
+  10, 3, 0, 42, 2, 129, 1, 33, 16, 100, 103, 0, 27, 8, 79, 36, 2, 110, 15, 16, 
+  39, 100, 0, 30, 1, 90, 6, 8, 9, 36, 2, 109, 6, 16, 10, 100, 0, 30, 1, 89, 
+  21, 8, 59, 21, 2, 60, 21, 16, 59, 100, 0, 12, 1, 30, 27, 8, 80, 12, 2, 29, 
+  15, 16, 39, 100, 0, 12, 1, 30, 3, 0, 12, 2, 29, 48, 16, 150, 1, 100, 0, 12, 
+  1, 30, 15, 8, 40, 15, 2, 39, 36, 16, 109, 100, 0, 28, 4, 129, 1, 80, 0, 18, 
+  4, 80, 80, 0, 6, 32, 19, 80, 0, 18, 32, 79, 80, 0, 18, 4, 79, 80, 0, 18, 
+  4, 80, 80, 0, 18, 32, 80, 80, 0, 18, 32, 79, 80, 0, 18, 4, 79, 80, 0, 18, 
+  4, 80, 80, 0, 18, 32, 80, 80, 0, 18, 32, 79, 80, 0, 18, 4, 79, 80, 0, 18, 
+  4, 80, 80, 0, 18, 32, 80, 80, 0, 18, 32, 79, 80, 0, 18, 4, 79, 80, 0, 18, 
+  4, 80, 80, 0, 18, 32, 80, 80, 0, 18, 32, 79, 80, 0, 18, 4, 79, 80, 0, 18, 
+  4, 80, 80, 0, 18, 32, 80, 80, 0, 18, 32, 79, 80, 0, 0, 192, 4, 16, 24, 150, 
+  1, 0, 0, 192, 4, 8, 7, 194, 3, 0, 27, 50, 1, 39, 50, 8, 40, 70, 2, 60, 
+  100, 16, 90, 120, 4, 109, 50, 32, 39, 172, 2, 0, 30, 1, 20, 30, 8, 19, 20, 2, 
+  10, 20, 16, 9, 20, 4, 10, 20, 32, 9, 242, 2, 0, 20, 2, 10, 20, 16, 9, 164, 
+  3, 0, 20, 1, 10, 20, 8, 9, 130, 4, 0, 24, 2, 9, 24, 16, 10, 140, 4, 0, 
+  0, 192, 45, 20, 16, 20, 16, 10, 160, 1, 0, 0, 128, 32, 9, 240, 1, 0, 127, 40, 
+  1, 29, 40, 8, 30, 60, 2, 50, 110, 16, 100, 120, 4, 109, 50, 32, 39, 180, 1, 0, 
+  6, 1, 9, 6, 8, 10, 60, 0, 9, 1, 20, 9, 8, 19, 60, 0, 9, 1, 19, 9, 
+  8, 20, 60, 0, 9, 1, 20, 9, 8, 19, 60, 0, 9, 1, 19, 9, 8, 20, 60, 0, 
+  9, 1, 20, 9, 8, 19, 60, 0, 30, 1, 19, 30, 8, 20, 20, 2, 9, 20, 16, 10, 
+  20, 4, 9, 20, 32, 10, 180, 1, 0, 6, 1, 9, 6, 8, 10, 60, 0, 9, 1, 20, 
+  9, 8, 19, 60, 0, 9, 1, 19, 9, 8, 20, 60, 0, 9, 1, 20, 9, 8, 19, 60, 
+  0, 9, 1, 19, 9, 8, 20, 60, 0, 9, 1, 20, 9, 8, 19, 60, 0, 30, 1, 19, 
+  30, 8, 20, 30, 2, 19, 30, 16, 20, 20, 4, 9, 20, 32, 10, 180, 1, 0, 6, 1, 
+  9, 6, 8, 10, 60, 0, 9, 1, 20, 9, 8, 19, 60, 0, 9, 1, 19, 9, 8, 20, 
+  60, 0, 9, 1, 20, 9, 8, 19, 60, 0, 9, 1, 19, 9, 8, 20, 60, 0, 9, 1, 
+  20, 9, 8, 19, 60, 0, 30, 1, 19, 30, 8, 20, 20, 2, 9, 20, 16, 10, 20, 4, 
+  9, 20, 32, 10, 180, 1, 0, 6, 1, 9, 6, 8, 10, 60, 0, 9, 1, 20, 9, 8, 
+  19, 60, 0, 9, 1, 19, 9, 8, 20, 60, 0, 9, 1, 20, 9, 8, 19, 60, 0, 9, 
+  1, 19, 9, 8, 20, 60, 0, 9, 1, 20, 9, 8, 19, 60, 0, 30, 1, 19, 30, 8, 
+  20, 30, 2, 19, 30, 16, 20, 20, 4, 9, 20, 32, 10, 180, 1, 0, 6, 1, 9, 6, 
+  8, 10, 60, 0, 9, 1, 20, 9, 8, 19, 60, 0, 9, 1, 19, 9, 8, 20, 60, 0, 
+  9, 1, 20, 9, 8, 19, 60, 0, 9, 1, 19, 9, 8, 20, 60, 0, 9, 1, 20, 9, 
+  8, 19, 60, 0, 0, 192, 13, 28, 22, 28, 22, 222, 2, 0, 80, 70, 1, 59, 10, 0, 
+  140, 1, 4, 129, 1, 150, 1, 0, 70, 8, 60, 160, 1, 16, 150, 1, 30, 32, 19, 150, 
+  1, 0, 20, 1, 10, 30, 2, 20, 20, 4, 10, 150, 1, 0, 20, 8, 9, 30, 16, 19, 
+  20, 32, 9, 150, 1, 0, 20, 1, 10, 30, 2, 20, 30, 4, 20, 150, 1, 0, 20, 8, 
+  9, 30, 16, 19, 30, 32, 19, 150, 1, 0, 20, 1, 10, 30, 2, 20, 20, 4, 10, 150, 
+  1, 0, 20, 8, 9, 30, 16, 19, 20, 32, 9, 150, 1, 0, 8, 1, 9, 32, 2, 70, 
+  20, 4, 39, 8, 8, 10, 32, 16, 69, 20, 32, 40, 200, 1, 0, 30, 1, 40, 30, 2, 
+  39, 30, 4, 40, 30, 8, 39, 30, 16, 40, 30, 32, 39, 200, 1, 0, 20, 1, 39, 20, 
+  2, 40, 20, 4, 39, 20, 8, 40, 20, 16, 39, 20, 32, 40, 200, 1, 0, 30, 1, 40, 
+  30, 2, 39, 30, 4, 40, 30, 8, 39, 30, 16, 40, 30, 32, 39, 200, 1, 0, 20, 1, 
+  39, 20, 2, 40, 20, 4, 39, 20, 8, 40, 20, 16, 39, 20, 32, 40, 200, 1, 0, 30, 
+  1, 40, 30, 2, 39, 30, 4, 40, 30, 8, 39, 30, 16, 40, 30, 32, 39, 200, 1, 0, 
+  0, 192, 45, 32, 24, 24, 18, 10, 150, 1, 0, 0, 128, 32, 10, 150, 1, 0, 0, 128, 
+  32, 19, 200, 1, 0, 106, 11, 1, 99, 11, 8, 99, 5, 2, 39, 4, 16, 29, 16, 4, 
+  149, 1, 15, 32, 139, 1, 50, 0, 22, 1, 210, 1, 11, 8, 100, 1, 0, 16, 16, 150, 
+  1, 10, 4, 90, 11, 32, 100, 50, 0, 9, 1, 79, 13, 8, 119, 27, 2, 132, 2, 1, 
+  0, 4, 4, 29, 2, 32, 9, 50, 0, 11, 1, 99, 18, 8, 170, 1, 1, 0, 4, 16, 
+  30, 11, 4, 100, 51, 0, 15, 1, 140, 1, 13, 8, 119, 4, 2, 29, 20, 16, 189, 1, 
+  12, 4, 109, 8, 32, 69, 50, 0, 2, 1, 10, 14, 8, 130, 1, 5, 2, 39, 10, 16, 
+  90, 9, 4, 79, 12, 32, 110, 50, 0, 6, 1, 50, 7, 8, 60, 6, 2, 50, 11, 16, 
+  99, 18, 4, 170, 1, 16, 32, 149, 1, 50, 0, 18, 1, 169, 1, 16, 8, 149, 1, 3, 
+  2, 20, 11, 16, 100, 7, 4, 59, 15, 32, 140, 1, 50, 0, 13, 1, 120, 8, 8, 70, 
+  19, 2, 179, 1, 15, 16, 140, 1, 14, 4, 129, 1, 2, 32, 10, 51, 0, 18, 8, 169, 
+  1, 5, 2, 40, 25, 16, 239, 1, 6, 4, 50, 51, 0, 54, 1, 169, 1, 69, 8, 220, 
+  1, 30, 2, 89, 66, 16, 210, 1, 100, 0, 9, 1, 20, 6, 8, 10, 6, 2, 9, 6, 
+  16, 10, 100, 0, 15, 1, 39, 12, 8, 29, 3, 0, 9, 16, 20, 100, 0, 6, 1, 10, 
+  9, 8, 20, 109, 0, 9, 8, 19, 6, 2, 9, 6, 16, 9, 100, 0, 0, 192, 13, 44, 
+  18, 48, 28, 80, 0, 0, 128, 13, 8, 21, 4, 80, 0, 0, 192, 13, 19, 7, 1, 5, 
+  80, 0, 0, 192, 5, 8, 1, 24, 80, 0, 0, 128, 13, 22, 21, 12, 80, 0, 0, 128, 
+  32, 20, 40, 0, 0, 128, 32, 0, 40, 0, 0, 128, 32, 0, 80, 0, 0, 128, 32, 19, 
+  35, 72, 1, 29, 72, 8, 30, 90, 2, 40, 216, 1, 16, 110, 216, 1, 4, 109, 90, 32, 
+  39, 208, 10, 0, 20, 1, 10, 20, 8, 9, 20, 2, 10, 20, 16, 9, 172, 2, 0, 20, 
+  4, 10, 20, 32, 9, 172, 2, 0, 20, 1, 10, 20, 8, 9, 30, 2, 20, 30, 16, 19, 
+  172, 2, 0, 20, 4, 10, 20, 32, 9, 172, 2, 0, 20, 1, 10, 20, 8, 9, 20, 2, 
+  10, 20, 16, 9, 172, 2, 0, 20, 4, 10, 20, 32, 9, 172, 2, 0, 0, 192, 45, 24, 
+  18, 24, 18, 10, 200, 1, 0, 0, 128, 32, 9, 200, 1, 0, 71, 25, 1, 39, 15, 2, 
+  20, 100, 0, 25, 8, 40, 70, 16, 130, 1, 100, 0, 65, 4, 119, 20, 32, 29, 100, 0, 
+  20, 1, 40, 20, 8, 39, 80, 0, 25, 1, 39, 105, 0, 25, 8, 40, 105, 0, 10, 4, 
+  10, 10, 32, 9, 100, 0, 20, 1, 40, 20, 8, 39, 80, 0, 25, 1, 39, 105, 0, 25, 
+  8, 40, 105, 0, 10, 4, 10, 10, 32, 9, 100, 0, 20, 1, 40, 20, 8, 39, 80, 0, 
+  25, 1, 39, 105, 0, 25, 8, 40, 105, 0, 10, 4, 10, 10, 32, 9, 100, 0, 20, 1, 
+  40, 20, 8, 39, 80, 0, 25, 1, 39, 105, 0, 25, 8, 40, 105, 0, 10, 4, 10, 10, 
+  32, 9, 100, 0, 20, 1, 40, 20, 8, 39, 80, 0, 25, 1, 39, 105, 0, 25, 8, 40, 
+  105, 0, 10, 4, 10, 10, 32, 9, 100, 0, 20, 1, 40, 20, 8, 39, 80, 0, 30, 1, 
+  19, 30, 8, 20, 40, 2, 30, 40, 16, 29, 40, 4, 29, 40, 32, 30, 144, 3, 0, 0, 
+  192, 13, 30, 24, 30, 24, 222, 2, 0, 65, 22, 1, 99, 26, 8, 120, 12, 2, 49, 44, 
+  16, 210, 1, 52, 4, 249, 1, 20, 32, 90, 70, 0, 10, 1, 39, 4, 8, 9, 4, 0, 
+  16, 4, 70, 4, 32, 9, 70, 0, 4, 1, 10, 8, 8, 30, 6, 0, 14, 32, 59, 72, 
+  0, 10, 8, 39, 2, 0, 6, 16, 19, 6, 4, 19, 6, 32, 20, 70, 0, 6, 1, 19, 
+  2, 0, 6, 2, 20, 4, 16, 10, 2, 0, 8, 32, 30, 70, 0, 10, 1, 40, 4, 8, 
+  10, 4, 2, 10, 8, 16, 29, 4, 4, 10, 8, 32, 29, 70, 0, 4, 1, 10, 4, 8, 
+  9, 4, 0, 6, 4, 19, 12, 32, 50, 70, 0, 10, 1, 39, 2, 0, 6, 2, 19, 4, 
+  0, 16, 32, 69, 70, 0, 75, 1, 40, 30, 0, 45, 16, 20, 45, 4, 20, 45, 32, 20, 
+  248, 13, 0, 0, 192, 45, 48, 40, 48, 40, 20, 30, 0, 0, 128, 32, 0, 30, 0, 0, 
+  128, 32, 0, 30, 0, 0, 128, 32, 0, 60, 0, 0, 128, 32, 19, 64, 30, 1, 20, 30, 
+  8, 19, 110, 2, 100, 50, 16, 40, 100, 4, 89, 60, 32, 49, 200, 1, 0, 30, 1, 19, 
+  30, 8, 20, 30, 2, 19, 40, 16, 30, 30, 4, 19, 20, 32, 10, 172, 2, 0, 30, 1, 
+  19, 30, 8, 20, 30, 2, 19, 30, 16, 20, 20, 4, 9, 20, 32, 10, 144, 3, 0, 30, 
+  1, 19, 30, 8, 20, 30, 2, 19, 30, 16, 20, 30, 4, 19, 30, 32, 20, 244, 3, 0, 
+  30, 1, 19, 30, 8, 20, 40, 2, 29, 40, 16, 30, 20, 4, 9, 20, 32, 10, 216, 4, 
+  0, 30, 1, 19, 30, 8, 20, 30, 2, 19, 30, 16, 20, 30, 4, 19, 30, 32, 20, 188, 
+  5, 0, 80, 1, 70, 80, 8, 69, 144, 3, 0, 30, 1, 20, 30, 8, 19, 144, 3, 0, 
+  40, 1, 29, 40, 8, 30, 144, 3, 0, 50, 1, 40, 50, 8, 39, 144, 3, 0, 60, 1, 
+  49, 60, 8, 50, 144, 3, 0, 70, 1, 60, 70, 8, 59, 144, 3, 0, 0, 192, 45, 32, 
+  24, 32, 24, 20, 180, 1, 0, 0, 128, 32, 19, 192, 2, 0, 18, 40, 1, 9, 40, 8, 
+  10, 160, 1, 2, 70, 180, 1, 16, 80, 200, 1, 4, 89, 140, 1, 32, 59, 192, 12, 0, 
+  20, 2, 9, 20, 16, 10, 244, 3, 0, 20, 1, 9, 20, 8, 10, 128, 5, 0, 20, 2, 
+  9, 20, 16, 10, 188, 5, 0, 0, 192, 13, 20, 16, 20, 16, 216, 4, 0, 29, 194, 3, 
+  0, 250, 1, 2, 90, 200, 1, 0, 175, 1, 16, 60, 200, 1, 0, 250, 1, 4, 89, 200, 
+  1, 0, 175, 1, 32, 59, 200, 1, 0, 20, 1, 9, 20, 8, 10, 250, 1, 0, 30, 1, 
+  20, 30, 8, 19, 250, 1, 0, 30, 1, 19, 30, 8, 20, 250, 1, 0, 30, 1, 20, 30, 
+  8, 19, 250, 1, 0, 30, 1, 19, 30, 8, 20, 250, 1, 0, 30, 1, 20, 30, 8, 19, 
+  250, 1, 0, 0, 192, 13, 12, 8, 12, 8, 188, 5, 0, 10, 60, 0, 172, 2, 2, 90, 
+  210, 1, 16, 60, 172, 2, 4, 89, 210, 1, 32, 59, 216, 49, 0, 0, 192, 45, 8, 6, 
+  8, 6, 10, 80, 0, 0, 128, 32, 9, 208, 5, 0, 10, 70, 1, 9, 70, 8, 10, 187, 
+  2, 2, 80, 152, 2, 16, 70, 140, 26, 0, 20, 2, 9, 20, 16, 10, 232, 7, 0, 0, 
+  192, 13, 6, 4, 6, 4, 160, 6, 0, 8, 80, 0, 144, 3, 2, 90, 152, 2, 16, 60, 
+  144, 3, 4, 89, 152, 2, 32, 59, 160, 61, 0, 0, 192, 13, 4, 2, 4, 2, 232, 7, 
+  0, 6, 100, 0, 244, 3, 2, 90, 222, 2, 16, 60, 244, 3, 4, 89, 222, 2, 32, 59, 
+  188, 55, 0
+};
+const uint16_t NEURAL_STEP_OFFSETS[] PROGMEM = {
+  0, 56, 106, 185, 333, 422, 543, 868, 1057, 1164, 1292, 1492, 
+  1756, 1798, 1921, 2104, 2297, 2645, 2787, 2881, 3042, 3290, 3378, 3734, 
+  3985, 4320, 4434, 4629, 4815, 5014, 5077, 5173, 5212, 5249, 5281
+};
+
+// Other - 18 steps, 2721 bytes
+const uint8_t OTHER_TRACKS[] PROGMEM = {
+  18, 54, 0, 160, 2, 16, 150, 1, 188, 5, 0, 32, 1, 9, 32, 8, 10, 160, 1, 4, 
+  69, 180, 1, 32, 79, 216, 4, 0, 30, 1, 10, 30, 8, 9, 236, 9, 0, 30, 1, 9, 
+  30, 8, 10, 144, 3, 0, 0, 192, 63, 16, 12, 8, 16, 12, 8, 10, 180, 1, 0, 0, 
+  128, 32, 9, 164, 3, 0, 19, 64, 1, 29, 64, 8, 30, 32, 2, 9, 144, 2, 16, 160, 
+  1, 216, 4, 0, 70, 1, 40, 70, 8, 39, 64, 4, 29, 208, 1, 32, 119, 244, 3, 0, 
+  48, 1, 29, 48, 8, 30, 36, 2, 20, 36, 16, 19, 144, 3, 0, 0, 192, 45, 20, 14, 
+  20, 14, 10, 160, 1, 0, 0, 128, 32, 9, 212, 2, 0, 19, 60, 1, 39, 60, 8, 40, 
+  36, 2, 19, 216, 1, 16, 170, 1, 244, 3, 0, 30, 1, 19, 30, 8, 20, 24, 4, 9, 
+  180, 1, 32, 139, 1, 144, 3, 0, 98, 1, 60, 98, 8, 59, 126, 4, 79, 126, 32, 80, 
+  172, 2, 0, 0, 192, 45, 24, 18, 24, 18, 18, 200, 1, 0, 0, 128, 32, 17, 144, 3, 
+  0, 29, 45, 0, 240, 1, 16, 150, 1, 184, 3, 0, 28, 1, 9, 28, 8, 10, 152, 3, 
+  0, 26, 1, 9, 26, 8, 10, 26, 2, 9, 26, 16, 10, 192, 2, 0, 24, 1, 9, 24, 
+  8, 10, 156, 2, 0, 22, 1, 9, 22, 8, 10, 22, 2, 9, 22, 16, 10, 200, 1, 0, 
+  196, 1, 4, 129, 1, 42, 32, 19, 244, 3, 0, 126, 4, 80, 126, 32, 79, 244, 3, 0, 
+  0, 192, 45, 28, 20, 28, 20, 10, 220, 1, 0, 0, 128, 32, 9, 152, 2, 0, 19, 84, 
+  1, 49, 84, 8, 50, 56, 2, 29, 138, 2, 16, 180, 1, 216, 4, 0, 48, 1, 29, 48, 
+  8, 30, 56, 4, 29, 182, 1, 32, 119, 244, 3, 0, 20, 1, 9, 20, 8, 10, 20, 2, 
+  9, 20, 16, 10, 144, 3, 0, 0, 192, 45, 32, 24, 32, 24, 10, 152, 2, 0, 0, 128, 
+  32, 9, 120, 0, 58, 104, 1, 119, 104, 8, 120, 48, 2, 49, 168, 1, 16, 200, 1, 160, 
+  1, 4, 189, 1, 40, 32, 40, 144, 3, 0, 125, 1, 240, 1, 125, 8, 239, 1, 150, 1, 
+  0, 125, 1, 239, 1, 125, 8, 240, 1, 150, 1, 0, 125, 1, 240, 1, 125, 8, 239, 1, 
+  150, 1, 0, 125, 1, 239, 1, 125, 8, 240, 1, 150, 1, 0, 125, 1, 240, 1, 125, 8, 
+  239, 1, 150, 1, 0, 125, 1, 239, 1, 125, 8, 240, 1, 150, 1, 0, 125, 1, 240, 1, 
+  125, 8, 239, 1, 150, 1, 0, 125, 1, 239, 1, 125, 8, 240, 1, 150, 1, 0, 125, 1, 
+  240, 1, 125, 8, 239, 1, 150, 1, 0, 125, 1, 239, 1, 125, 8, 240, 1, 150, 1, 0, 
+  125, 1, 240, 1, 125, 8, 239, 1, 150, 1, 0, 125, 1, 239, 1, 125, 8, 240, 1, 150, 
+  1, 0, 12, 2, 9, 12, 16, 10, 18, 4, 19, 18, 32, 20, 172, 2, 0, 0, 192, 45, 
+  40, 32, 40, 32, 20, 100, 0, 0, 128, 32, 0, 100, 0, 0, 128, 32, 0, 100, 0, 0, 
+  128, 32, 0, 100, 0, 0, 128, 32, 19, 172, 2, 0, 43, 100, 1, 89, 100, 8, 90, 40, 
+  2, 29, 190, 1, 16, 180, 1, 244, 3, 0, 128, 1, 4, 149, 1, 208, 1, 0, 104, 4, 
+  120, 104, 32, 119, 200, 1, 0, 104, 4, 119, 104, 32, 120, 200, 1, 0, 104, 4, 120, 104, 
+  32, 119, 200, 1, 0, 104, 4, 119, 104, 32, 120, 200, 1, 0, 104, 4, 120, 104, 32, 119, 
+  200, 1, 0, 104, 4, 119, 104, 32, 120, 200, 1, 0, 104, 4, 120, 104, 32, 119, 200, 1, 
+  0, 104, 4, 119, 104, 32, 120, 200, 1, 0, 104, 4, 120, 104, 32, 119, 200, 1, 0, 24, 
+  1, 10, 24, 8, 9, 24, 2, 10, 24, 16, 9, 216, 4, 0, 0, 192, 45, 36, 28, 36, 
+  28, 10, 250, 1, 0, 0, 128, 32, 9, 250, 1, 0, 66, 54, 1, 79, 54, 8, 80, 18, 
+  2, 19, 108, 16, 170, 1, 180, 1, 0, 30, 1, 40, 30, 8, 39, 18, 2, 20, 18, 16, 
+  19, 180, 1, 0, 30, 1, 39, 30, 8, 40, 18, 2, 19, 18, 16, 20, 180, 1, 0, 30, 
+  1, 40, 30, 8, 39, 18, 2, 20, 18, 16, 19, 180, 1, 0, 30, 1, 39, 30, 8, 40, 
+  18, 2, 19, 18, 16, 20, 180, 1, 0, 30, 1, 40, 30, 8, 39, 18, 2, 20, 18, 16, 
+  19, 180, 1, 0, 30, 1, 39, 30, 8, 40, 18, 2, 19, 18, 16, 20, 180, 1, 0, 30, 
+  1, 40, 30, 8, 39, 18, 2, 20, 18, 16, 19, 180, 1, 0, 216, 1, 4, 169, 1, 36, 
+  32, 20, 144, 3, 0, 204, 1, 4, 160, 1, 204, 1, 32, 159, 1, 144, 3, 0, 0, 192, 
+  4, 30, 38, 200, 1, 0, 0, 192, 4, 8, 7, 200, 1, 0, 0, 192, 4, 7, 8, 200, 
+  1, 0, 0, 192, 4, 8, 7, 200, 1, 0, 0, 192, 4, 7, 8, 200, 1, 0, 0, 192, 
+  4, 8, 7, 200, 1, 0, 0, 192, 4, 7, 8, 200, 1, 0, 0, 192, 4, 8, 7, 200, 
+  1, 0, 0, 128, 32, 10, 250, 1, 0, 0, 128, 32, 9, 222, 2, 0, 19, 70, 1, 39, 
+  70, 8, 40, 28, 2, 9, 238, 1, 16, 160, 1, 216, 4, 0, 36, 1, 20, 36, 8, 19, 
+  84, 4, 49, 154, 1, 32, 99, 244, 3, 0, 40, 1, 29, 40, 8, 30, 20, 2, 9, 20, 
+  16, 10, 144, 3, 0, 0, 192, 45, 32, 24, 32, 24, 10, 200, 1, 0, 0, 128, 32, 9, 
+  172, 2, 0, 45, 26, 1, 9, 26, 8, 10, 13, 0, 208, 1, 16, 150, 1, 150, 1, 4, 
+  89, 90, 32, 49, 232, 2, 0, 24, 1, 9, 24, 8, 10, 24, 2, 9, 24, 16, 10, 28, 
+  4, 9, 206, 2, 0, 22, 1, 9, 22, 8, 10, 22, 0, 26, 4, 9, 26, 32, 10, 152, 
+  2, 0, 20, 1, 9, 20, 8, 10, 20, 2, 9, 20, 16, 10, 24, 4, 9, 24, 32, 10, 
+  240, 1, 0, 27, 1, 19, 27, 8, 20, 18, 2, 9, 18, 16, 10, 22, 4, 9, 22, 32, 
+  10, 200, 1, 0, 16, 1, 9, 16, 8, 10, 196, 1, 0, 32, 1, 29, 32, 8, 30, 16, 
+  2, 9, 16, 16, 10, 144, 3, 0, 0, 192, 45, 44, 36, 44, 36, 20, 192, 2, 0, 0, 
+  128, 32, 19, 80, 0, 76, 56, 1, 129, 1, 24, 8, 50, 24, 2, 49, 24, 16, 50, 8, 
+  4, 9, 8, 32, 9, 140, 1, 0, 16, 1, 30, 32, 8, 70, 72, 2, 170, 1, 28, 16, 
+  59, 12, 4, 19, 32, 32, 69, 140, 1, 0, 32, 1, 70, 16, 8, 29, 76, 2, 179, 1, 
+  8, 16, 10, 40, 4, 89, 36, 32, 80, 140, 1, 0, 36, 1, 79, 56, 8, 129, 1, 80, 
+  2, 190, 1, 24, 16, 50, 24, 4, 50, 144, 1, 0, 20, 1, 40, 12, 8, 20, 40, 2, 
+  90, 16, 16, 30, 8, 4, 10, 24, 32, 49, 140, 1, 0, 36, 1, 80, 44, 8, 99, 44, 
+  2, 99, 28, 16, 59, 32, 4, 70, 28, 32, 59, 140, 1, 0, 44, 1, 100, 24, 8, 50, 
+  72, 2, 169, 1, 16, 16, 30, 68, 4, 159, 1, 40, 32, 90, 140, 1, 0, 8, 1, 9, 
+  44, 8, 100, 76, 2, 180, 1, 60, 16, 140, 1, 28, 4, 60, 56, 32, 129, 1, 140, 1, 
+  0, 144, 1, 1, 229, 1, 66, 8, 100, 120, 2, 189, 1, 18, 16, 20, 172, 2, 0, 0, 
+  192, 13, 50, 40, 40, 32, 200, 1, 0, 0, 192, 45, 9, 7, 10, 8, 20, 90, 0, 0, 
+  128, 32, 0, 90, 0, 0, 128, 32, 0, 90, 0, 0, 128, 32, 0, 90, 0, 0, 128, 32, 
+  0, 90, 0, 0, 128, 32, 0, 90, 0, 0, 128, 32, 19, 250, 1, 0, 32, 80, 1, 69, 
+  80, 8, 70, 20, 2, 9, 170, 1, 16, 160, 1, 244, 3, 0, 112, 4, 129, 1, 24, 32, 
+  19, 250, 1, 0, 40, 4, 40, 40, 32, 39, 250, 1, 0, 40, 4, 39, 40, 32, 40, 250, 
+  1, 0, 40, 4, 40, 40, 32, 39, 250, 1, 0, 40, 4, 39, 40, 32, 40, 250, 1, 0, 
+  40, 4, 40, 40, 32, 39, 250, 1, 0, 36, 1, 19, 36, 8, 20, 36, 2, 19, 36, 16, 
+  20, 216, 4, 0, 0, 192, 45, 36, 28, 36, 28, 10, 240, 1, 0, 0, 128, 32, 9, 132, 
+  2, 0, 27, 48, 0, 128, 2, 16, 150, 1, 188, 5, 0, 56, 1, 30, 56, 8, 29, 64, 
+  4, 29, 208, 1, 32, 119, 216, 4, 0, 60, 1, 39, 60, 8, 40, 144, 3, 0, 36, 1, 
+  19, 36, 8, 20, 144, 3, 0, 24, 1, 9, 24, 8, 10, 144, 3, 0, 36, 1, 19, 36, 
+  8, 20, 144, 3, 0, 162, 1, 4, 79, 162, 1, 32, 80, 188, 5, 0, 0, 192, 45, 28, 
+  20, 28, 20, 18, 172, 2, 0, 0, 128, 32, 17, 244, 3, 0, 80, 15, 1, 39, 12, 8, 
+  29, 39, 2, 120, 36, 16, 110, 120, 0, 18, 1, 50, 12, 8, 30, 21, 2, 59, 9, 16, 
+  19, 120, 0, 6, 1, 9, 9, 8, 19, 18, 2, 50, 6, 16, 10, 120, 0, 30, 1, 89, 
+  15, 8, 40, 6, 2, 9, 12, 16, 29, 120, 0, 9, 1, 20, 15, 8, 39, 18, 2, 50, 
+  123, 0, 51, 1, 160, 1, 9, 8, 19, 15, 2, 39, 18, 16, 50, 120, 0, 51, 1, 159, 
+  1, 18, 8, 50, 6, 2, 10, 45, 16, 139, 1, 120, 0, 24, 1, 70, 24, 8, 70, 27, 
+  2, 79, 60, 16, 190, 1, 120, 0, 18, 1, 50, 3, 0, 24, 2, 70, 51, 16, 159, 1, 
+  120, 0, 15, 1, 40, 6, 8, 10, 24, 2, 70, 9, 16, 19, 120, 0, 128, 1, 1, 149, 
+  1, 32, 8, 29, 152, 1, 2, 179, 1, 136, 1, 16, 160, 1, 144, 3, 0, 24, 4, 49, 
+  52, 32, 119, 150, 1, 0, 36, 4, 79, 44, 32, 100, 154, 1, 0, 48, 32, 109, 150, 1, 
+  0, 16, 4, 29, 8, 32, 9, 150, 1, 0, 40, 4, 90, 8, 32, 10, 150, 1, 0, 0, 
+  192, 4, 32, 20, 180, 1, 0, 0, 192, 4, 6, 6, 180, 1, 0, 0, 192, 4, 7, 2, 
+  180, 1, 0, 0, 192, 4, 3, 4, 180, 1, 0, 0, 128, 32, 10, 80, 0, 0, 128, 32, 
+  9, 192, 2, 0, 33, 30, 1, 9, 30, 8, 10, 15, 0, 240, 1, 16, 150, 1, 184, 3, 
+  0, 28, 1, 9, 28, 8, 10, 28, 2, 9, 28, 16, 10, 252, 2, 0, 26, 1, 9, 26, 
+  8, 10, 218, 2, 0, 24, 1, 9, 24, 8, 10, 24, 2, 9, 24, 16, 10, 132, 2, 0, 
+  22, 1, 9, 22, 8, 10, 22, 2, 9, 22, 16, 10, 200, 1, 0, 168, 1, 4, 129, 1, 
+  36, 32, 19, 244, 3, 0, 108, 4, 80, 108, 32, 79, 232, 8, 0, 0, 192, 45, 32, 24, 
+  32, 24, 10, 132, 2, 0, 0, 128, 32, 9, 240, 1, 0, 59, 28, 1, 9, 28, 8, 10, 
+  14, 0, 224, 1, 16, 150, 1, 154, 1, 4, 99, 84, 32, 49, 187, 2, 0, 36, 1, 19, 
+  36, 8, 20, 24, 2, 9, 24, 16, 10, 24, 4, 9, 24, 32, 10, 152, 2, 0, 20, 1, 
+  9, 20, 8, 10, 20, 2, 9, 20, 16, 10, 20, 4, 9, 20, 32, 10, 245, 1, 0, 24, 
+  1, 19, 24, 8, 20, 16, 2, 9, 16, 16, 10, 16, 4, 9, 16, 32, 10, 210, 1, 0, 
+  18, 1, 19, 18, 8, 20, 12, 2, 9, 12, 16, 10, 12, 4, 9, 12, 32, 10, 175, 1, 
+  0, 8, 1, 9, 8, 8, 10, 8, 0, 8, 4, 9, 8, 32, 10, 140, 1, 0, 6, 1, 
+  19, 6, 8, 20, 4, 2, 9, 4, 16, 10, 4, 4, 9, 4, 32, 10, 105, 0, 24, 1, 
+  29, 24, 8, 30, 18, 2, 19, 18, 16, 20, 42, 4, 59, 42, 32, 60, 244, 3, 0, 0, 
+  192, 45, 56, 44, 56, 44, 20, 194, 3, 0, 0, 128, 32, 19, 50, 0, 119, 2, 0, 16, 
+  8, 69, 4, 2, 9, 4, 16, 9, 34, 4, 159, 1, 14, 32, 59, 100, 0, 26, 1, 119, 
+  40, 8, 190, 1, 10, 2, 40, 48, 16, 230, 1, 36, 4, 170, 1, 24, 32, 110, 100, 0, 
+  40, 1, 190, 1, 28, 8, 129, 1, 46, 2, 220, 1, 56, 16, 141, 2, 24, 4, 109, 4, 
+  32, 10, 100, 0, 30, 1, 139, 1, 18, 8, 80, 26, 2, 119, 38, 16, 180, 1, 2, 0, 
+  42, 32, 199, 1, 100, 0, 36, 1, 170, 1, 10, 8, 40, 34, 2, 159, 1, 2, 0, 8, 
+  4, 30, 8, 32, 30, 100, 0, 42, 1, 199, 1, 8, 8, 29, 2, 0, 34, 16, 159, 1, 
+  6, 4, 19, 14, 32, 59, 100, 0, 38, 1, 180, 1, 34, 8, 159, 1, 2, 0, 10, 16, 
+  39, 14, 4, 59, 8, 32, 30, 100, 0, 24, 1, 109, 10, 8, 39, 6, 2, 19, 26, 16, 
+  120, 20, 4, 90, 20, 32, 90, 100, 0, 32, 1, 150, 1, 20, 8, 90, 22, 2, 100, 28, 
+  16, 130, 1, 30, 4, 139, 1, 16, 32, 69, 100, 0, 4, 1, 9, 10, 8, 40, 8, 2, 
+  29, 12, 16, 49, 22, 4, 100, 4, 32, 9, 100, 0, 40, 1, 189, 1, 18, 8, 80, 34, 
+  2, 160, 1, 14, 16, 59, 14, 4, 60, 4, 32, 10, 100, 0, 14, 1, 60, 20, 8, 89, 
+  36, 2, 169, 1, 18, 16, 80, 18, 4, 79, 30, 32, 140, 1, 100, 0, 56, 1, 129, 1, 
+  64, 8, 150, 1, 40, 2, 89, 36, 16, 80, 172, 2, 0, 0, 192, 13, 54, 42, 66, 52, 
+  130, 1, 0, 0, 192, 13, 8, 2, 23, 13, 130, 1, 0, 0, 192, 13, 21, 11, 26, 12, 
+  130, 1, 0, 0, 192, 13, 26, 14, 11, 9, 130, 1, 0, 0, 192, 13, 13, 3, 2, 10, 
+  130, 1, 0, 0, 192, 13, 1, 1, 13, 7, 130, 1, 0, 0, 128, 32, 20, 60, 0, 0, 
+  128, 32, 0, 60, 0, 0, 128, 32, 0, 60, 0, 0, 128, 32, 0, 60, 0, 0, 128, 32, 
+  0, 60, 0, 0, 128, 32, 0, 60, 0, 0, 128, 32, 0, 60, 0, 0, 128, 32, 0, 70, 
+  0, 0, 128, 32, 19, 212, 2, 0, 52, 84, 1, 129, 1, 84, 8, 130, 1, 42, 2, 59, 
+  132, 1, 16, 210, 1, 132, 1, 4, 209, 1, 42, 32, 60, 244, 3, 0, 108, 1, 132, 2, 
+  108, 8, 131, 2, 160, 1, 0, 108, 1, 131, 2, 108, 8, 132, 2, 160, 1, 0, 108, 1, 
+  132, 2, 108, 8, 131, 2, 160, 1, 0, 108, 1, 131, 2, 108, 8, 132, 2, 160, 1, 0, 
+  108, 1, 132, 2, 108, 8, 131, 2, 160, 1, 0, 108, 1, 131, 2, 108, 8, 132, 2, 160, 
+  1, 0, 108, 1, 132, 2, 108, 8, 131, 2, 160, 1, 0, 108, 1, 131, 2, 108, 8, 132, 
+  2, 160, 1, 0, 108, 1, 132, 2, 108, 8, 131, 2, 160, 1, 0, 108, 1, 131, 2, 108, 
+  8, 132, 2, 160, 1, 0, 108, 1, 132, 2, 108, 8, 131, 2, 160, 1, 0, 108, 1, 131, 
+  2, 108, 8, 132, 2, 160, 1, 0, 16, 2, 10, 16, 16, 9, 24, 4, 20, 24, 32, 19, 
+  216, 4, 0, 0, 192, 45, 60, 48, 52, 40, 10, 172, 2, 0, 0, 128, 32, 9, 144, 3, 
+  0
+};
+const uint16_t OTHER_STEP_OFFSETS[] PROGMEM = {
+  0, 66, 133, 201, 298, 364, 572, 712, 936, 1003, 1145, 1396, 
+  1502, 1594, 1844, 1953, 2136, 2528
+};
+
+// Looked up by song name; the last entry also serves unknown songs
+const ChoreoSong CHOREO_SONGS[] = {
+  {"Falling For You", FALLING_TRACKS, FALLING_STEP_OFFSETS, 26},
+  {"Stereo Love", STEREO_TRACKS, STEREO_STEP_OFFSETS, 28},
+  {"Faded", FADED_TRACKS, FADED_STEP_OFFSETS, 30},
+  {"Alone", ALONE_TRACKS, ALONE_STEP_OFFSETS, 38},
+  {"Mastie Mashup", NEURAL_TRACKS, NEURAL_STEP_OFFSETS, 35},
+  {"Other", OTHER_TRACKS, OTHER_STEP_OFFSETS, 18},
+};
+const int CHOREO_SONG_COUNT = sizeof(CHOREO_SONGS) / sizeof(CHOREO_SONGS[0]);
+
+#endif
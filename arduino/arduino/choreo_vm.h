@@ -0,0 +1,384 @@
+/*
+ * =========================================================
+ * CHOREO VM - BYTECODE CHOREOGRAPHY INTERPRETER
+ * =========================================================
+ * Compact, loop-friendly dance programs uploaded over the
+ * WebSocket as a binary frame and run without reflashing.
+ * At most VM_OPS_PER_TICK instructions execute per call, so
+ * a program can never stall the main loop.
+ *
+ * Program layout (little-endian):
+ *   'R' 'B' 'V' version motifCount
+ *   uint16 offset * motifCount   - start of each motif (subroutine)
+ *   main code                    - runs first, ends with VM_END
+ *
+ * Instructions (opcode byte, then arguments):
+ *   END                       stop the program
+ *   MOVE   ch angle ms16      glide one servo, don't wait
+ *   GROUP  mask16 ms16 a..    glide every servo in mask (one angle per set bit)
+ *   WAIT   ms16               wait
+ *   SYNC                      wait until all glides have arrived
+ *   LOOP   count              repeat up to NEXT count times (0 = forever)
+ *   NEXT
+ *   CALL   motif              run a motif, back here on RET
+ *   RET
+ *   RAND   n motif..          CALL one of n motifs at random
+ *   SET    reg value16        registers are int16, r0-r7
+ *   ADD    reg delta8
+ *   MOVER  ch reg ms16        glide a servo to a register's value
+ *   LED    pattern            LED pattern index
+ *   TONE   freq16 ms16
+ *   BASE   pins               base IN1..IN4 as bits 0-3
+ *   HOME   ms16               glide all servos home, don't wait
+ * =========================================================
+ */
+
+#ifndef CHOREO_VM_H
+#define CHOREO_VM_H
+
+// Include required libraries
+#include <Arduino.h>
+
+// External function declarations (these will be defined in the main file)
+extern void glideServo(uint8_t ch, int angle, uint16_t durationMs);
+extern bool glidesActive();
+extern void setBasePins(uint8_t pins);
+extern void playTone(int frequency, int duration);
+extern void vmSetLedPattern(uint8_t pattern);
+extern int servoHome[12];
+
+#define VM_VERSION 1
+#define VM_MAX_PROGRAM 1024
+#define VM_MAX_MOTIFS 32
+#define VM_STACK_DEPTH 8
+#define VM_REGISTERS 8
+#define VM_OPS_PER_TICK 32
+#define VM_HEADER_SIZE 5
+
+enum VmOpcode : uint8_t {
+  VM_END,
+  VM_MOVE,
+  VM_GROUP,
+  VM_WAIT,
+  VM_SYNC,
+  VM_LOOP,
+  VM_NEXT,
+  VM_CALL,
+  VM_RET,
+  VM_RAND,
+  VM_SET,
+  VM_ADD,
+  VM_MOVER,
+  VM_LED,
+  VM_TONE,
+  VM_BASE,
+  VM_HOME
+};
+
+// Loop or call return point
+struct VmFrame {
+  uint16_t pc;
+  uint8_t count;  // Loop passes left, 0 = forever
+  bool isCall;
+};
+
+struct ChoreoVm {
+  uint8_t program[VM_MAX_PROGRAM];
+  uint16_t size;
+  uint8_t motifCount;
+  uint16_t pc;
+  VmFrame stack[VM_STACK_DEPTH];
+  uint8_t sp;
+  int16_t reg[VM_REGISTERS];
+  bool loaded;
+  bool running;
+  bool syncing;
+  uint16_t waitMs;
+  unsigned long waitStart;
+  uint32_t opsExecuted;
+};
+
+ChoreoVm vm;
+
+void vmStop() {
+  if (vm.running) setBasePins(0);
+  vm.running = false;
+}
+
+// An upload waiting for its run command; the running program is untouched until then
+struct VmStaged {
+  uint8_t program[VM_MAX_PROGRAM];
+  uint16_t size;
+  uint8_t motifCount;
+  bool ready;
+};
+
+VmStaged vmStaged;
+
+// Validate a program and copy it aside; returns nullptr or the reason it was rejected
+const char* vmStage(const uint8_t* data, size_t length) {
+  if (length < VM_HEADER_SIZE || data[0] != 'R' || data[1] != 'B' || data[2] != 'V') return "bad magic";
+  if (data[3] != VM_VERSION) return "bad version";
+  if (length > VM_MAX_PROGRAM) return "too large";
+  uint8_t motifs = data[4];
+  if (motifs > VM_MAX_MOTIFS) return "too many motifs";
+  size_t codeStart = VM_HEADER_SIZE + motifs * 2;
+  if (length <= codeStart) return "no code";
+  for (int i = 0; i < motifs; i++) {
+    uint16_t offset = data[VM_HEADER_SIZE + i * 2] | (data[VM_HEADER_SIZE + i * 2 + 1] << 8);
+    if (offset < codeStart || offset >= length) return "bad motif offset";
+  }
+
+  memcpy(vmStaged.program, data, length);
+  vmStaged.size = length;
+  vmStaged.motifCount = motifs;
+  vmStaged.ready = true;
+  return nullptr;
+}
+
+// Swap the staged upload in, stopping the old program; false if nothing is loaded
+bool vmLoadStaged() {
+  if (!vmStaged.ready) return vm.loaded;
+  vmStop();
+  memcpy(vm.program, vmStaged.program, vmStaged.size);
+  vm.size = vmStaged.size;
+  vm.motifCount = vmStaged.motifCount;
+  vm.loaded = true;
+  vmStaged.ready = false;
+  return true;
+}
+
+void vmStart() {
+  if (!vm.loaded) return;
+  vm.pc = VM_HEADER_SIZE + vm.motifCount * 2;
+  vm.sp = 0;
+  memset(vm.reg, 0, sizeof(vm.reg));
+  vm.syncing = false;
+  vm.waitMs = 0;
+  vm.opsExecuted = 0;
+  vm.running = true;
+}
+
+// Move a pending wait past a suspension
+void vmShiftClock(unsigned long pausedMs) {
+  vm.waitStart += pausedMs;
+}
+
+void vmFault(const char* reason) {
+  Serial.print("VM fault at ");
+  Serial.print(vm.pc);
+  Serial.print(": ");
+  Serial.println(reason);
+  setBasePins(0);
+  vm.running = false;
+}
+
+// Operand fetch; callers check vmHas() first
+bool vmHas(uint16_t bytes) {
+  return vm.pc + bytes <= vm.size;
+}
+
+uint8_t vmByte() {
+  return vm.program[vm.pc++];
+}
+
+uint16_t vmWord() {
+  uint16_t value = vm.program[vm.pc] | (vm.program[vm.pc + 1] << 8);
+  vm.pc += 2;
+  return value;
+}
+
+bool vmPush(uint16_t pc, uint8_t count, bool isCall) {
+  if (vm.sp >= VM_STACK_DEPTH) {
+    vmFault("stack overflow");
+    return false;
+  }
+  vm.stack[vm.sp++] = {pc, count, isCall};
+  return true;
+}
+
+bool vmCall(uint8_t motif) {
+  if (motif >= vm.motifCount) {
+    vmFault("bad motif");
+    return false;
+  }
+  if (!vmPush(vm.pc, 0, true)) return false;
+  vm.pc = vm.program[VM_HEADER_SIZE + motif * 2] | (vm.program[VM_HEADER_SIZE + motif * 2 + 1] << 8);
+  return true;
+}
+
+// Fixed operand bytes after the opcode (GROUP and RAND have more), -1 if unknown
+int vmOperandBytes(uint8_t op) {
+  switch (op) {
+    case VM_END: case VM_SYNC: case VM_NEXT: case VM_RET: return 0;
+    case VM_LOOP: case VM_CALL: case VM_RAND: case VM_LED: case VM_BASE: return 1;
+    case VM_WAIT: case VM_HOME: case VM_ADD: return 2;
+    case VM_SET: return 3;
+    case VM_MOVE: case VM_GROUP: case VM_MOVER: case VM_TONE: return 4;
+    default: return -1;
+  }
+}
+
+// Run until the program waits, ends or uses up its instruction budget
+void updateVm() {
+  if (!vm.running) return;
+
+  if (vm.syncing) {
+    if (glidesActive()) return;
+    vm.syncing = false;
+  }
+  if (vm.waitMs) {
+    if (millis() - vm.waitStart < vm.waitMs) return;
+    vm.waitMs = 0;
+  }
+
+  for (int budget = 0; budget < VM_OPS_PER_TICK && vm.running; budget++) {
+    if (!vmHas(1)) {
+      vmFault("ran off the end");
+      return;
+    }
+    uint8_t op = vmByte();
+    int operands = vmOperandBytes(op);
+    if (operands < 0) {
+      vm.pc--;
+      vmFault("bad opcode");
+      return;
+    }
+    if (!vmHas(operands)) {
+      vmFault("truncated");
+      return;
+    }
+    vm.opsExecuted++;
+
+    switch (op) {
+      case VM_END:
+        setBasePins(0);
+        vm.running = false;
+        Serial.println("VM program finished");
+        return;
+
+      case VM_MOVE: {
+        uint8_t ch = vmByte();
+        uint8_t angle = vmByte();
+        glideServo(ch, angle, vmWord());
+        break;
+      }
+
+      case VM_GROUP: {
+        uint16_t mask = vmWord();
+        uint16_t ms = vmWord();
+        uint8_t count = 0;
+        for (int ch = 0; ch < 12; ch++) {
+          if (mask & (1 << ch)) count++;
+        }
+        if (!vmHas(count)) {
+          vmFault("truncated");
+          return;
+        }
+        for (int ch = 0; ch < 12; ch++) {
+          if (mask & (1 << ch)) glideServo(ch, vmByte(), ms);
+        }
+        break;
+      }
+
+      case VM_WAIT:
+        vm.waitMs = vmWord();
+        vm.waitStart = millis();
+        if (vm.waitMs) return;
+        break;
+
+      case VM_SYNC:
+        if (glidesActive()) {
+          vm.syncing = true;
+          return;
+        }
+        break;
+
+      case VM_LOOP: {
+        uint8_t count = vmByte();
+        if (!vmPush(vm.pc, count, false)) return;
+        break;
+      }
+
+      case VM_NEXT: {
+        if (vm.sp == 0 || vm.stack[vm.sp - 1].isCall) {
+          vmFault("NEXT without LOOP");
+          return;
+        }
+        VmFrame& frame = vm.stack[vm.sp - 1];
+        if (frame.count == 0 || --frame.count > 0) {
+          vm.pc = frame.pc;
+        } else {
+          vm.sp--;
+        }
+        break;
+      }
+
+      case VM_CALL:
+        if (!vmCall(vmByte())) return;
+        break;
+
+      case VM_RET:
+        while (vm.sp > 0 && !vm.stack[vm.sp - 1].isCall) vm.sp--;  // Leave any open loops
+        if (vm.sp == 0) {
+          vmFault("RET without CALL");
+          return;
+        }
+        vm.pc = vm.stack[--vm.sp].pc;
+        break;
+
+      case VM_RAND: {
+        uint8_t n = vmByte();
+        if (n == 0 || !vmHas(n)) {
+          vmFault("bad RAND");
+          return;
+        }
+        uint8_t motif = vm.program[vm.pc + random(n)];
+        vm.pc += n;
+        if (!vmCall(motif)) return;
+        break;
+      }
+
+      case VM_SET: {
+        uint8_t r = vmByte() % VM_REGISTERS;
+        vm.reg[r] = (int16_t)vmWord();
+        break;
+      }
+
+      case VM_ADD: {
+        uint8_t r = vmByte() % VM_REGISTERS;
+        vm.reg[r] += (int8_t)vmByte();
+        break;
+      }
+
+      case VM_MOVER: {
+        uint8_t ch = vmByte();
+        uint8_t r = vmByte() % VM_REGISTERS;
+        glideServo(ch, vm.reg[r], vmWord());
+        break;
+      }
+
+      case VM_LED:
+        vmSetLedPattern(vmByte());
+        break;
+
+      case VM_TONE: {
+        uint16_t freq = vmWord();
+        playTone(freq, vmWord());
+        break;
+      }
+
+      case VM_BASE:
+        setBasePins(vmByte() & 0x0F);
+        break;
+
+      case VM_HOME: {
+        uint16_t ms = vmWord();
+        for (int ch = 0; ch < 12; ch++) glideServo(ch, servoHome[ch], ms);
+        break;
+      }
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,98 @@
+/*
+ * =========================================================
+ * COMMAND PARSER - ZERO-ALLOCATION TEXT COMMAND DISPATCH
+ * =========================================================
+ * Text commands are "verb" or "verb:arg" and are parsed in
+ * place on the WebSocket payload; nothing here touches the heap.
+ *
+ * - The verb is hashed (FNV-1a) and looked up in a fixed
+ *   table built at compile time, then confirmed with memcmp
+ * - Integer arguments are parsed strictly: optional sign,
+ *   1-9 digits and nothing else
+ * - Names (LED patterns) hash case-folded against lowercase entries
+ * =========================================================
+ */
+
+#ifndef COMMAND_PARSER_H
+#define COMMAND_PARSER_H
+
+// Include required libraries
+#include <Arduino.h>
+
+#define CMD_FNV_OFFSET 2166136261u
+#define CMD_FNV_PRIME 16777619u
+#define CMD_MAX_DIGITS 9
+
+// Compile-time hash of a table entry
+constexpr uint32_t cmdHash(const char* s, uint32_t h = CMD_FNV_OFFSET) {
+  return *s ? cmdHash(s + 1, (h ^ (uint8_t)*s) * CMD_FNV_PRIME) : h;
+}
+
+inline char cmdFold(char c) {
+  return (c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c;
+}
+
+// Runtime hash of a payload slice; with foldCase it matches lowercase table entries
+uint32_t cmdHashRange(const char* s, size_t len, bool foldCase) {
+  uint32_t h = CMD_FNV_OFFSET;
+  for (size_t i = 0; i < len; i++) {
+    char c = foldCase ? cmdFold(s[i]) : s[i];
+    h = (h ^ (uint8_t)c) * CMD_FNV_PRIME;
+  }
+  return h;
+}
+
+// Confirm a hash hit against the table string
+bool cmdMatches(const char* name, const char* s, size_t len, bool foldCase) {
+  for (size_t i = 0; i < len; i++) {
+    char c = foldCase ? cmdFold(s[i]) : s[i];
+    if (name[i] != c) return false;  // Also catches name ending early
+  }
+  return name[len] == '\0';
+}
+
+bool cmdParseInt(const char* s, size_t len, int32_t& out) {
+  size_t i = 0;
+  bool negative = false;
+  if (len > 0 && (s[0] == '-' || s[0] == '+')) {
+    negative = s[0] == '-';
+    i = 1;
+  }
+  if (i == len || len - i > CMD_MAX_DIGITS) return false;
+  int32_t value = 0;
+  for (; i < len; i++) {
+    if (s[i] < '0' || s[i] > '9') return false;
+    value = value * 10 + (s[i] - '0');
+  }
+  out = negative ? -value : value;
+  return true;
+}
+
+typedef void (*CommandHandler)(uint8_t num, const char* arg, size_t argLen);
+
+struct CommandEntry {
+  uint32_t hash;
+  const char* verb;
+  CommandHandler handler;
+};
+
+#define CMD_ENTRY(verb, handler) {cmdHash(verb), verb, handler}
+
+// Split "verb:arg" and run the verb's handler; false if no entry matches
+bool cmdDispatch(const CommandEntry* table, size_t count, uint8_t num, const char* msg, size_t len) {
+  const char* colon = (const char*)memchr(msg, ':', len);
+  size_t verbLen = colon ? (size_t)(colon - msg) : len;
+  const char* arg = colon ? colon + 1 : msg + len;
+  size_t argLen = len - (arg - msg);
+
+  uint32_t hash = cmdHashRange(msg, verbLen, false);
+  for (size_t i = 0; i < count; i++) {
+    if (table[i].hash == hash && cmdMatches(table[i].verb, msg, verbLen, false)) {
+      table[i].handler(num, arg, argLen);
+      return true;
+    }
+  }
+  return false;
+}
+
+#endif
@@ -0,0 +1,181 @@
+/*
+ * =========================================================
+ * COMMAND QUEUE - BOUNDED PRIORITY QUEUE FOR ACTUATION
+ * =========================================================
+ * The WebSocket callback only parses and enqueues; loop()
+ * drains the queue and does the actuation. Network handling
+ * therefore never waits on motion, sound or I2C, and a callback
+ * re-entered from inside a movement can't start another one.
+ *
+ * - One ring buffer per priority, drained highest first
+ * - Pause/stop go in CMDQ_PRIO_URGENT and discard the normal
+ *   commands that arrived before them
+ * - Entries remember how to ack: a text string after execution,
+ *   or the binary frame they belong to (one ACK per frame)
+ * - Song names are copied in; the payload buffer doesn't live on
+ * - Speed, brightness and LED pattern from text clients are
+ *   last-writer-wins: a slider flood collapses to one apply and
+ *   one combined ack per loop pass
+ * - A normal command queued after pending setters takes their
+ *   values with it in a barrier entry, so setters that arrive
+ *   later can't overtake it
+ * =========================================================
+ */
+
+#ifndef COMMAND_QUEUE_H
+#define COMMAND_QUEUE_H
+
+// Include required libraries
+#include <Arduino.h>
+#include "protocol.h"
+
+#define CMDQ_DEPTH 8
+#define CMDQ_SETTERS 3
+
+enum CmdqPriority {
+  CMDQ_PRIO_NORMAL,
+  CMDQ_PRIO_URGENT,  // Pause, stop
+  CMDQ_PRIORITIES
+};
+
+// Entry flags for binary frames
+#define CMDQ_BINARY 0x01
+#define CMDQ_FRAME_START 0x02
+#define CMDQ_FRAME_END 0x04
+
+// Setter values a barrier entry applies, taken off the pending setters when it was queued
+struct SetterBatch {
+  int32_t value[CMDQ_SETTERS];
+  uint32_t clients[CMDQ_SETTERS];
+  uint8_t pending;  // Bit per setter
+};
+
+struct QueuedCommand {
+  RbCommand cmd;
+  union {
+    char text[RB_SONG_NAME_MAX];  // cmd.text is pointed here when dequeued
+    SetterBatch setters;          // RB_OP_APPLY_SETTERS
+  };
+  uint8_t client;
+  const char* okAck;     // Text ack after execution, nullptr for none
+  const char* errorAck;
+  uint16_t frameSeq;
+  uint8_t frameImmediate;  // Frame commands already handled in the callback (FRAME_START)
+  uint8_t flags;
+};
+
+struct CommandRing {
+  QueuedCommand entries[CMDQ_DEPTH];
+  uint8_t head;
+  uint8_t count;
+};
+
+// Latest pending value of an idempotent setter
+struct PendingSetter {
+  uint8_t op;
+  const char* name;  // In the combined ack
+  int32_t value;
+  uint32_t clients;  // Bit per client to ack
+  bool pending;
+};
+
+CommandRing cmdQueues[CMDQ_PRIORITIES];
+uint32_t cmdqOverflows = 0;
+PendingSetter cmdqSetters[CMDQ_SETTERS] = {
+  {RB_OP_SPEED, "speed", 0, 0, false},
+  {RB_OP_BRIGHTNESS, "brightness", 0, 0, false},
+  {RB_OP_LED, "led", 0, 0, false}
+};
+uint32_t cmdqCoalesced = 0;  // Setter values replaced before they were applied
+
+uint8_t cmdqPriorityFor(uint8_t op) {
+  return (op == RB_OP_PAUSE || op == RB_OP_STOP) ? CMDQ_PRIO_URGENT : CMDQ_PRIO_NORMAL;
+}
+
+uint8_t cmdqFree(uint8_t prio) {
+  return CMDQ_DEPTH - cmdQueues[prio].count;
+}
+
+// Append; false (and counted) if that priority is full
+bool cmdqPush(uint8_t prio, const QueuedCommand& entry) {
+  CommandRing& ring = cmdQueues[prio];
+  if (ring.count >= CMDQ_DEPTH) {
+    cmdqOverflows++;
+    return false;
+  }
+  QueuedCommand& slot = ring.entries[(ring.head + ring.count) % CMDQ_DEPTH];
+  slot = entry;
+  if (entry.cmd.text && entry.cmd.textLen) {
+    slot.cmd.textLen = min((size_t)entry.cmd.textLen, sizeof(slot.text));
+    memcpy(slot.text, entry.cmd.text, slot.cmd.textLen);
+  }
+  ring.count++;
+  return true;
+}
+
+// Take the oldest entry of the highest non-empty priority
+bool cmdqPop(QueuedCommand& out) {
+  for (int prio = CMDQ_PRIORITIES - 1; prio >= 0; prio--) {
+    CommandRing& ring = cmdQueues[prio];
+    if (ring.count == 0) continue;
+    out = ring.entries[ring.head];
+    out.cmd.text = out.text;
+    ring.head = (ring.head + 1) % CMDQ_DEPTH;
+    ring.count--;
+    return true;
+  }
+  return false;
+}
+
+PendingSetter* cmdqSetterFor(uint8_t op) {
+  for (PendingSetter& setter : cmdqSetters) {
+    if (setter.op == op) return &setter;
+  }
+  return nullptr;
+}
+
+void cmdqSetLatest(PendingSetter& setter, int32_t value, uint8_t client) {
+  if (setter.pending) cmdqCoalesced++;
+  setter.value = value;
+  setter.clients |= 1UL << client;
+  setter.pending = true;
+}
+
+bool cmdqSettersPending() {
+  for (const PendingSetter& setter : cmdqSetters) {
+    if (setter.pending) return true;
+  }
+  return false;
+}
+
+// Copy the pending setters into a batch; cmdqDropSetters() once it is queued
+void cmdqSnapshotSetters(SetterBatch& batch) {
+  batch.pending = 0;
+  for (uint8_t i = 0; i < CMDQ_SETTERS; i++) {
+    const PendingSetter& setter = cmdqSetters[i];
+    batch.value[i] = setter.value;
+    batch.clients[i] = setter.clients;
+    if (setter.pending) batch.pending |= 1 << i;
+  }
+}
+
+void cmdqDropSetters() {
+  for (PendingSetter& setter : cmdqSetters) {
+    setter.pending = false;
+    setter.clients = 0;
+  }
+}
+
+// Drop everything below prio; onDropped sees each entry (to ack cancelled frames)
+void cmdqDiscardBelow(uint8_t prio, void (*onDropped)(const QueuedCommand&)) {
+  for (int p = 0; p < prio; p++) {
+    CommandRing& ring = cmdQueues[p];
+    while (ring.count > 0) {
+      if (onDropped) onDropped(ring.entries[ring.head]);
+      ring.head = (ring.head + 1) % CMDQ_DEPTH;
+      ring.count--;
+    }
+  }
+}
+
+#endif
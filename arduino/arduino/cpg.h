@@ -0,0 +1,216 @@
+/*
+ * =========================================================
+ * CPG - PROCEDURAL OSCILLATOR MOTION GENERATOR
+ * =========================================================
+ * Central-pattern-generator for songs without authored
+ * choreography (uploaded MP3s). One phase oscillator per
+ * servo joint, each phase-locked to a master beat oscillator
+ * driven by the client's tempo ("tempo:<bpm>") or the beat
+ * tracker (cpgSyncBeat), and scaled by its energy ("energy:<0-255>").
+ *
+ * - All phases are 32-bit fixed point (2^32 = one cycle)
+ * - Amplitude, centre and phase offset glide to their targets,
+ *   so motif and mirror changes never jump
+ * - The robot mirrors left/right every CPG_MIRROR_BEATS beats
+ * - A tick is integer math plus one sin16() per joint
+ * =========================================================
+ */
+
+#ifndef CPG_H
+#define CPG_H
+
+// Include required libraries
+#include <Arduino.h>
+#include <FastLED.h>  // sin16() from lib8tion
+
+// External function declarations (these will be defined in the main file)
+extern void pwmWriteAngle(uint8_t ch, float angle);
+extern int servoHome[12];
+extern int currentServoAngles[12];
+
+// === CPG SETTINGS ===
+#define CPG_JOINTS 12
+#define CPG_TICK_MS 20            // 50 Hz, one servo frame
+#define CPG_MIN_BPM 40
+#define CPG_MAX_BPM 240
+#define CPG_SMOOTH_SHIFT 4        // Parameter glide, ~320 ms time constant at 50 Hz
+#define CPG_COUPLING_SHIFT 12     // Phase-lock strength towards the master beat
+#define CPG_MIRROR_BEATS 16       // Swap left/right phase every 16 beats
+#define CPG_SYNC_SHIFT 1          // Half the phase error to an outside beat clock removed per beat
+
+// Per-joint motif parameters. ratio is in half-beats per cycle:
+// 1 = one swing every two beats, 2 = every beat, 4 = twice per beat.
+struct CpgJointPreset {
+  int8_t amplitude;    // Degrees either side of centre
+  int8_t centerShift;  // Degrees added to the servo home position
+  uint8_t phase;       // Phase offset, 256 = full cycle
+  uint8_t ratio;       // Frequency multiplier in half-beats
+};
+
+// Joint order matches the servo channels:
+// 0-2 left arm, 3-5 right arm, 6-8 leg 1, 9-11 leg 2
+const CpgJointPreset CPG_MOTIFS[3][CPG_JOINTS] = {
+  // Sway - low energy, half-time arm swings and a gentle hip rock
+  {
+    {20, 0, 0, 1}, {10, 15, 64, 1}, {0, 0, 0, 1},
+    {20, 0, 0, 1}, {10, 30, 64, 1}, {0, 0, 0, 1},
+    {4, 4, 0, 2}, {0, 0, 0, 2}, {0, 0, 0, 2},
+    {4, 4, 0, 2}, {0, 0, 0, 2}, {0, 0, 0, 2}
+  },
+  // Groove - on-beat arms with lagging forearms, bouncing legs
+  {
+    {30, 0, 0, 2}, {20, 25, 64, 2}, {15, -20, 128, 2},
+    {30, 0, 0, 2}, {20, 40, 64, 2}, {15, 20, 128, 2},
+    {8, 8, 0, 2}, {6, 6, 64, 2}, {4, 4, 128, 2},
+    {8, 8, 0, 2}, {6, 6, 64, 2}, {4, 4, 128, 2}
+  },
+  // Hype - wide shoulders, double-time elbows and knees
+  {
+    {40, 0, 0, 2}, {30, 35, 64, 4}, {25, -30, 32, 4},
+    {40, 0, 0, 2}, {30, 50, 64, 4}, {25, -10, 32, 4},
+    {12, 12, 0, 2}, {10, 10, 0, 4}, {8, 8, 64, 4},
+    {12, 12, 0, 2}, {10, 10, 0, 4}, {8, 8, 64, 4}
+  }
+};
+
+// Oscillator state, amplitudes and centres in 1/256 degree
+struct CpgOscillator {
+  uint32_t phase;
+  int32_t amplitude;
+  int32_t center;
+  uint16_t phaseOffset;
+};
+
+CpgOscillator cpgJoints[CPG_JOINTS];
+
+// -- CPG STATE VARIABLES --
+bool cpgActive = false;
+uint64_t cpgBeatPhase = 0;        // Beats elapsed, 32.32 fixed point
+uint32_t cpgBeatIncQ8 = 0;        // Beat phase per microsecond, Q8 of the 2^32 cycle
+int cpgTempo = 120;
+uint8_t cpgEnergy = 128;          // Client value
+uint8_t cpgEnergySmooth = 128;    // Glided value used for amplitude scaling
+uint8_t cpgMotif = 1;
+bool cpgMirrored = false;
+unsigned long lastCpgUpdate = 0;
+unsigned long lastCpgMicros = 0;
+unsigned long cpgTickCostUs = 0;  // Cost of the last oscillator update (excludes I2C writes)
+
+void cpgSetTempo(int bpm) {
+  cpgTempo = constrain(bpm, CPG_MIN_BPM, CPG_MAX_BPM);
+  // One beat per 60e6/bpm microseconds; keep 8 extra bits so slow tempos stay accurate
+  cpgBeatIncQ8 = (uint32_t)(((uint64_t)cpgTempo << 40) / 60000000ULL);
+}
+
+// Follow an outside beat clock: its exact period, and the master phase pulled towards
+// its beats (sinceBeatUs after one). The joints follow the master through their coupling.
+void cpgSyncBeat(uint32_t periodUs, uint32_t sinceBeatUs) {
+  if (periodUs == 0) return;
+  cpgTempo = constrain((int)((60000000UL + periodUs / 2) / periodUs), CPG_MIN_BPM, CPG_MAX_BPM);
+  cpgBeatIncQ8 = (uint32_t)((1ULL << 40) / periodUs);
+  uint32_t target = (uint32_t)(((uint64_t)(sinceBeatUs % periodUs) << 32) / periodUs);
+  int32_t error = (int32_t)(target - (uint32_t)cpgBeatPhase);
+  cpgBeatPhase += (int64_t)(error >> CPG_SYNC_SHIFT);
+}
+
+void cpgSetEnergy(int energy) {
+  cpgEnergy = constrain(energy, 0, 255);
+}
+
+// Recompute the target phase offset of one joint (motif offset + mirror swap)
+uint16_t cpgTargetOffset(int joint) {
+  uint16_t offset = (uint16_t)CPG_MOTIFS[cpgMotif][joint].phase << 8;
+  bool rightSide = (joint >= 3 && joint <= 5) || joint >= 9;
+  if (rightSide && cpgMirrored) offset += 32768;
+  return offset;
+}
+
+void cpgStart() {
+  if (cpgActive) return;
+  cpgActive = true;
+  cpgBeatPhase = 0;
+  cpgMirrored = false;
+  cpgEnergySmooth = cpgEnergy;
+  for (int i = 0; i < CPG_JOINTS; i++) {
+    cpgJoints[i].phase = 0;
+    cpgJoints[i].amplitude = 0;  // Glide in from the current pose
+    cpgJoints[i].center = (int32_t)currentServoAngles[i] << 8;
+    cpgJoints[i].phaseOffset = cpgTargetOffset(i);
+  }
+  lastCpgMicros = micros();
+  lastCpgUpdate = millis();
+  Serial.print("CPG started at ");
+  Serial.print(cpgTempo);
+  Serial.println(" BPM");
+}
+
+// Restart the tick clock after the engine was suspended
+void cpgResync() {
+  lastCpgMicros = micros();
+  lastCpgUpdate = millis();
+}
+
+void cpgStop() {
+  if (!cpgActive) return;
+  cpgActive = false;
+  Serial.println("CPG stopped");
+}
+
+// Advance all oscillators and write any servo whose angle changed
+void updateCpg() {
+  if (!cpgActive) return;
+  if (millis() - lastCpgUpdate < CPG_TICK_MS) return;
+  lastCpgUpdate = millis();
+
+  unsigned long nowUs = micros();
+  uint32_t dtUs = nowUs - lastCpgMicros;
+  lastCpgMicros = nowUs;
+  if (dtUs > 100000) dtUs = 100000;  // Don't sprint after a long stall
+
+  uint32_t oldBeat = (uint32_t)(cpgBeatPhase >> 32);
+  cpgBeatPhase += ((uint64_t)cpgBeatIncQ8 * dtUs) >> 8;
+  uint32_t beat = (uint32_t)(cpgBeatPhase >> 32);
+
+  // Motif and mirror only change on a beat boundary
+  if (beat != oldBeat) {
+    cpgMotif = cpgEnergySmooth < 85 ? 0 : (cpgEnergySmooth < 170 ? 1 : 2);
+    if (beat % CPG_MIRROR_BEATS == 0) cpgMirrored = !cpgMirrored;
+  }
+  // An eighth of the gap, but at least 1, so it reaches the target from above and below
+  int energyGap = (int)cpgEnergy - (int)cpgEnergySmooth;
+  if (energyGap) cpgEnergySmooth += energyGap / 8 ? energyGap / 8 : (energyGap > 0 ? 1 : -1);
+
+  // Amplitude scale 0.25 .. 1.0 (Q8) from energy
+  int32_t energyScale = 64 + ((int32_t)cpgEnergySmooth * 192 >> 8);
+  int angles[CPG_JOINTS];
+
+  for (int i = 0; i < CPG_JOINTS; i++) {
+    const CpgJointPreset& preset = CPG_MOTIFS[cpgMotif][i];
+    CpgOscillator& osc = cpgJoints[i];
+
+    // Glide parameters
+    int32_t targetAmp = ((int32_t)preset.amplitude << 8) * energyScale >> 8;
+    int32_t targetCenter = (int32_t)(servoHome[i] + preset.centerShift) << 8;
+    osc.amplitude += (targetAmp - osc.amplitude) >> CPG_SMOOTH_SHIFT;
+    osc.center += (targetCenter - osc.center) >> CPG_SMOOTH_SHIFT;
+    osc.phaseOffset += (int16_t)(cpgTargetOffset(i) - osc.phaseOffset) >> CPG_SMOOTH_SHIFT;
+
+    // Free-run at the joint's ratio, then pull towards the master beat
+    uint32_t natural = (uint32_t)((((uint64_t)cpgBeatIncQ8 * dtUs) >> 8) * preset.ratio >> 1);
+    uint32_t target = (uint32_t)((cpgBeatPhase * preset.ratio) >> 1) + ((uint32_t)osc.phaseOffset << 16);
+    uint16_t error = (uint16_t)((target - osc.phase) >> 16);
+    osc.phase += natural + ((int32_t)sin16(error) << CPG_COUPLING_SHIFT);
+
+    int32_t angle = osc.center + (((int32_t)sin16(osc.phase >> 16) * osc.amplitude) >> 15);
+    angles[i] = constrain(angle >> 8, 0, 180);
+  }
+  cpgTickCostUs = micros() - nowUs;
+
+  for (int i = 0; i < CPG_JOINTS; i++) {
+    if (angles[i] != currentServoAngles[i]) {
+      pwmWriteAngle(i, angles[i]);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,155 @@
+/*
+ * =========================================================
+ * KEYFRAMES - COMPRESSED CHOREOGRAPHY FORMAT & PLAYER
+ * =========================================================
+ * Dance steps stored as byte streams in flash and decoded
+ * one keyframe at a time while the step plays (non-blocking).
+ *
+ * Track layout (one per dance step):
+ *   varint keyframeCount
+ *   keyframe * keyframeCount:
+ *     varint durationMs  - time to travel from the previous keyframe
+ *     varint channelMask - bit 0-11 servo channels, bit 12 base pins
+ *     zigzag varint delta for each set bit, lowest channel first
+ *
+ * Values are uint8: servo angles 0-180, base pins IN1..IN4 as
+ * bits 0-3. Deltas start from the home pose with the base stopped,
+ * so a track never depends on where the previous one ended.
+ * Servos move linearly across the keyframe; the base switches at
+ * its start. Tracks are generated by tools/choreo_encode.cpp.
+ * =========================================================
+ */
+
+#ifndef KEYFRAMES_H
+#define KEYFRAMES_H
+
+// Include required libraries
+#include <Arduino.h>
+
+// External function declarations (these will be defined in the main file)
+extern void pwmWriteAngle(uint8_t ch, float angle);
+extern void setBasePins(uint8_t pins);
+extern int servoHome[12];
+extern int currentServoAngles[12];
+
+#define CHOREO_SERVOS 12
+#define CHOREO_CHANNELS 13
+#define CHOREO_BASE_CHANNEL 12
+
+// One song: all step tracks back to back, plus where each step starts
+struct ChoreoSong {
+  const char* name;
+  const uint8_t* data;
+  const uint16_t* stepOffsets;  // stepOffsets[n - 1] is the start of step n
+  uint8_t stepCount;
+};
+
+// Streaming decoder and interpolation state
+struct ChoreoPlayer {
+  const uint8_t* pos;
+  uint16_t remaining;             // Keyframes left after the current one
+  uint16_t keyframe;              // Index of the current keyframe in its step
+  uint16_t mask;                  // Channels moving in the current keyframe
+  uint32_t duration;
+  unsigned long start;
+  uint8_t target[CHOREO_CHANNELS];  // Decoder state, also the delta base
+  uint8_t from[CHOREO_SERVOS];
+  bool active;
+};
+
+ChoreoPlayer choreo = {nullptr, 0, 0, 0, 0, 0, {0}, {0}, false};
+
+uint32_t choreoReadVarint() {
+  uint32_t value = 0;
+  uint8_t shift = 0;
+  uint8_t b;
+  do {
+    b = pgm_read_byte(choreo.pos++);
+    value |= (uint32_t)(b & 0x7F) << shift;
+    shift += 7;
+  } while (b & 0x80);
+  return value;
+}
+
+// Decode the next keyframe; the servos it moves start from where they are now
+void choreoLoadKeyframe() {
+  choreo.duration = choreoReadVarint();
+  choreo.mask = choreoReadVarint();
+  for (int ch = 0; ch < CHOREO_CHANNELS; ch++) {
+    if (!(choreo.mask & (1 << ch))) continue;
+    uint32_t zz = choreoReadVarint();
+    int32_t delta = (int32_t)(zz >> 1) ^ -(int32_t)(zz & 1);
+    choreo.target[ch] = (uint8_t)(choreo.target[ch] + delta);
+    if (ch < CHOREO_SERVOS) {
+      choreo.from[ch] = currentServoAngles[ch];
+    } else {
+      setBasePins(choreo.target[ch]);
+    }
+  }
+}
+
+bool choreoStart(const ChoreoSong* song, int step) {
+  if (song == nullptr || step < 1 || step > song->stepCount) return false;
+  choreo.pos = song->data + pgm_read_word(&song->stepOffsets[step - 1]);
+  uint32_t count = choreoReadVarint();
+  if (count == 0) return false;
+  for (int ch = 0; ch < CHOREO_SERVOS; ch++) choreo.target[ch] = servoHome[ch];
+  choreo.target[CHOREO_BASE_CHANNEL] = 0;
+  choreo.remaining = count - 1;
+  choreo.keyframe = 0;
+  choreo.start = millis();
+  choreo.active = true;
+  choreoLoadKeyframe();
+  return true;
+}
+
+// Glide every servo back to its home pose as a single keyframe
+void choreoStartHome(uint32_t durationMs) {
+  for (int ch = 0; ch < CHOREO_SERVOS; ch++) {
+    choreo.from[ch] = currentServoAngles[ch];
+    choreo.target[ch] = servoHome[ch];
+  }
+  choreo.target[CHOREO_BASE_CHANNEL] = 0;
+  setBasePins(0);
+  choreo.mask = (1 << CHOREO_SERVOS) - 1;
+  choreo.duration = durationMs;
+  choreo.remaining = 0;
+  choreo.keyframe = 0;
+  choreo.start = millis();
+  choreo.active = true;
+}
+
+void choreoStop() {
+  choreo.active = false;
+}
+
+// Advance the current step: interpolate moving servos, step through finished keyframes
+void updateChoreo() {
+  if (!choreo.active) return;
+  unsigned long elapsed = millis() - choreo.start;
+
+  while (elapsed >= choreo.duration) {
+    for (int ch = 0; ch < CHOREO_SERVOS; ch++) {
+      if ((choreo.mask & (1 << ch)) && currentServoAngles[ch] != choreo.target[ch]) {
+        pwmWriteAngle(ch, choreo.target[ch]);
+      }
+    }
+    if (choreo.remaining == 0) {
+      choreo.active = false;
+      return;
+    }
+    choreo.remaining--;
+    choreo.keyframe++;
+    choreo.start += choreo.duration;  // Keep the step's timeline, even if this tick was late
+    elapsed -= choreo.duration;
+    choreoLoadKeyframe();
+  }
+
+  for (int ch = 0; ch < CHOREO_SERVOS; ch++) {
+    if (!(choreo.mask & (1 << ch))) continue;
+    int angle = choreo.from[ch] + ((int)choreo.target[ch] - choreo.from[ch]) * (int32_t)elapsed / (int32_t)choreo.duration;
+    if (angle != currentServoAngles[ch]) pwmWriteAngle(ch, angle);
+  }
+}
+
+#endif
@@ -0,0 +1,298 @@
+/*
+ * =========================================================
+ * LED CUES - BEAT-ALIGNED LED TIMELINE PER SONG
+ * =========================================================
+ * Each song carries a cue track: pattern changes, colour fills
+ * and flashes at positions counted in quarter beats. The track
+ * starts with the song and plays against the robot's own clock,
+ * so a show needs no per-cue network messages.
+ *
+ * - Position = elapsed us * bpm / 15,000,000 quarter beats; a
+ *   tempo change keeps the current position
+ * - Cues from loopStart up to loopEnd repeat until the song ends
+ * - CUE_BEATS flashes the accent layer every n quarter beats
+ *   until changed, so a steady beat is one cue
+ * - Tracks with bpm 0 follow the "tempo:" sent for uploaded songs
+ * - Pause holds the position, resume carries on from it
+ * =========================================================
+ */
+
+#ifndef LED_CUES_H
+#define LED_CUES_H
+
+// Include required libraries
+#include <Arduino.h>
+#include <FastLED.h>
+
+// External function declarations (these will be defined in the main file)
+extern void cueSetPattern(uint8_t pattern);
+extern void cueSetColor(const CRGB& color);
+extern void cueFlash(const CRGB& color);
+
+enum LedCueOp : uint8_t {
+  CUE_PATTERN,  // arg = pattern, as sent with led: (LedPattern)
+  CUE_COLOR,    // Solid colour on the base layer
+  CUE_FLASH,    // One accent flash in colour
+  CUE_BEATS     // Accent flash every arg quarter beats in colour, 0 = off
+};
+
+// Pattern numbers on the wire (LedPattern in RythmoBot.ino)
+#define CUE_OFF 0
+#define CUE_RAINBOW 1
+#define CUE_PULSE 2
+#define CUE_CHASE 3
+#define CUE_STROBE 4
+#define CUE_FIRE 5
+#define CUE_DANCE 6
+#define CUE_BREATHING 11
+#define CUE_WAVE 12
+#define CUE_VU 13
+#define CUE_BASS 14
+#define CUE_SPECTRUM 15
+
+#define CUE_Q(beat) ((beat) * 4)  // Quarter beats from a beat number
+
+struct LedCue {
+  uint16_t quarter;  // Quarter beats from the start of the song
+  uint8_t op;
+  uint8_t arg;
+  uint8_t r, g, b;
+};
+
+struct LedCueTrack {
+  const char* name;
+  uint16_t bpm;          // 0 = follow the CPG tempo
+  uint16_t loopStart;    // Quarter beats
+  uint16_t loopEnd;      // Cues at or after this never play
+  const LedCue* cues;    // Sorted by quarter
+  uint8_t count;
+};
+
+// === CUE TRACKS ===
+// Tempos are those of the recordings the web app plays
+const LedCue FALLING_CUES[] PROGMEM = {
+  {CUE_Q(0), CUE_COLOR, 0, 255, 60, 120},
+  {CUE_Q(0), CUE_BEATS, 4, 255, 255, 255},
+  {CUE_Q(16), CUE_PATTERN, CUE_BREATHING, 0, 0, 0},
+  {CUE_Q(32), CUE_PATTERN, CUE_WAVE, 0, 0, 0},
+  {CUE_Q(32), CUE_BEATS, 4, 255, 120, 200},
+  {CUE_Q(48), CUE_FLASH, 0, 255, 0, 80},
+  {CUE_Q(48), CUE_PATTERN, CUE_DANCE, 0, 0, 0},
+  {CUE_Q(64), CUE_BEATS, 2, 255, 255, 255},
+  {CUE_Q(80), CUE_COLOR, 0, 255, 60, 120},
+};
+
+const LedCue STEREO_CUES[] PROGMEM = {
+  {CUE_Q(0), CUE_PATTERN, CUE_PULSE, 0, 0, 0},
+  {CUE_Q(8), CUE_BEATS, 4, 0, 120, 255},
+  {CUE_Q(16), CUE_PATTERN, CUE_RAINBOW, 0, 0, 0},
+  {CUE_Q(16), CUE_BEATS, 4, 255, 255, 255},
+  {CUE_Q(32), CUE_PATTERN, CUE_CHASE, 0, 0, 0},
+  {CUE_Q(48), CUE_PATTERN, CUE_DANCE, 0, 0, 0},
+  {CUE_Q(48), CUE_BEATS, 2, 255, 255, 255},
+  {CUE_Q(60), CUE_PATTERN, CUE_STROBE, 0, 0, 0},
+  {CUE_Q(62), CUE_FLASH, 0, 255, 0, 255},
+};
+
+const LedCue FADED_CUES[] PROGMEM = {
+  {CUE_Q(0), CUE_COLOR, 0, 0, 30, 80},
+  {CUE_Q(8), CUE_PATTERN, CUE_BREATHING, 0, 0, 0},
+  {CUE_Q(16), CUE_PATTERN, CUE_WAVE, 0, 0, 0},
+  {CUE_Q(16), CUE_BEATS, 8, 120, 180, 255},
+  {CUE_Q(32), CUE_FLASH, 0, 255, 255, 255},
+  {CUE_Q(32), CUE_PATTERN, CUE_RAINBOW, 0, 0, 0},
+  {CUE_Q(32), CUE_BEATS, 4, 255, 255, 255},
+  {CUE_Q(48), CUE_COLOR, 0, 0, 30, 80},
+  {CUE_Q(48), CUE_BEATS, 8, 120, 180, 255},
+};
+
+const LedCue ALONE_CUES[] PROGMEM = {
+  {CUE_Q(0), CUE_PATTERN, CUE_WAVE, 0, 0, 0},
+  {CUE_Q(16), CUE_BEATS, 4, 255, 255, 255},
+  {CUE_Q(32), CUE_PATTERN, CUE_FIRE, 0, 0, 0},
+  {CUE_Q(32), CUE_BEATS, 2, 255, 200, 0},
+  {CUE_Q(48), CUE_FLASH, 0, 255, 255, 255},
+  {CUE_Q(48), CUE_PATTERN, CUE_DANCE, 0, 0, 0},
+  {CUE_Q(48), CUE_BEATS, 4, 255, 255, 255},
+  {CUE_Q(64), CUE_PATTERN, CUE_CHASE, 0, 0, 0},
+};
+
+const LedCue NEURAL_CUES[] PROGMEM = {
+  {CUE_Q(0), CUE_PATTERN, CUE_RAINBOW, 0, 0, 0},
+  {CUE_Q(0), CUE_BEATS, 4, 255, 255, 255},
+  {CUE_Q(16), CUE_PATTERN, CUE_FIRE, 0, 0, 0},
+  {CUE_Q(32), CUE_PATTERN, CUE_CHASE, 0, 0, 0},
+  {CUE_Q(32), CUE_BEATS, 2, 255, 0, 120},
+  {CUE_Q(48), CUE_PATTERN, CUE_DANCE, 0, 0, 0},
+  {CUE_Q(48), CUE_BEATS, 4, 255, 255, 255},
+  {CUE_Q(64), CUE_PATTERN, CUE_WAVE, 0, 0, 0},
+};
+
+// Uploaded songs: same loop on whatever tempo the client detected
+const LedCue OTHER_CUES[] PROGMEM = {
+  {CUE_Q(0), CUE_PATTERN, CUE_DANCE, 0, 0, 0},
+  {CUE_Q(0), CUE_BEATS, 4, 255, 255, 255},
+  {CUE_Q(16), CUE_PATTERN, CUE_RAINBOW, 0, 0, 0},
+  {CUE_Q(32), CUE_PATTERN, CUE_WAVE, 0, 0, 0},
+  {CUE_Q(32), CUE_BEATS, 2, 255, 255, 255},
+  {CUE_Q(48), CUE_PATTERN, CUE_CHASE, 0, 0, 0},
+  {CUE_Q(48), CUE_BEATS, 4, 255, 255, 255},
+};
+
+#define CUE_COUNT(cues) (sizeof(cues) / sizeof(cues[0]))
+
+// Looked up by song name; the last entry also serves unknown songs
+const LedCueTrack LED_CUE_TRACKS[] = {
+  {"Falling For You", 100, CUE_Q(16), CUE_Q(96), FALLING_CUES, CUE_COUNT(FALLING_CUES)},
+  {"Stereo Love", 127, CUE_Q(16), CUE_Q(64), STEREO_CUES, CUE_COUNT(STEREO_CUES)},
+  {"Faded", 90, CUE_Q(16), CUE_Q(64), FADED_CUES, CUE_COUNT(FADED_CUES)},
+  {"Alone", 142, CUE_Q(16), CUE_Q(80), ALONE_CUES, CUE_COUNT(ALONE_CUES)},
+  {"Mastie Mashup", 105, CUE_Q(0), CUE_Q(80), NEURAL_CUES, CUE_COUNT(NEURAL_CUES)},
+  {"Other", 0, CUE_Q(0), CUE_Q(64), OTHER_CUES, CUE_COUNT(OTHER_CUES)},
+};
+const int LED_CUE_TRACK_COUNT = sizeof(LED_CUE_TRACKS) / sizeof(LED_CUE_TRACKS[0]);
+
+const LedCueTrack* ledCueTrackFor(const char* song) {
+  for (int i = 0; i < LED_CUE_TRACK_COUNT - 1; i++) {
+    if (strcmp(song, LED_CUE_TRACKS[i].name) == 0) return &LED_CUE_TRACKS[i];
+  }
+  return &LED_CUE_TRACKS[LED_CUE_TRACK_COUNT - 1];
+}
+
+// -- LED CUE STATE VARIABLES --
+const LedCueTrack* cueTrack = nullptr;
+unsigned long cueBaseUs = 0;     // micros() at quarter 0 of the current pass
+unsigned long cuePausedUs = 0;   // Elapsed time held while paused
+bool cuePaused = false;
+uint16_t cueBpm = 0;
+uint8_t cueIndex = 0;            // Next cue to fire
+uint8_t cueBeatEvery = 0;        // CUE_BEATS interval, 0 = off
+CRGB cueBeatColor = CRGB::White;
+bool cueLoopSaved = false;       // The beat settings at loopStart, restored on each wrap
+uint8_t cueLoopBeatEvery = 0;
+CRGB cueLoopBeatColor = CRGB::White;
+uint32_t cueLastBeat = 0xFFFFFFFF;
+uint32_t cuesFired = 0;
+
+void ledCuesStart(const LedCueTrack* track) {
+  cueTrack = track;
+  cueBaseUs = micros();
+  cuePaused = false;
+  cueBpm = 0;
+  cueIndex = 0;
+  cueBeatEvery = 0;
+  cueLoopSaved = false;
+  cueLastBeat = 0xFFFFFFFF;
+  cuesFired = 0;
+}
+
+void ledCuesStop() {
+  cueTrack = nullptr;
+}
+
+bool ledCuesActive() {
+  return cueTrack != nullptr;
+}
+
+void ledCuesPause() {
+  if (!cueTrack || cuePaused) return;
+  cuePausedUs = micros() - cueBaseUs;
+  cuePaused = true;
+}
+
+void ledCuesResume() {
+  if (!cueTrack || !cuePaused) return;
+  cueBaseUs = micros() - cuePausedUs;
+  cuePaused = false;
+}
+
+void ledCueApply(const LedCue& cue) {
+  CRGB color(cue.r, cue.g, cue.b);
+  switch (cue.op) {
+    case CUE_PATTERN:
+      cueSetPattern(cue.arg);
+      break;
+    case CUE_COLOR:
+      cueSetColor(color);
+      break;
+    case CUE_FLASH:
+      cueFlash(color);
+      break;
+    case CUE_BEATS:
+      cueBeatEvery = cue.arg;
+      cueBeatColor = color;
+      cueLastBeat = 0xFFFFFFFF;  // First flash on this quarter
+      break;
+  }
+  cuesFired++;
+}
+
+// Fire every cue due up to quarter (exclusive of limit)
+void ledCuesFireUpTo(uint32_t quarter, uint32_t limit) {
+  while (cueIndex < cueTrack->count) {
+    LedCue cue;
+    memcpy_P(&cue, &cueTrack->cues[cueIndex], sizeof(cue));
+    if (cue.quarter > quarter || cue.quarter >= limit) return;
+    if (!cueLoopSaved && cue.quarter >= cueTrack->loopStart) {
+      cueLoopSaved = true;
+      cueLoopBeatEvery = cueBeatEvery;
+      cueLoopBeatColor = cueBeatColor;
+    }
+    ledCueApply(cue);
+    cueIndex++;
+  }
+}
+
+// Once per loop pass; fallbackBpm is used by tracks without a tempo of their own
+void ledCuesPoll(uint16_t fallbackBpm) {
+  if (!cueTrack || cuePaused) return;
+  uint16_t bpm = cueTrack->bpm ? cueTrack->bpm : fallbackBpm;
+  if (bpm == 0) return;
+  unsigned long now = micros();
+  if (bpm != cueBpm) {
+    // Keep the position: the same quarter at the new tempo is further or closer in time
+    if (cueBpm != 0) cueBaseUs = now - (unsigned long)((uint64_t)(now - cueBaseUs) * cueBpm / bpm);
+    cueBpm = bpm;
+  }
+
+  uint32_t quarter = (uint64_t)(now - cueBaseUs) * bpm / 15000000ULL;
+  ledCuesFireUpTo(quarter, cueTrack->loopEnd);
+  if (quarter >= cueTrack->loopEnd) {
+    // Back to loopStart, whole loops at a time after a stall
+    uint32_t loopQuarters = cueTrack->loopEnd - cueTrack->loopStart;
+    uint32_t loops = (quarter - cueTrack->loopStart) / loopQuarters;
+    cueBaseUs += (unsigned long)((uint64_t)loops * loopQuarters * 15000000ULL / bpm);
+    quarter = (uint64_t)(now - cueBaseUs) * bpm / 15000000ULL;
+    cueIndex = 0;
+    while (cueIndex < cueTrack->count && pgm_read_word(&cueTrack->cues[cueIndex].quarter) < cueTrack->loopStart) {
+      cueIndex++;
+    }
+    if (cueLoopSaved) {
+      cueBeatEvery = cueLoopBeatEvery;
+      cueBeatColor = cueLoopBeatColor;
+    }
+    cueLastBeat = 0xFFFFFFFF;
+    ledCuesFireUpTo(quarter, cueTrack->loopEnd);
+  }
+
+  if (cueBeatEvery) {
+    uint32_t beat = quarter / cueBeatEvery;
+    if (beat != cueLastBeat) {
+      cueLastBeat = beat;
+      cueFlash(cueBeatColor);
+    }
+  }
+}
+
+// "song,quarter,bpm,fired" or "none"
+void ledCuesInfo(char* out, size_t size) {
+  if (!cueTrack) {
+    snprintf(out, size, "none");
+    return;
+  }
+  unsigned long elapsed = cuePaused ? cuePausedUs : micros() - cueBaseUs;
+  uint32_t quarter = cueBpm ? (uint64_t)elapsed * cueBpm / 15000000ULL : 0;
+  snprintf(out, size, "%s,%lu,%u,%lu", cueTrack->name, (unsigned long)quarter, cueBpm, (unsigned long)cuesFired);
+}
+
+#endif
@@ -0,0 +1,147 @@
+/*
+ * =========================================================
+ * LED EFFECTS - SEGMENTS, PHASE TABLES, FIXED-POINT KERNELS
+ * =========================================================
+ * The pixel buffer is cut into segments, by default one per
+ * strip. Each pixel's position along its segment is worked out
+ * once, as an 8-bit phase (0 at the start, 255 at the end,
+ * counting down on reversed segments). Effects that spread a hue
+ * or a wave along a strip then cost one table read per pixel
+ * instead of a multiply and a divide, whatever the strip length.
+ *
+ * - ledAddSegment() fills ledPhase[] with 8.8 fixed-point steps
+ *   (one divide per segment, none per pixel)
+ * - Kernels take pixels and parameters explicitly, no clock or
+ *   globals, so tools/bench_leds.cpp times them on the host
+ * - Effects tied to a position (chase, fill, burst) run once per
+ *   segment, so every strip of a rig shows the whole effect
+ * - Kernels whose colour depends only on the phase (sine fill,
+ *   burst) work it out once per phase value into ledPhaseColors[]
+ *   when the buffer has more pixels than phase values, then copy
+ * =========================================================
+ */
+
+#ifndef LED_EFFECTS_H
+#define LED_EFFECTS_H
+
+// Include required libraries
+#include <Arduino.h>
+#include <FastLED.h>
+
+#define LED_MAX_SEGMENTS 8
+#define LED_PHASE_VALUES 256  // Kernels switch to a colour per phase value above this many pixels
+
+struct LedSegment {
+  uint16_t start;
+  uint16_t count;
+  bool reversed;
+};
+
+// -- LED SEGMENT STATE VARIABLES --
+LedSegment ledSegments[LED_MAX_SEGMENTS];
+uint8_t ledSegmentCount = 0;
+uint8_t* ledPhase = nullptr;  // One byte per pixel
+CRGB ledPhaseColors[LED_PHASE_VALUES];  // Scratch, refilled by each kernel that uses it
+
+void ledSegmentsBegin(uint8_t* phaseTable) {
+  ledPhase = phaseTable;
+  ledSegmentCount = 0;
+}
+
+bool ledAddSegment(uint16_t start, uint16_t count, bool reversed) {
+  if (ledSegmentCount >= LED_MAX_SEGMENTS || count == 0) return false;
+  ledSegments[ledSegmentCount++] = {start, count, reversed};
+  uint32_t step = (256UL << 8) / count;
+  uint32_t acc = 0;
+  for (uint16_t k = 0; k < count; k++, acc += step) {
+    ledPhase[reversed ? start + count - 1 - k : start + k] = acc >> 8;
+  }
+  return true;
+}
+
+// k-th pixel along a segment, in its direction
+inline uint16_t ledSegmentPixel(const LedSegment& seg, uint16_t k) {
+  return seg.reversed ? seg.start + seg.count - 1 - k : seg.start + k;
+}
+
+// === KERNELS ===
+// Hue spread once across each segment
+void ledFxRainbow(CRGB* px, const uint8_t* phase, uint16_t n, uint8_t hue, uint8_t value) {
+  for (uint16_t i = 0; i < n; i++) px[i] = CHSV(hue + phase[i], 255, value);
+}
+
+// Brightness wave travelling along each segment, hue drifting half a wheel across it
+void ledFxWave(CRGB* px, const uint8_t* phase, uint16_t n, uint8_t hue, uint8_t offset) {
+  for (uint16_t i = 0; i < n; i++) px[i] = CHSV(hue + (phase[i] >> 1), 255, sin8(phase[i] + offset));
+}
+
+// One colour, brightness following a sine along each segment
+void ledFxSineFill(CRGB* px, const uint8_t* phase, uint16_t n, const CRGB& color, uint8_t offset) {
+  if (n <= LED_PHASE_VALUES) {
+    for (uint16_t i = 0; i < n; i++) {
+      px[i] = color;
+      px[i].nscale8(sin8(phase[i] + offset));
+    }
+    return;
+  }
+  for (uint16_t p = 0; p < LED_PHASE_VALUES; p++) {
+    ledPhaseColors[p] = color;
+    ledPhaseColors[p].nscale8(sin8(p + offset));
+  }
+  for (uint16_t i = 0; i < n; i++) px[i] = ledPhaseColors[phase[i]];
+}
+
+// Flickering black/red/orange/yellow; random8() is a 16-bit LCG, no call into the RNG driver
+void ledFxFire(CRGB* px, uint16_t n) {
+  for (uint16_t i = 0; i < n; i++) {
+    uint8_t heat = random8();
+    px[i] = heat < 80 ? CRGB(CRGB::Black) : heat < 160 ? CRGB(CRGB::Red) : heat < 220 ? CRGB(CRGB::Orange)
+                                                                                         : CRGB(CRGB::Yellow);
+  }
+}
+
+// Burst from the middle of each segment out to radius (0-255 = edge), dimmer towards its rim
+void ledFxBurst(CRGB* px, const uint8_t* phase, uint16_t n, uint8_t radius, uint8_t hue) {
+  // Phases fold onto half-distances from the middle (0-128), lit up to radius / 2
+  uint8_t lit = radius >> 1;
+  bool table = n > LED_PHASE_VALUES / 2;
+  if (table) {
+    for (uint8_t d = 0; d <= lit; d++) ledPhaseColors[d] = CHSV(hue, 255, max(255 - d * 2, 50));
+  }
+  for (uint16_t i = 0; i < n; i++) {
+    uint8_t d = phase[i] >= 128 ? phase[i] - 128 : 128 - phase[i];
+    if (d > lit) {
+      px[i] = CRGB::Black;
+    } else if (table) {
+      px[i] = ledPhaseColors[d];
+    } else {
+      px[i] = CHSV(hue, 255, max(255 - d * 2, 50));
+    }
+  }
+}
+
+// First fill/256 of each segment in colour, the rest untouched
+void ledFxFillSegments(CRGB* px, uint16_t fill, const CRGB& color) {
+  for (uint8_t s = 0; s < ledSegmentCount; s++) {
+    const LedSegment& seg = ledSegments[s];
+    uint16_t lit = ((uint32_t)seg.count * fill) >> 8;
+    for (uint16_t k = 0; k < lit; k++) px[ledSegmentPixel(seg, k)] = color;
+  }
+}
+
+// VU meter: each segment lit to level/256, green through yellow to red along it
+void ledFxVu(CRGB* px, const uint8_t* phase, uint16_t n, uint8_t level) {
+  for (uint16_t i = 0; i < n; i++) {
+    px[i] = phase[i] < level ? CRGB(CHSV(96 - (phase[i] * 96 >> 8), 255, 255)) : CRGB(CRGB::Black);
+  }
+}
+
+// Spectrum: each segment split into count bands, low to high along the hue wheel, band b lit at levels[b]
+void ledFxSpectrum(CRGB* px, const uint8_t* phase, uint16_t n, const uint8_t* levels, uint8_t count) {
+  for (uint16_t i = 0; i < n; i++) {
+    uint8_t band = phase[i] * count >> 8;
+    px[i] = CHSV(band * 224 / count, 255, levels[band]);
+  }
+}
+
+#endif
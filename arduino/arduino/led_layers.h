@@ -0,0 +1,189 @@
+/*
+ * =========================================================
+ * LED LAYERS - STACKED PATTERNS WITH OPACITY AND BLEND MODES
+ * =========================================================
+ * Instead of one exclusive pattern, the strip shows a stack:
+ *
+ *   LED_LAYER_BASE    the selected pattern (led:, songs, idle)
+ *   LED_LAYER_ACCENT  short flash on each dance step or cue beat
+ *   LED_LAYER_ALERT   obstacle warning
+ *   LED_LAYER_CLAP    clap burst
+ *
+ * Each layer renders its pattern into its own buffer at its own
+ * rate. When any layer renders, the stack is composited bottom to
+ * top into leds[]. Alerts and the clap sit on top of the base and
+ * disappear when stopped; nothing has to remember what to restore.
+ *
+ * Blend modes: normal (opacity = alpha), add, screen, multiply,
+ * lighten, keyed (normal, black pixels transparent).
+ * =========================================================
+ */
+
+#ifndef LED_LAYERS_H
+#define LED_LAYERS_H
+
+// Include required libraries
+#include <Arduino.h>
+#include <FastLED.h>
+
+enum LedLayerId : uint8_t {
+  LED_LAYER_BASE,
+  LED_LAYER_ACCENT,
+  LED_LAYER_ALERT,
+  LED_LAYER_CLAP,
+  LED_LAYERS
+};
+
+enum LedBlend : uint8_t {
+  LED_BLEND_NORMAL,
+  LED_BLEND_ADD,
+  LED_BLEND_SCREEN,
+  LED_BLEND_MULTIPLY,
+  LED_BLEND_LIGHTEN,
+  LED_BLEND_KEYED,
+  LED_BLENDS
+};
+
+struct LedLayer {
+  CRGB* pixels;
+  uint8_t pattern;         // LedPattern
+  bool active;
+  bool restarted;          // Started from inside its own render; keep step at 0
+  uint8_t opacity;
+  uint8_t blend;
+  uint16_t intervalMs;
+  unsigned long lastUpdate;
+  unsigned long startedAt;
+  int step;                // Frames rendered since the pattern started
+  uint8_t hue;
+  CRGB color;              // For patterns drawn in one colour (solid, accent)
+};
+
+// External function declarations (these will be defined in the main file)
+extern void renderLedPattern(LedLayer& layer);
+
+// -- LED LAYER STATE VARIABLES --
+LedLayer ledLayers[LED_LAYERS];
+uint16_t ledLayerPixels = 0;
+bool ledLayersDirty = false;  // A layer's pixels were written from outside its pattern
+
+// pixels: LED_LAYERS buffers of count pixels each
+void ledLayersBegin(CRGB* pixels, uint16_t count) {
+  const uint8_t BLEND[LED_LAYERS] = {LED_BLEND_NORMAL, LED_BLEND_ADD, LED_BLEND_KEYED, LED_BLEND_NORMAL};
+  const uint8_t OPACITY[LED_LAYERS] = {255, 160, 255, 255};
+  ledLayerPixels = count;
+  for (uint8_t id = 0; id < LED_LAYERS; id++) {
+    ledLayers[id] = {};
+    ledLayers[id].pixels = pixels + id * count;
+    ledLayers[id].blend = BLEND[id];
+    ledLayers[id].opacity = OPACITY[id];
+    ledLayers[id].color = CRGB::White;
+    fill_solid(ledLayers[id].pixels, count, CRGB::Black);
+  }
+}
+
+// (Re)start a pattern on a layer; it renders on the next pass
+void ledLayerStart(uint8_t id, uint8_t pattern, uint16_t intervalMs) {
+  LedLayer& layer = ledLayers[id];
+  layer.pattern = pattern;
+  layer.active = true;
+  layer.restarted = true;
+  layer.intervalMs = intervalMs;
+  layer.lastUpdate = millis() - intervalMs;
+  layer.startedAt = millis();
+  layer.step = 0;
+  layer.hue = 0;
+  fill_solid(layer.pixels, ledLayerPixels, CRGB::Black);
+}
+
+void ledLayerSetColor(uint8_t id, const CRGB& color) {
+  ledLayers[id].color = color;
+}
+
+void ledLayerStop(uint8_t id) {
+  ledLayers[id].active = false;
+}
+
+// Composite on the next pass even if no pattern is due
+void ledLayerInvalidate() {
+  ledLayersDirty = true;
+}
+
+bool ledLayerActive(uint8_t id) {
+  return ledLayers[id].active;
+}
+
+bool ledLayerConfigure(uint8_t id, uint8_t opacity, uint8_t blend) {
+  if (id >= LED_LAYERS || blend >= LED_BLENDS) return false;
+  ledLayers[id].opacity = opacity;
+  ledLayers[id].blend = blend;
+  return true;
+}
+
+// One layer pixel over the composite so far
+inline void ledBlendPixel(CRGB& out, CRGB src, uint8_t blend, uint8_t opacity) {
+  switch (blend) {
+    case LED_BLEND_KEYED:
+      if (!src.r && !src.g && !src.b) return;
+      out = opacity == 255 ? src : ::blend(out, src, opacity);
+      return;
+    case LED_BLEND_ADD:
+      src.nscale8(opacity);
+      out += src;
+      return;
+    case LED_BLEND_SCREEN:
+      src.nscale8(opacity);
+      out.r = 255 - scale8(255 - out.r, 255 - src.r);
+      out.g = 255 - scale8(255 - out.g, 255 - src.g);
+      out.b = 255 - scale8(255 - out.b, 255 - src.b);
+      return;
+    case LED_BLEND_MULTIPLY:
+      out = ::blend(out, CRGB(scale8(out.r, src.r), scale8(out.g, src.g), scale8(out.b, src.b)), opacity);
+      return;
+    case LED_BLEND_LIGHTEN:
+      src.nscale8(opacity);
+      out.r = max(out.r, src.r);
+      out.g = max(out.g, src.g);
+      out.b = max(out.b, src.b);
+      return;
+    default:
+      out = opacity == 255 ? src : ::blend(out, src, opacity);
+      return;
+  }
+}
+
+// Render the layers that are due and composite into out; false if nothing changed
+bool ledLayersRender(CRGB* out) {
+  bool changed = ledLayersDirty;
+  ledLayersDirty = false;
+  unsigned long now = millis();
+  for (uint8_t id = 0; id < LED_LAYERS; id++) {
+    LedLayer& layer = ledLayers[id];
+    if (!layer.active || now - layer.lastUpdate < layer.intervalMs) continue;
+    layer.restarted = false;
+    renderLedPattern(layer);  // May stop or restart the layer
+    if (!layer.restarted) {
+      layer.step++;
+      if (layer.step > 1000) layer.step = layer.step % 200;
+    }
+    layer.lastUpdate = now;
+    changed = true;
+  }
+  // A layer that stopped since the last composite also changes the picture
+  static uint8_t lastActive = 0;
+  uint8_t active = 0;
+  for (uint8_t id = 0; id < LED_LAYERS; id++) active |= ledLayers[id].active << id;
+  if (active != lastActive) changed = true;
+  lastActive = active;
+  if (!changed) return false;
+
+  fill_solid(out, ledLayerPixels, CRGB::Black);
+  for (uint8_t id = 0; id < LED_LAYERS; id++) {
+    const LedLayer& layer = ledLayers[id];
+    if (!layer.active || layer.opacity == 0) continue;
+    for (uint16_t i = 0; i < ledLayerPixels; i++) ledBlendPixel(out[i], layer.pixels[i], layer.blend, layer.opacity);
+  }
+  return true;
+}
+
+#endif
@@ -0,0 +1,114 @@
+/*
+ * =========================================================
+ * LED OUTPUT - DOUBLE-BUFFERED STRIP TRANSMIT OFF THE LOOP
+ * =========================================================
+ * Patterns render into the back buffer (leds[]). FastLED only
+ * knows the front buffer. ledOutputService() compares the two:
+ * an unchanged frame (LED_OFF, steady fills, a dance that has
+ * faded out) costs one memcmp and is never sent. A changed frame
+ * is copied to the front and a transmit task runs FastLED.show(),
+ * which blocks that task on the RMT peripheral while loop() runs.
+ *
+ * - A frame that is ready while the last one is still going out
+ *   stays pending and goes on a later pass (latest wins)
+ * - Brightness changes count as a new frame
+ * - Counters: frames sent, unchanged skipped, deferred, transmit us
+ *
+ * Without FreeRTOS (the host twin), show() runs inline.
+ * =========================================================
+ */
+
+#ifndef LED_OUTPUT_H
+#define LED_OUTPUT_H
+
+// Include required libraries
+#include <Arduino.h>
+#include <FastLED.h>
+#include <atomic>
+
+#define LED_TX_STACK 3072
+#define LED_TX_PRIORITY 2  // Above loop() (1): wakes at once, then sleeps on the RMT
+
+// -- LED OUTPUT STATE VARIABLES --
+CRGB* ledBack = nullptr;
+CRGB* ledFront = nullptr;
+uint16_t ledCount = 0;
+uint8_t ledShownBrightness = 0;
+bool ledFramePending = true;  // The back buffer was rendered since the last service
+std::atomic<bool> ledTxBusy{false};
+
+// Counters
+uint32_t ledFramesSent = 0;
+uint32_t ledFramesSkipped = 0;
+uint32_t ledFramesDeferred = 0;
+volatile uint32_t ledTxLastUs = 0;
+volatile uint32_t ledTxMaxUs = 0;
+
+void ledTransmit() {
+  unsigned long start = micros();
+  FastLED.show();
+  uint32_t took = micros() - start;
+  ledTxLastUs = took;
+  if (took > ledTxMaxUs) ledTxMaxUs = took;
+  ledTxBusy = false;
+}
+
+#ifdef ESP32
+TaskHandle_t ledTxTask = nullptr;
+
+void ledTxLoop(void*) {
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    ledTransmit();
+  }
+}
+#endif
+
+// back is what patterns draw on, front is the array given to FastLED.addLeds()
+void ledOutputBegin(CRGB* back, CRGB* front, uint16_t count) {
+  ledBack = back;
+  ledFront = front;
+  ledCount = count;
+#ifdef ESP32
+  // Same core as loop(): the RMT interrupt that feeds the strip stays clear of WiFi on core 0
+  xTaskCreatePinnedToCore(ledTxLoop, "led_tx", LED_TX_STACK, nullptr, LED_TX_PRIORITY, &ledTxTask,
+                          xPortGetCoreID());
+#endif
+}
+
+// Mark the back buffer as rendered; the next service decides whether it goes out
+void ledFrameReady() {
+  ledFramePending = true;
+}
+
+// Every loop pass: send the back buffer if it differs from what the strip shows
+void ledOutputService() {
+  uint8_t brightness = FastLED.getBrightness();
+  if (!ledFramePending && brightness == ledShownBrightness) return;
+  if (ledTxBusy) {
+    ledFramesDeferred++;
+    return;
+  }
+  ledFramePending = false;
+  if (brightness == ledShownBrightness && memcmp(ledBack, ledFront, ledCount * sizeof(CRGB)) == 0) {
+    ledFramesSkipped++;
+    return;
+  }
+  memcpy(ledFront, ledBack, ledCount * sizeof(CRGB));
+  ledShownBrightness = brightness;
+  ledFramesSent++;
+  ledTxBusy = true;
+#ifdef ESP32
+  xTaskNotifyGive(ledTxTask);
+#else
+  ledTransmit();
+#endif
+}
+
+// "sent,skipped,deferred,lastTxUs,maxTxUs"
+void ledOutputStats(char* out, size_t size) {
+  snprintf(out, size, "%lu,%lu,%lu,%lu,%lu", (unsigned long)ledFramesSent, (unsigned long)ledFramesSkipped,
+           (unsigned long)ledFramesDeferred, (unsigned long)ledTxLastUs, (unsigned long)ledTxMaxUs);
+}
+
+#endif
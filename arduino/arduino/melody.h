@@ -0,0 +1,167 @@
+/*
+ * =========================================================
+ * MELODY - NON-BLOCKING BUZZER TUNES FROM NOTE TABLES
+ * =========================================================
+ * Every sound is a const table of notes (frequency, length,
+ * silence after it) played from loop() one note at a time.
+ * Nothing here blocks.
+ *
+ * - Only one melody sounds at a time; the others wait in a
+ *   small queue ordered by priority, first come first served
+ * - A melody of higher priority than the one playing cuts it
+ *   off and starts at once
+ * - When the queue is full a new melody displaces the lowest
+ *   queued one below its priority, otherwise it is dropped
+ * - Note times run from the scheduled end of the last note,
+ *   so a slow loop pass does not stretch the tune
+ * - melodyTone() queues one computed note (step sounds, the
+ *   bytecode VM's tone op) the same way
+ * =========================================================
+ */
+
+#ifndef MELODY_H
+#define MELODY_H
+
+// Include required libraries
+#include <Arduino.h>
+
+// External function declarations (these will be defined in the main file)
+extern void buzzerOutput(uint16_t hz);  // 0 = silent
+
+#define MELODY_QUEUE 4
+
+// Priorities, lowest first
+enum MelodyPriority : uint8_t {
+  MELODY_PRIO_STEP,   // Per-step notes while dancing
+  MELODY_PRIO_EVENT,  // Boot, WiFi, song start, clap
+  MELODY_PRIO_ALERT   // Pause, stop, resume, errors
+};
+
+struct MelodyNote {
+  uint16_t hz;     // 0 = rest
+  uint16_t ms;
+  uint16_t gapMs;  // Silence after the note
+};
+
+struct Melody {
+  const char* name;
+  const MelodyNote* notes;
+  uint8_t count;
+  uint8_t priority;
+};
+
+#define MELODY_NOTES(table) table, sizeof(table) / sizeof(table[0])
+
+struct MelodyEntry {
+  Melody melody;
+  MelodyNote tone;  // The only note when melody.notes is null
+};
+
+// -- MELODY STATE VARIABLES --
+MelodyEntry melodyQueue[MELODY_QUEUE];
+uint8_t melodyQueued = 0;
+MelodyEntry melodyNow;
+bool melodyPlaying = false;
+uint8_t melodyNote = 0;
+bool melodyInGap = false;
+unsigned long melodyNoteAt = 0;  // Scheduled start of the current note
+uint32_t melodiesPlayed = 0;
+uint32_t melodiesDropped = 0;
+
+inline const MelodyNote& melodyCurrentNote() {
+  return melodyNow.melody.notes ? melodyNow.melody.notes[melodyNote] : melodyNow.tone;
+}
+
+void melodyStartNote() {
+  melodyInGap = false;
+  buzzerOutput(melodyCurrentNote().hz);
+}
+
+void melodyStart(const MelodyEntry& entry) {
+  melodyNow = entry;
+  melodyPlaying = true;
+  melodyNote = 0;
+  melodyNoteAt = millis();
+  melodiesPlayed++;
+  melodyStartNote();
+}
+
+bool melodyEnqueue(const MelodyEntry& entry) {
+  uint8_t priority = entry.melody.priority;
+  if (!melodyPlaying || priority > melodyNow.melody.priority) {
+    melodyStart(entry);
+    return true;
+  }
+  if (melodyQueued == MELODY_QUEUE) {
+    if (melodyQueue[MELODY_QUEUE - 1].melody.priority >= priority) {
+      melodiesDropped++;
+      return false;
+    }
+    melodyQueued--;
+    melodiesDropped++;
+  }
+  uint8_t at = melodyQueued;
+  while (at > 0 && melodyQueue[at - 1].melody.priority < priority) {
+    melodyQueue[at] = melodyQueue[at - 1];
+    at--;
+  }
+  melodyQueue[at] = entry;
+  melodyQueued++;
+  return true;
+}
+
+// Queue or play a melody; false if it was dropped
+bool melodyPlay(const Melody& melody) {
+  if (!melody.count) return false;
+  return melodyEnqueue({melody, {0, 0, 0}});
+}
+
+// Queue or play a single note
+bool melodyTone(const char* name, uint16_t hz, uint16_t ms, uint8_t priority) {
+  return melodyEnqueue({{name, nullptr, 1, priority}, {hz, ms, 0}});
+}
+
+// Silence the buzzer and forget everything queued
+void melodyStopAll() {
+  if (melodyPlaying) buzzerOutput(0);
+  melodyPlaying = false;
+  melodyQueued = 0;
+}
+
+// Every loop pass
+void melodyPoll() {
+  if (!melodyPlaying) return;
+  const MelodyNote& note = melodyCurrentNote();
+  unsigned long elapsed = millis() - melodyNoteAt;
+  if (elapsed < note.ms) return;
+
+  bool last = melodyNote + 1 == melodyNow.melody.count;
+  if (!melodyInGap && (note.gapMs || last)) {
+    buzzerOutput(0);
+    melodyInGap = true;
+  }
+  if (elapsed < (unsigned long)note.ms + note.gapMs) return;
+
+  melodyNoteAt += note.ms + note.gapMs;
+  if (millis() - melodyNoteAt > note.ms) melodyNoteAt = millis();  // Far behind: pick up from now
+  if (!last) {
+    melodyNote++;
+    melodyStartNote();
+    return;
+  }
+  melodyPlaying = false;
+  if (melodyQueued) {
+    MelodyEntry next = melodyQueue[0];
+    melodyQueued--;
+    for (uint8_t i = 0; i < melodyQueued; i++) melodyQueue[i] = melodyQueue[i + 1];
+    melodyStart(next);
+  }
+}
+
+// "playing,queued,played,dropped"
+void melodyStats(char* out, size_t size) {
+  snprintf(out, size, "%s,%u,%lu,%lu", melodyPlaying ? melodyNow.melody.name : "none", melodyQueued,
+           (unsigned long)melodiesPlayed, (unsigned long)melodiesDropped);
+}
+
+#endif
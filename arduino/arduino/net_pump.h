@@ -0,0 +1,85 @@
+/*
+ * =========================================================
+ * NET PUMP - RATE-LIMITED, TIME-BUDGETED NETWORK POLLING
+ * =========================================================
+ * The TCP/WebSocket stack is serviced from here instead of from
+ * every shouldAbort() check. A pump runs at most once per
+ * netPumpIntervalUs and keeps polling while messages arrive, up
+ * to netPumpBudgetUs, so a burst drains in one go but a busy
+ * client can't starve the control path.
+ *
+ * Pause/stop reach the robot through the callback, which sets
+ * the abort flag directly; motion code only reads that flag.
+ *
+ * - pumpNetwork() from loop() and from the few blocking loops
+ * - Counters for runs, polls, skipped calls and time spent
+ * =========================================================
+ */
+
+#ifndef NET_PUMP_H
+#define NET_PUMP_H
+
+// Include required libraries
+#include <Arduino.h>
+
+#define NET_PUMP_INTERVAL_US 1000  // Default minimum gap between pumps
+#define NET_PUMP_BUDGET_US 2000    // Default time allowed per pump
+#define NET_PUMP_MAX_INTERVAL_US 50000
+
+// External function declarations (these will be defined in the main file)
+extern void netPoll();  // One pass of the network stack
+
+// -- NET PUMP STATE VARIABLES --
+unsigned long netPumpIntervalUs = NET_PUMP_INTERVAL_US;
+unsigned long netPumpBudgetUs = NET_PUMP_BUDGET_US;
+unsigned long lastNetPump = 0;
+uint32_t netPumpEvents = 0;   // Bumped by the event handler, tells a pump to keep going
+
+// Counters
+uint32_t netPumpRuns = 0;
+uint32_t netPumpPolls = 0;
+uint32_t netPumpSkips = 0;    // Calls that came too soon after the last pump
+uint32_t netPumpLastUs = 0;
+uint32_t netPumpMaxUs = 0;
+uint64_t netPumpTotalUs = 0;
+
+bool netPumpSetInterval(long intervalUs) {
+  if (intervalUs < 0 || intervalUs > NET_PUMP_MAX_INTERVAL_US) return false;
+  netPumpIntervalUs = intervalUs;
+  Serial.print("Network pump interval (us): ");
+  Serial.println(intervalUs);
+  return true;
+}
+
+// Service the network if the interval has passed; true if it ran
+bool pumpNetwork() {
+  unsigned long start = micros();
+  if (start - lastNetPump < netPumpIntervalUs) {
+    netPumpSkips++;
+    return false;
+  }
+  lastNetPump = start;
+  netPumpRuns++;
+
+  // Keep polling while each pass delivers something and there is budget left
+  uint32_t events;
+  do {
+    events = netPumpEvents;
+    netPoll();
+    netPumpPolls++;
+  } while (netPumpEvents != events && micros() - start < netPumpBudgetUs);
+
+  netPumpLastUs = micros() - start;
+  if (netPumpLastUs > netPumpMaxUs) netPumpMaxUs = netPumpLastUs;
+  netPumpTotalUs += netPumpLastUs;
+  return true;
+}
+
+// "runs,polls,skips,avgUs,maxUs"
+void netPumpStats(char* out, size_t size) {
+  unsigned long avgUs = netPumpRuns ? (unsigned long)(netPumpTotalUs / netPumpRuns) : 0;
+  snprintf(out, size, "%lu,%lu,%lu,%lu,%lu", (unsigned long)netPumpRuns, (unsigned long)netPumpPolls,
+           (unsigned long)netPumpSkips, avgUs, (unsigned long)netPumpMaxUs);
+}
+
+#endif
@@ -0,0 +1,281 @@
+/*
+ * =========================================================
+ * PCM STREAM - WEBSOCKET AUDIO PLAYED ON THE BUZZER PIN
+ * =========================================================
+ * The browser can stream the song itself to the robot instead
+ * of playing it, so the sound and the dance run on one clock.
+ *
+ * Binary WebSocket frame:
+ *   PCM_MAGIC flags seq16 sample...
+ * Samples are 8-bit unsigned mono at PCM_SAMPLE_HZ; 20 ms
+ * (160 samples) per frame suits the WiFi stack.
+ * flags: PCM_FLAG_START flushes and starts a new stream,
+ *        PCM_FLAG_END plays out what is buffered, then stops.
+ * Frames without PCM_FLAG_START while no stream is open are
+ * late frames of a stopped stream and are dropped.
+ *
+ * pcmReceive() runs in the WebSocket callback and only copies
+ * samples; pcmPoll() in loop() starts and stops the stream and
+ * owns the timer and the pin.
+ *
+ * - Frames go into a ring buffer (the jitter buffer). Playback
+ *   starts once PCM_PREFILL_MS is buffered, so short WiFi gaps
+ *   do not reach the speaker
+ * - A hardware timer interrupt takes one sample per tick and
+ *   sets the duty of an 8-bit LEDC PWM channel on the buzzer
+ *   pin; the carrier is far above hearing, so the buzzer's own
+ *   inertia smooths it into the waveform
+ * - An empty buffer is an underrun: playback stops until the
+ *   prefill is there again, and pcmPlaybackChanged() tells the
+ *   main file so the song clock stops with it
+ * - The position is the count of samples actually played, the
+ *   clock the LED cues follow while a stream plays
+ *
+ * On the host (tools/twin) there is no timer interrupt: the
+ * samples are consumed on the sample clock from pcmPoll() but
+ * not written out.
+ * =========================================================
+ */
+
+#ifndef PCM_STREAM_H
+#define PCM_STREAM_H
+
+// Include required libraries
+#include <Arduino.h>
+
+// External function declarations (these will be defined in the main file)
+extern void pcmPlaybackChanged(bool playing, uint32_t positionSamples);
+
+#define PCM_MAGIC 0xA5          // Not RB_PROTO_MAGIC or a bytecode dance's 'R'
+#define PCM_HEADER_SIZE 4
+#define PCM_FLAG_START 0x01
+#define PCM_FLAG_END 0x02
+#define PCM_SAMPLE_HZ 8000
+#define PCM_BUFFER 8192         // Samples, a power of two: 1.02 s
+#define PCM_PREFILL_MS 250
+#define PCM_PREFILL_SAMPLES (PCM_SAMPLE_HZ / 1000 * PCM_PREFILL_MS)
+#define PCM_PWM_HZ 78125        // 8-bit LEDC carrier: 80 MHz / 256 / 4
+#define PCM_PWM_BITS 8
+#define PCM_SILENCE 128
+#define PCM_TIMEOUT_MS 2000     // No frames this long ends the stream
+
+enum PcmState : uint8_t {
+  PCM_IDLE,
+  PCM_BUFFERING,  // Waiting for the prefill, at the start or after an underrun
+  PCM_PLAYING,
+  PCM_PAUSED
+};
+const char* PCM_STATE_NAMES[] = {"idle", "buffering", "playing", "paused"};
+
+// -- PCM STREAM STATE VARIABLES --
+uint8_t pcmBuffer[PCM_BUFFER];
+volatile uint32_t pcmWritten = 0;  // Free-running; only the receiver moves it
+volatile uint32_t pcmRead = 0;     // Free-running; only the timer tick moves it
+volatile bool pcmOutputOn = false;
+volatile bool pcmStarved = false;  // The tick found the buffer empty
+uint8_t pcmState = PCM_IDLE;
+uint8_t pcmPin = 0;
+bool pcmEnding = false;            // PCM_FLAG_END seen
+bool pcmStartPending = false;      // A PCM_FLAG_START frame came in; pcmPoll() starts the stream
+uint32_t pcmStartAt = 0;           // pcmWritten at its first sample
+uint32_t pcmStreamStart = 0;       // pcmRead at the first sample of the stream
+uint16_t pcmNextSeq = 0;
+unsigned long pcmLastFrameAt = 0;
+
+// Counters
+uint32_t pcmFrames = 0;
+uint32_t pcmUnderruns = 0;
+uint32_t pcmOverflows = 0;         // Samples dropped on a full buffer
+uint32_t pcmLost = 0;              // Frames missing from the sequence
+
+inline uint32_t pcmBuffered() {
+  return pcmWritten - pcmRead;
+}
+
+inline bool pcmActive() {
+  return pcmState != PCM_IDLE;
+}
+
+// Samples played since the stream started
+inline uint32_t pcmPosition() {
+  return pcmRead - pcmStreamStart;
+}
+
+// One sample per tick; an empty buffer holds the output at the midpoint
+inline void pcmTickSample(uint8_t& sample) {
+  sample = PCM_SILENCE;
+  if (!pcmOutputOn) return;
+  uint32_t read = pcmRead;
+  if (read == pcmWritten) {
+    pcmStarved = true;
+    return;
+  }
+  sample = pcmBuffer[read & (PCM_BUFFER - 1)];
+  pcmRead = read + 1;
+}
+
+#ifdef ESP32
+hw_timer_t* pcmTimer = nullptr;
+
+void IRAM_ATTR pcmTick() {
+  uint8_t sample;
+  pcmTickSample(sample);
+  ledcWrite(pcmPin, sample);
+}
+
+// Take the pin from tone() and start the sample clock
+void pcmOutputBegin() {
+  ledcAttach(pcmPin, PCM_PWM_HZ, PCM_PWM_BITS);
+  ledcWrite(pcmPin, PCM_SILENCE);
+  pcmTimer = timerBegin(1000000);
+  timerAttachInterrupt(pcmTimer, &pcmTick);
+  timerAlarm(pcmTimer, 1000000 / PCM_SAMPLE_HZ, true, 0);
+}
+
+// Hand the pin back; tone() attaches it again on its next note
+void pcmOutputEnd() {
+  if (pcmTimer) timerEnd(pcmTimer);
+  pcmTimer = nullptr;
+  ledcDetach(pcmPin);
+  digitalWrite(pcmPin, LOW);
+}
+
+void pcmClock() {}
+#else
+unsigned long pcmNextTickUs = 0;
+
+void pcmOutputBegin() {
+  pcmNextTickUs = micros();
+}
+
+void pcmOutputEnd() {}
+
+// Catch up on the ticks the timer interrupt would have run
+void pcmClock() {
+  unsigned long now = micros();
+  uint32_t ticks = 0;
+  while ((long)(now - pcmNextTickUs) >= 0 && ticks < PCM_BUFFER) {
+    uint8_t sample;
+    pcmTickSample(sample);
+    pcmNextTickUs += 1000000UL / PCM_SAMPLE_HZ;
+    ticks++;
+  }
+  if (ticks == PCM_BUFFER) pcmNextTickUs = now;
+}
+#endif
+
+void pcmBegin(uint8_t pin) {
+  pcmPin = pin;
+}
+
+void pcmSetPlaying(bool playing) {
+  if (pcmOutputOn == playing) return;
+  pcmStarved = false;
+  pcmOutputOn = playing;
+  pcmPlaybackChanged(playing, pcmPosition());
+}
+
+// Drop the stream (and one about to start) and free the pin
+void pcmStop() {
+  pcmStartPending = false;
+  if (pcmState == PCM_IDLE) return;
+  pcmSetPlaying(false);
+  pcmOutputEnd();
+  pcmState = PCM_IDLE;
+  pcmRead = pcmWritten;
+  Serial.println("PCM stream ended");
+}
+
+// Pause keeps the buffer; frames that arrive meanwhile fill it up
+void pcmPause() {
+  if (pcmState == PCM_IDLE) return;
+  pcmSetPlaying(false);
+  pcmState = PCM_PAUSED;
+}
+
+void pcmResume() {
+  if (pcmState == PCM_PAUSED) pcmState = PCM_BUFFERING;
+}
+
+// A PCM_MAGIC frame from the WebSocket; false if malformed
+bool pcmReceive(const uint8_t* frame, size_t length) {
+  if (length < PCM_HEADER_SIZE || frame[0] != PCM_MAGIC) return false;
+  uint8_t flags = frame[1];
+  uint16_t seq = frame[2] | frame[3] << 8;
+
+  if (flags & PCM_FLAG_START) {
+    pcmStartPending = true;
+    pcmStartAt = pcmWritten;
+    pcmEnding = false;
+    pcmNextSeq = seq;
+  } else if (pcmState == PCM_IDLE && !pcmStartPending) {
+    return true;  // Late frame of a stream that was stopped
+  }
+  if (seq != pcmNextSeq) pcmLost += (uint16_t)(seq - pcmNextSeq);
+  pcmNextSeq = seq + 1;
+  pcmFrames++;
+  pcmLastFrameAt = millis();
+  if (flags & PCM_FLAG_END) pcmEnding = true;
+
+  // Copy what fits; the tick only reads below pcmWritten, so publish it last
+  size_t count = length - PCM_HEADER_SIZE;
+  uint32_t space = PCM_BUFFER - pcmBuffered();
+  if (count > space) {
+    pcmOverflows += count - space;
+    count = space;
+  }
+  uint32_t at = pcmWritten;
+  for (size_t i = 0; i < count; i++) pcmBuffer[(at + i) & (PCM_BUFFER - 1)] = frame[PCM_HEADER_SIZE + i];
+  pcmWritten = at + count;
+  return true;
+}
+
+// Drop what is left of the old stream and start the new one at pcmStartAt
+void pcmStartStream() {
+  pcmStartPending = false;
+  pcmStop();
+  noTone(pcmPin);
+  pcmRead = pcmStartAt;
+  pcmOutputBegin();
+  pcmState = PCM_BUFFERING;
+  pcmStreamStart = pcmRead;
+  Serial.println("PCM stream started");
+}
+
+// Every loop pass: start a stream, play after the prefill, stop on an underrun, end the stream
+void pcmPoll() {
+  if (pcmStartPending) pcmStartStream();
+  if (pcmState == PCM_IDLE) return;
+  pcmClock();
+  switch (pcmState) {
+    case PCM_BUFFERING:
+      if (pcmBuffered() >= PCM_PREFILL_SAMPLES || (pcmEnding && pcmBuffered() > 0)) {
+        pcmState = PCM_PLAYING;
+        pcmSetPlaying(true);
+      }
+      break;
+    case PCM_PLAYING:
+      if (!pcmStarved) break;
+      if (pcmEnding) {
+        pcmStop();
+        return;
+      }
+      pcmUnderruns++;
+      pcmState = PCM_BUFFERING;
+      pcmSetPlaying(false);
+      break;
+  }
+  if (pcmState != PCM_PLAYING && pcmBuffered() == 0 && (pcmEnding || millis() - pcmLastFrameAt > PCM_TIMEOUT_MS)) {
+    pcmStop();
+  }
+}
+
+// "state,bufferedMs,positionMs,frames,underruns,overflows,lost"
+void pcmStats(char* out, size_t size) {
+  snprintf(out, size, "%s,%lu,%lu,%lu,%lu,%lu,%lu", PCM_STATE_NAMES[pcmState],
+           (unsigned long)(pcmBuffered() * 1000 / PCM_SAMPLE_HZ),
+           (unsigned long)((uint64_t)pcmPosition() * 1000 / PCM_SAMPLE_HZ), (unsigned long)pcmFrames,
+           (unsigned long)pcmUnderruns, (unsigned long)pcmOverflows, (unsigned long)pcmLost);
+}
+
+#endif
@@ -0,0 +1,226 @@
+/*
+ * =========================================================
+ * PIXEL STREAM - DDP / E1.31 (sACN) UDP RECEIVER
+ * =========================================================
+ * A lighting desk or PC renders the show and sends raw RGB over
+ * UDP. The payload is copied straight into the base LED layer.
+ * Alerts and the clap still show on top of it, and the local
+ * pattern comes back once the stream stops.
+ *
+ * DDP (port 4048): 10-byte header (14 with timecode), byte
+ *   offset and length, frame shown on the packet with PUSH set
+ * E1.31 (port 5568, unicast): 510 channels = 170 pixels per
+ *   universe from PIXEL_STREAM_UNIVERSE up; the frame is shown
+ *   when the strip's last universe arrives
+ *
+ * - Sequence numbers: gaps count as dropped, packets older than
+ *   the last one (or repeated) count as late and are discarded
+ * - No valid frame for PIXEL_STREAM_TIMEOUT_MS (the E1.31 data
+ *   loss time) or an E1.31 stream-terminated flag ends the stream
+ * - At most PIXEL_STREAM_MAX_PACKETS read per loop pass
+ * =========================================================
+ */
+
+#ifndef PIXEL_STREAM_H
+#define PIXEL_STREAM_H
+
+// Include required libraries
+#include <Arduino.h>
+#include <FastLED.h>
+#include <WiFiUdp.h>
+#include "led_layers.h"
+
+#define DDP_PORT 4048
+#define E131_PORT 5568
+#define PIXEL_STREAM_UNIVERSE 1         // First E1.31 universe of the strip
+#define PIXEL_STREAM_MAX_UNIVERSES 16   // 2720 pixels
+#define PIXEL_STREAM_TIMEOUT_MS 2500
+#define PIXEL_STREAM_MAX_PACKETS 8
+#define PIXEL_STREAM_PACKET_MAX 1472    // Largest UDP payload without IP fragmentation
+
+#define DDP_FLAG_VERSION_MASK 0xC0
+#define DDP_FLAG_VERSION_1 0x40
+#define DDP_FLAG_TIMECODE 0x10
+#define DDP_FLAG_QUERY 0x02
+#define DDP_FLAG_PUSH 0x01
+#define DDP_HEADER 10
+
+#define E131_HEADER 126
+#define E131_CHANNELS_PER_UNIVERSE 510
+#define E131_OPTION_TERMINATED 0x40
+#define E131_OPTION_PREVIEW 0x80
+
+// External function declarations (these will be defined in the main file)
+extern void pixelStreamStarted();
+extern void pixelStreamEnded();
+
+enum PixelStreamSource : uint8_t {
+  STREAM_NONE,
+  STREAM_DDP,
+  STREAM_E131
+};
+
+// -- PIXEL STREAM STATE VARIABLES --
+WiFiUDP ddpUdp;
+WiFiUDP e131Udp;
+uint8_t* streamFrame = nullptr;  // RGB bytes, CRGB layout
+uint32_t streamFrameBytes = 0;
+uint8_t streamUniverses = 0;
+uint8_t streamSource = STREAM_NONE;
+unsigned long streamLastFrameMs = 0;
+uint8_t ddpLastSeq = 0;
+bool e131SeqValid[PIXEL_STREAM_MAX_UNIVERSES];
+uint8_t e131LastSeq[PIXEL_STREAM_MAX_UNIVERSES];
+uint8_t streamPacket[PIXEL_STREAM_PACKET_MAX];
+
+// Counters
+uint32_t streamFrames = 0;
+uint32_t streamPackets = 0;
+uint32_t streamDropped = 0;
+uint32_t streamLate = 0;
+uint32_t streamInvalid = 0;
+uint32_t streamTimeouts = 0;
+
+void pixelStreamBegin(CRGB* frame, uint16_t count) {
+  streamFrame = (uint8_t*)frame;
+  streamFrameBytes = (uint32_t)count * 3;
+  streamUniverses = min((count + 169) / 170, PIXEL_STREAM_MAX_UNIVERSES);
+  ddpUdp.begin(DDP_PORT);
+  e131Udp.begin(E131_PORT);
+}
+
+bool pixelStreamActive() {
+  return streamSource != STREAM_NONE;
+}
+
+void pixelStreamStop() {
+  if (streamSource == STREAM_NONE) return;
+  streamSource = STREAM_NONE;
+  ddpLastSeq = 0;
+  memset(e131SeqValid, 0, sizeof(e131SeqValid));
+  pixelStreamEnded();
+}
+
+// The first valid packet takes the base layer; a second protocol waits its turn
+bool pixelStreamClaim(uint8_t source) {
+  if (streamSource == source) return true;
+  if (streamSource != STREAM_NONE) return false;
+  streamSource = source;
+  streamLastFrameMs = millis();
+  pixelStreamStarted();
+  return true;
+}
+
+void pixelStreamFrameDone() {
+  streamFrames++;
+  streamLastFrameMs = millis();
+  ledLayerInvalidate();
+}
+
+// Sequence numbers run 1..15, then 1 again; 0 = unused. A step back or a repeat is late
+bool ddpSequenceOk(uint8_t seq) {
+  if (seq == 0) return true;
+  if (ddpLastSeq != 0) {
+    uint8_t ahead = (seq + 15 - ddpLastSeq) % 15;
+    if (ahead == 0 || ahead >= 8) {
+      streamLate++;
+      return false;
+    }
+    streamDropped += ahead - 1;
+  }
+  ddpLastSeq = seq;
+  return true;
+}
+
+void ddpHandle(const uint8_t* p, int len) {
+  if (len < DDP_HEADER || (p[0] & DDP_FLAG_VERSION_MASK) != DDP_FLAG_VERSION_1 || (p[0] & DDP_FLAG_QUERY)) {
+    streamInvalid++;
+    return;
+  }
+  uint8_t header = (p[0] & DDP_FLAG_TIMECODE) ? DDP_HEADER + 4 : DDP_HEADER;
+  uint32_t offset = (uint32_t)p[4] << 24 | (uint32_t)p[5] << 16 | (uint32_t)p[6] << 8 | p[7];
+  uint16_t dataLen = (uint16_t)p[8] << 8 | p[9];
+  if (len < header + dataLen) {
+    streamInvalid++;
+    return;
+  }
+  if (!ddpSequenceOk(p[1] & 0x0F) || !pixelStreamClaim(STREAM_DDP)) return;
+
+  // Pixels past the strip are ignored, not an error: desks often send whole universes
+  if (offset < streamFrameBytes) {
+    memcpy(streamFrame + offset, p + header, min((uint32_t)dataLen, streamFrameBytes - offset));
+  }
+  if (p[0] & DDP_FLAG_PUSH) pixelStreamFrameDone();
+}
+
+void e131Handle(const uint8_t* p, int len) {
+  static const uint8_t ACN_ID[12] = {'A', 'S', 'C', '-', 'E', '1', '.', '1', '7', 0, 0, 0};
+  if (len < E131_HEADER || memcmp(p + 4, ACN_ID, sizeof(ACN_ID)) != 0 || p[21] != 0x04 || p[43] != 0x02 ||
+      p[117] != 0x02 || p[125] != 0x00) {
+    streamInvalid++;  // Not sACN data, or a non-zero start code (sync, discovery, per-address priority)
+    return;
+  }
+  if (p[112] & E131_OPTION_PREVIEW) return;
+  uint16_t universe = (uint16_t)p[113] << 8 | p[114];
+  if (universe < PIXEL_STREAM_UNIVERSE || universe >= PIXEL_STREAM_UNIVERSE + streamUniverses) return;
+  uint8_t u = universe - PIXEL_STREAM_UNIVERSE;
+
+  // E1.31 6.7.2: a packet 1-20 behind the last one is out of order
+  uint8_t seq = p[111];
+  if (e131SeqValid[u]) {
+    int8_t ahead = (int8_t)(seq - e131LastSeq[u]);
+    if (ahead <= 0 && ahead > -20) {
+      streamLate++;
+      return;
+    }
+    if (ahead > 1) streamDropped += ahead - 1;
+  }
+  e131SeqValid[u] = true;
+  e131LastSeq[u] = seq;
+
+  if (p[112] & E131_OPTION_TERMINATED) {
+    if (streamSource == STREAM_E131) pixelStreamStop();
+    return;
+  }
+  if (!pixelStreamClaim(STREAM_E131)) return;
+
+  uint16_t channels = ((uint16_t)p[123] << 8 | p[124]) - 1;  // Property count includes the start code
+  channels = min(channels, (uint16_t)min(len - E131_HEADER, E131_CHANNELS_PER_UNIVERSE));
+  uint32_t offset = (uint32_t)u * E131_CHANNELS_PER_UNIVERSE;
+  if (offset < streamFrameBytes) {
+    memcpy(streamFrame + offset, p + E131_HEADER, min((uint32_t)channels, streamFrameBytes - offset));
+  }
+  if (u == streamUniverses - 1) pixelStreamFrameDone();
+}
+
+// Once per loop pass: read what has arrived, end the stream when it goes quiet
+void pixelStreamPoll() {
+  for (uint8_t i = 0; i < PIXEL_STREAM_MAX_PACKETS; i++) {
+    int len = ddpUdp.parsePacket();
+    if (len <= 0) break;
+    len = ddpUdp.read(streamPacket, sizeof(streamPacket));
+    streamPackets++;
+    ddpHandle(streamPacket, len);
+  }
+  for (uint8_t i = 0; i < PIXEL_STREAM_MAX_PACKETS; i++) {
+    int len = e131Udp.parsePacket();
+    if (len <= 0) break;
+    len = e131Udp.read(streamPacket, sizeof(streamPacket));
+    streamPackets++;
+    e131Handle(streamPacket, len);
+  }
+  if (streamSource != STREAM_NONE && millis() - streamLastFrameMs > PIXEL_STREAM_TIMEOUT_MS) {
+    streamTimeouts++;
+    pixelStreamStop();
+  }
+}
+
+// "source,frames,packets,dropped,late,invalid,timeouts"
+void pixelStreamStats(char* out, size_t size) {
+  const char* sources[] = {"none", "ddp", "e131"};
+  snprintf(out, size, "%s,%lu,%lu,%lu,%lu,%lu,%lu", sources[streamSource], (unsigned long)streamFrames,
+           (unsigned long)streamPackets, (unsigned long)streamDropped, (unsigned long)streamLate,
+           (unsigned long)streamInvalid, (unsigned long)streamTimeouts);
+}
+
+#endif
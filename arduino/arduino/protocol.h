@@ -0,0 +1,207 @@
+/*
+ * =========================================================
+ * PROTOCOL - VERSIONED BINARY CONTROL PROTOCOL
+ * =========================================================
+ * Binary WebSocket frames that run alongside the text commands.
+ * (PCM audio frames, pcm_stream.h, carry their own magic.)
+ * One frame carries any number of commands; the robot answers
+ * each frame with one ACK carrying the frame's sequence number.
+ *
+ * Client -> robot frame (little-endian):
+ *   RB_PROTO_MAGIC version seq16 command...
+ * Each command is an opcode byte plus fixed-width fields; SONG
+ * is the only one with a length-prefixed name.
+ *
+ * Robot -> client frames:
+ *   RB_PROTO_MAGIC version RB_MSG_HELLO caps32 maxFrame16
+ *   RB_PROTO_MAGIC version RB_MSG_ACK seq16 executed status
+ *   RB_PROTO_MAGIC version RB_MSG_PONG id32 received64 sent64
+ *   RB_PROTO_MAGIC version RB_MSG_TELEMETRY seq16 snapshot (telemetry.h)
+ *
+ * HELLO is sent on connect and in answer to RB_OP_HELLO, so the
+ * client can check the version and capabilities before batching.
+ * Commands run in order; the first rejected one ends the frame
+ * and the ACK says how many ran.
+ *
+ * Clock sync (NTP style): the client sends PING id and notes its
+ * send/receive times; PONG returns the robot's receive and send
+ * times in esp_timer microseconds, which gives offset and RTT.
+ * AT t64 makes the next command in the frame wait for robot
+ * time t (see scheduler.h).
+ * =========================================================
+ */
+
+#ifndef PROTOCOL_H
+#define PROTOCOL_H
+
+// Include required libraries
+#include <Arduino.h>
+
+#define RB_PROTO_MAGIC 0xB1  // Bytecode dances start with 'R', so the two never collide
+#define RB_PROTO_VERSION 1
+#define RB_HEADER_SIZE 4
+#define RB_MAX_FRAME 256
+#define RB_SONG_NAME_MAX 40
+
+// Capability bits in HELLO
+#define RB_CAP_BATCH 0x0001
+#define RB_CAP_BYTECODE 0x0002  // choreo_vm.h uploads
+#define RB_CAP_CPG 0x0004       // tempo/energy procedural dancing
+#define RB_CAP_CLOCK 0x0008     // PING/PONG and AT scheduling
+#define RB_CAP_TELEMETRY 0x0010 // Subscribable snapshot stream
+#define RB_CAP_STEP_QUEUE 0x0020 // Steps queue behind the playing one
+#define RB_CAP_PCM 0x0040       // PCM audio frames (pcm_stream.h)
+
+#define RB_CAPS (RB_CAP_BATCH | RB_CAP_BYTECODE | RB_CAP_CPG | RB_CAP_CLOCK | RB_CAP_TELEMETRY | \
+                 RB_CAP_STEP_QUEUE | RB_CAP_PCM)
+
+// Client -> robot opcodes
+enum RbOpcode : uint8_t {
+  RB_OP_HELLO = 0x01,       // u8 client version
+  RB_OP_PAUSE = 0x02,
+  RB_OP_STOP = 0x03,
+  RB_OP_RESUME = 0x04,
+  RB_OP_STEP = 0x05,        // u8 step
+  RB_OP_SONG = 0x06,        // u8 length, name
+  RB_OP_SPEED = 0x07,       // u8 speed
+  RB_OP_LED = 0x08,         // u8 pattern
+  RB_OP_BRIGHTNESS = 0x09,  // u8 brightness
+  RB_OP_TEMPO = 0x0A,       // u8 bpm
+  RB_OP_ENERGY = 0x0B,      // u8 energy
+  RB_OP_PING = 0x0C,        // u32 id
+  RB_OP_AT = 0x0D,          // u64 robot time (us) for the next command
+  RB_OP_TELEMETRY = 0x0E,   // u8 snapshots per second, 0 = off
+  RB_OP_STEP_DEPTH = 0x0F,  // u8 step queue depth
+  RB_OP_STEP_POLICY = 0x10, // u8 StepqPolicy when the step queue is full
+
+  // Internal, only queued by the robot itself (never valid on the wire)
+  RB_OP_RUN_BYTECODE = 0x70,  // Load the program vmStage() accepted and start it
+  RB_OP_ERROR_SOUND = 0x71,   // Error beep for a command rejected in the callback
+  RB_OP_APPLY_SETTERS = 0x72, // Apply coalesced setters before the commands queued after them
+  RB_OP_SHOW = 0x73           // u8 ShowAction: show: commands that touch the robot or the log file
+};
+
+// Robot -> client message types
+enum RbMessage : uint8_t {
+  RB_MSG_HELLO = 0x81,
+  RB_MSG_ACK = 0x82,
+  RB_MSG_PONG = 0x83,
+  RB_MSG_TELEMETRY = 0x84
+};
+
+enum RbStatus : uint8_t {
+  RB_STATUS_OK,
+  RB_STATUS_BAD_VERSION,
+  RB_STATUS_MALFORMED,  // Unknown opcode or frame ends mid-command
+  RB_STATUS_REJECTED,   // Command out of range
+  RB_STATUS_QUEUE_FULL, // No room in the command or AT queue; nothing in the frame ran
+  RB_STATUS_CANCELLED   // Dropped by a later pause/stop before it ran
+};
+
+// One decoded command, from either protocol; text points into the frame
+struct RbCommand {
+  uint8_t op;
+  int32_t value;
+  uint64_t time;  // RB_OP_AT only
+  const char* text;
+  uint8_t textLen;
+};
+
+// Fixed field bytes after the opcode, -1 if unknown
+int rbFieldBytes(uint8_t op) {
+  switch (op) {
+    case RB_OP_PAUSE: case RB_OP_STOP: case RB_OP_RESUME: return 0;
+    case RB_OP_HELLO: case RB_OP_STEP: case RB_OP_SONG: case RB_OP_SPEED:
+    case RB_OP_LED: case RB_OP_BRIGHTNESS: case RB_OP_TEMPO: case RB_OP_ENERGY:
+    case RB_OP_TELEMETRY: case RB_OP_STEP_DEPTH: case RB_OP_STEP_POLICY: return 1;
+    case RB_OP_PING: return 4;
+    case RB_OP_AT: return 8;
+    default: return -1;
+  }
+}
+
+// Decode the command at p and advance past it; false if malformed
+bool rbDecodeCommand(const uint8_t*& p, const uint8_t* end, RbCommand& cmd) {
+  int fields = rbFieldBytes(*p);
+  if (fields < 0 || end - p < 1 + fields) return false;
+  cmd.op = *p++;
+  uint64_t field = 0;
+  for (int i = 0; i < fields; i++) field |= (uint64_t)*p++ << (8 * i);
+  cmd.value = (int32_t)field;
+  cmd.time = field;
+  cmd.text = nullptr;
+  cmd.textLen = 0;
+  if (cmd.op == RB_OP_SONG) {
+    if (end - p < cmd.value || cmd.value > RB_SONG_NAME_MAX) return false;
+    cmd.text = (const char*)p;
+    cmd.textLen = cmd.value;
+    p += cmd.value;
+  }
+  return true;
+}
+
+// Inverse of rbDecodeCommand; out needs 1 + 8 + RB_SONG_NAME_MAX bytes at most
+size_t rbEncodeCommand(uint8_t* out, const RbCommand& cmd) {
+  int fields = rbFieldBytes(cmd.op);
+  if (fields < 0) return 0;
+  uint64_t field = cmd.op == RB_OP_AT ? cmd.time : (uint32_t)cmd.value;
+  uint8_t textLen = min(cmd.textLen, (uint8_t)RB_SONG_NAME_MAX);
+  if (cmd.op == RB_OP_SONG) field = textLen;
+  out[0] = cmd.op;
+  for (int i = 0; i < fields; i++) out[1 + i] = (field >> (8 * i)) & 0xFF;
+  size_t used = 1 + fields;
+  if (cmd.op == RB_OP_SONG) {
+    memcpy(out + used, cmd.text, textLen);
+    used += textLen;
+  }
+  return used;
+}
+
+size_t rbWriteHello(uint8_t* out) {
+  out[0] = RB_PROTO_MAGIC;
+  out[1] = RB_PROTO_VERSION;
+  out[2] = RB_MSG_HELLO;
+  out[3] = RB_CAPS & 0xFF;
+  out[4] = (RB_CAPS >> 8) & 0xFF;
+  out[5] = (RB_CAPS >> 16) & 0xFF;
+  out[6] = (RB_CAPS >> 24) & 0xFF;
+  out[7] = RB_MAX_FRAME & 0xFF;
+  out[8] = RB_MAX_FRAME >> 8;
+  return 9;
+}
+
+size_t rbWriteAck(uint8_t* out, uint16_t seq, uint8_t executed, uint8_t status) {
+  out[0] = RB_PROTO_MAGIC;
+  out[1] = RB_PROTO_VERSION;
+  out[2] = RB_MSG_ACK;
+  out[3] = seq & 0xFF;
+  out[4] = seq >> 8;
+  out[5] = executed;
+  out[6] = status;
+  return 7;
+}
+
+void rbWriteU16(uint8_t* out, uint16_t value) {
+  out[0] = value & 0xFF;
+  out[1] = value >> 8;
+}
+
+void rbWriteU32(uint8_t* out, uint32_t value) {
+  for (int i = 0; i < 4; i++) out[i] = (value >> (8 * i)) & 0xFF;
+}
+
+void rbWriteU64(uint8_t* out, uint64_t value) {
+  for (int i = 0; i < 8; i++) out[i] = (value >> (8 * i)) & 0xFF;
+}
+
+size_t rbWritePong(uint8_t* out, uint32_t id, uint64_t receivedUs, uint64_t sentUs) {
+  out[0] = RB_PROTO_MAGIC;
+  out[1] = RB_PROTO_VERSION;
+  out[2] = RB_MSG_PONG;
+  rbWriteU32(out + 3, id);
+  rbWriteU64(out + 7, receivedUs);
+  rbWriteU64(out + 15, sentUs);
+  return 23;
+}
+
+#endif
@@ -0,0 +1,80 @@
+/*
+ * =========================================================
+ * SCHEDULER - TIMESTAMPED COMMAND QUEUE
+ * =========================================================
+ * Commands that carry an execute-at time (RB_OP_AT) wait here
+ * until the robot's microsecond clock reaches it, then fire on
+ * the next control tick. The client maps its own clock onto
+ * ours with PING/PONG, so it can send moves a few hundred ms
+ * ahead and have them land on the beat regardless of WiFi jitter.
+ *
+ * - Fixed-size queue kept sorted by time, no allocation
+ * - Song names are copied in, so a song start can wait too
+ * - Commands already due fire straight away (lateness is tracked)
+ * - Pause and stop clear the queue
+ * =========================================================
+ */
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+// Include required libraries
+#include <Arduino.h>
+#include <esp_timer.h>
+#include "protocol.h"
+
+#define SCHED_QUEUE_SIZE 16
+
+struct ScheduledCommand {
+  uint64_t at;  // esp_timer_get_time() microseconds
+  RbCommand cmd;
+  char text[RB_SONG_NAME_MAX];  // cmd.text is pointed at schedDueText when it fires
+};
+
+ScheduledCommand schedQueue[SCHED_QUEUE_SIZE];
+uint8_t schedCount = 0;
+int64_t schedLastLateUs = 0;  // How late the last command fired
+int64_t schedMaxLateUs = 0;
+char schedDueText[RB_SONG_NAME_MAX];  // Text of the command nextDueCommand() returned
+
+// Robot clock shared with the client
+inline uint64_t robotClockUs() {
+  return (uint64_t)esp_timer_get_time();
+}
+
+// Insert in time order; false if the queue is full
+bool scheduleCommand(const RbCommand& cmd, uint64_t at) {
+  if (schedCount >= SCHED_QUEUE_SIZE) return false;
+  int i = schedCount;
+  while (i > 0 && schedQueue[i - 1].at > at) {
+    schedQueue[i] = schedQueue[i - 1];
+    i--;
+  }
+  ScheduledCommand& slot = schedQueue[i];
+  slot.at = at;
+  slot.cmd = cmd;
+  slot.cmd.textLen = cmd.text ? min((size_t)cmd.textLen, sizeof(slot.text)) : 0;
+  if (slot.cmd.textLen) memcpy(slot.text, cmd.text, slot.cmd.textLen);
+  slot.cmd.text = nullptr;
+  schedCount++;
+  return true;
+}
+
+// Take the earliest command if it is due
+bool nextDueCommand(uint64_t now, RbCommand& cmd) {
+  if (schedCount == 0 || schedQueue[0].at > now) return false;
+  cmd = schedQueue[0].cmd;
+  memcpy(schedDueText, schedQueue[0].text, cmd.textLen);
+  cmd.text = schedDueText;
+  schedLastLateUs = (int64_t)(now - schedQueue[0].at);
+  if (schedLastLateUs > schedMaxLateUs) schedMaxLateUs = schedLastLateUs;
+  schedCount--;
+  memmove(&schedQueue[0], &schedQueue[1], schedCount * sizeof(ScheduledCommand));
+  return true;
+}
+
+void clearScheduledCommands() {
+  schedCount = 0;
+}
+
+#endif
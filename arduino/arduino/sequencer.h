@@ -0,0 +1,321 @@
+/*
+ * =========================================================
+ * SEQUENCER - PRIORITISED NON-BLOCKING SEQUENCE RUNNER
+ * =========================================================
+ * Every timed behaviour (boot, WiFi celebration, dance steps,
+ * procedural dancing, bytecode dances, clap reaction) is a const table of
+ * SeqStep ops advanced from loop(). Nothing here blocks.
+ *
+ * - One slot per priority; only the highest occupied slot runs
+ * - Starting a higher priority suspends the running slot: its
+ *   clock stops and its servo pose is remembered
+ * - When the higher slot ends, the suspended one glides back to
+ *   that pose and carries on where it left off
+ * - Any slot can be cancelled; pause/stop cancel them all
+ * =========================================================
+ */
+
+#ifndef SEQUENCER_H
+#define SEQUENCER_H
+
+// Include required libraries
+#include <Arduino.h>
+#include "keyframes.h"
+#include "cpg.h"
+#include "choreo_vm.h"
+
+// External function declarations (these will be defined in the main file)
+extern void pwmWriteAngle(uint8_t ch, float angle);
+extern bool startDanceTrack();  // false when there is no track to wait for
+extern int servoHome[12];
+extern int currentServoAngles[12];
+
+#define SEQ_SERVOS 12
+#define SEQ_RESTORE_MS 300  // Glide back to a suspended sequence's pose
+
+// Priorities, lowest first
+enum SeqPriority {
+  SEQ_PRIO_AMBIENT,  // WiFi celebration
+  SEQ_PRIO_DANCE,    // Dance steps, procedural dancing, bytecode dances
+  SEQ_PRIO_CLAP,     // Clap reaction
+  SEQ_PRIO_SYSTEM,   // Boot
+  SEQ_PRIORITIES
+};
+
+enum SeqOp : uint8_t {
+  SEQ_END,
+  SEQ_MOVE,   // Glide channel to value over ms (0 = instant), don't wait
+  SEQ_SYNC,   // Wait until all glides have arrived
+  SEQ_WAIT,   // Wait ms
+  SEQ_CALL,   // Run call()
+  SEQ_TRACK,  // Play the current song's keyframe track for the current step
+  SEQ_CPG,    // Run the oscillator engine until cancelled
+  SEQ_VM,     // Run the uploaded bytecode program until it ends
+  SEQ_HOME,   // Glide everything home over ms and wait, unless a suspended sequence takes over
+  SEQ_JUMP_IF, // Go to step value if test() returns true
+  SEQ_AWAIT   // Wait until test() returns true, at most ms
+};
+
+// Tables list only the fields a step uses; the rest default here
+struct SeqStep {
+  SeqOp op;
+  uint8_t channel = 0;
+  int16_t value = 0;
+  uint16_t ms = 0;
+  void (*call)() = nullptr;
+  bool (*test)() = nullptr;
+};
+
+struct SeqSlot {
+  const SeqStep* steps;
+  const char* name;
+  uint8_t pc;
+  bool running;
+  bool entered;     // Current op has done its start action
+  bool suspended;
+  bool restoring;
+  bool movedServos;  // Only sequences that moved servos restore their pose
+  unsigned long opStart;
+  unsigned long suspendedAt;
+  uint8_t pose[SEQ_SERVOS];
+};
+
+struct ServoGlide {
+  uint8_t from;
+  uint8_t to;
+  uint16_t duration;
+  unsigned long start;
+  bool active;
+};
+
+SeqSlot seqSlots[SEQ_PRIORITIES];
+ServoGlide servoGlides[SEQ_SERVOS];
+int seqCurrent = -1;  // Slot that ran last
+
+// === SERVO GLIDES ===
+void glideServo(uint8_t ch, int angle, uint16_t durationMs) {
+  if (ch >= SEQ_SERVOS) return;
+  angle = constrain(angle, 0, 180);
+  if (durationMs == 0) {
+    servoGlides[ch].active = false;
+    pwmWriteAngle(ch, angle);
+    return;
+  }
+  servoGlides[ch] = {(uint8_t)currentServoAngles[ch], (uint8_t)angle, durationMs, millis(), true};
+}
+
+bool glidesActive() {
+  for (int ch = 0; ch < SEQ_SERVOS; ch++) {
+    if (servoGlides[ch].active) return true;
+  }
+  return false;
+}
+
+void cancelGlides() {
+  for (int ch = 0; ch < SEQ_SERVOS; ch++) servoGlides[ch].active = false;
+}
+
+void updateGlides() {
+  for (int ch = 0; ch < SEQ_SERVOS; ch++) {
+    ServoGlide& g = servoGlides[ch];
+    if (!g.active) continue;
+    unsigned long elapsed = millis() - g.start;
+    int angle = g.to;
+    if (elapsed < g.duration) {
+      angle = g.from + ((int)g.to - g.from) * (int32_t)elapsed / g.duration;
+    } else {
+      g.active = false;
+    }
+    if (angle != currentServoAngles[ch]) pwmWriteAngle(ch, angle);
+  }
+}
+
+// === SEQUENCE CONTROL ===
+bool seqRunning(int prio) {
+  return seqSlots[prio].running;
+}
+
+int seqTopSlot() {
+  for (int p = SEQ_PRIORITIES - 1; p >= 0; p--) {
+    if (seqSlots[p].running) return p;
+  }
+  return -1;
+}
+
+// Release whatever the slot's current op holds
+void seqReleaseOp(SeqSlot& slot) {
+  if (!slot.running || !slot.entered) return;
+  SeqOp op = slot.steps[slot.pc].op;
+  if (op == SEQ_TRACK) choreoStop();
+  if (op == SEQ_CPG) cpgStop();
+  if (op == SEQ_VM) vmStop();
+}
+
+void seqCancel(int prio) {
+  SeqSlot& slot = seqSlots[prio];
+  if (!slot.running) return;
+  seqReleaseOp(slot);
+  slot.running = false;
+  if (seqCurrent == prio) {
+    cancelGlides();
+    seqCurrent = -1;
+  }
+}
+
+void seqCancelAll() {
+  for (int p = 0; p < SEQ_PRIORITIES; p++) seqCancel(p);
+}
+
+// Freeze the running slot so a higher priority can take the servos
+void seqSuspend(int prio) {
+  SeqSlot& slot = seqSlots[prio];
+  slot.suspended = true;
+  slot.suspendedAt = millis();
+  if (!slot.restoring) {  // Mid-restore, keep the pose it was heading back to
+    for (int ch = 0; ch < SEQ_SERVOS; ch++) slot.pose[ch] = currentServoAngles[ch];
+  }
+  slot.restoring = false;
+  cancelGlides();
+  Serial.print("Sequence suspended: ");
+  Serial.println(slot.name);
+}
+
+// Unfreeze: shift its clocks past the pause and glide back to where it was
+void seqResume(SeqSlot& slot) {
+  unsigned long paused = millis() - slot.suspendedAt;
+  slot.opStart += paused;
+  if (slot.entered && slot.steps[slot.pc].op == SEQ_TRACK) choreo.start += paused;
+  if (slot.entered && slot.steps[slot.pc].op == SEQ_CPG) cpgResync();
+  if (slot.entered && slot.steps[slot.pc].op == SEQ_VM) vmShiftClock(paused);
+  slot.suspended = false;
+  if (slot.movedServos) {
+    for (int ch = 0; ch < SEQ_SERVOS; ch++) glideServo(ch, slot.pose[ch], SEQ_RESTORE_MS);
+    slot.restoring = true;
+  }
+  Serial.print("Sequence resumed: ");
+  Serial.println(slot.name);
+}
+
+void seqStart(int prio, const SeqStep* steps, const char* name) {
+  seqCancel(prio);
+  int top = seqTopSlot();
+  if (top >= 0 && top < prio && top == seqCurrent && !seqSlots[top].suspended) {
+    seqSuspend(top);
+  }
+  SeqSlot& slot = seqSlots[prio];
+  slot.steps = steps;
+  slot.name = name;
+  slot.pc = 0;
+  slot.running = true;
+  slot.entered = false;
+  slot.suspended = false;
+  slot.restoring = false;
+  slot.movedServos = false;
+  Serial.print("Sequence started: ");
+  Serial.println(name);
+}
+
+bool seqSuspendedBelow(int prio) {
+  for (int p = prio - 1; p >= 0; p--) {
+    if (seqSlots[p].running && seqSlots[p].suspended && seqSlots[p].movedServos) return true;
+  }
+  return false;
+}
+
+// Advance the highest-priority sequence; instant ops chain within one call
+void updateSequencer() {
+  updateGlides();
+
+  int top = seqTopSlot();
+  if (top < 0) return;
+  seqCurrent = top;
+  SeqSlot& slot = seqSlots[top];
+
+  if (slot.suspended) seqResume(slot);
+  if (slot.restoring) {
+    if (glidesActive()) return;
+    slot.restoring = false;
+  }
+
+  for (int guard = 0; guard < 16; guard++) {
+    const SeqStep& step = slot.steps[slot.pc];
+    bool firstVisit = !slot.entered;
+    if (firstVisit) {
+      slot.entered = true;
+      slot.opStart = millis();
+    }
+
+    switch (step.op) {
+      case SEQ_END:
+        slot.running = false;
+        seqCurrent = -1;
+        Serial.print("Sequence finished: ");
+        Serial.println(slot.name);
+        return;
+
+      case SEQ_MOVE:
+        slot.movedServos = true;
+        glideServo(step.channel, step.value, step.ms);
+        break;
+
+      case SEQ_SYNC:
+        if (glidesActive()) return;
+        break;
+
+      case SEQ_WAIT:
+        if (millis() - slot.opStart < step.ms) return;
+        break;
+
+      case SEQ_CALL:
+        if (step.call) step.call();
+        if (!slot.running) return;  // The call cancelled its own sequence
+        break;
+
+      case SEQ_TRACK:
+        slot.movedServos = true;
+        if (firstVisit && !startDanceTrack()) break;
+        updateChoreo();
+        if (choreo.active) return;
+        break;
+
+      case SEQ_CPG:
+        slot.movedServos = true;
+        if (firstVisit) cpgStart();
+        updateCpg();
+        return;
+
+      case SEQ_VM:
+        slot.movedServos = true;
+        if (firstVisit) vmStart();
+        updateVm();
+        if (vm.running) return;
+        break;
+
+      case SEQ_HOME:
+        slot.movedServos = true;
+        if (firstVisit) {
+          if (seqSuspendedBelow(top)) break;  // The resumed sequence restores its own pose
+          for (int ch = 0; ch < SEQ_SERVOS; ch++) glideServo(ch, servoHome[ch], step.ms);
+        }
+        if (glidesActive()) return;
+        break;
+
+      case SEQ_AWAIT:
+        if (!step.test() && millis() - slot.opStart < step.ms) return;
+        break;
+
+      case SEQ_JUMP_IF:
+        if (step.test && step.test()) {
+          slot.pc = step.value;
+          slot.entered = false;
+          continue;
+        }
+        break;
+    }
+
+    slot.pc++;
+    slot.entered = false;
+  }
+}
+
+#endif
@@ -0,0 +1,230 @@
+/*
+ * =========================================================
+ * SHOW LOG - RECORD AND REPLAY THE COMMAND STREAM ON LITTLEFS
+ * =========================================================
+ * While recording, every command the robot executes is appended
+ * to a log file with the time it ran. Replay reads the log back
+ * and executes each command against the local clock at the same
+ * offset from the start, so a rehearsal needs no browser, MP3
+ * or WiFi, and two firmware builds can be timed on the same show.
+ *
+ * File: SHOW_LOG_MAGIC, then one record per command:
+ *   varint ms since the previous record, command in the binary
+ *   protocol encoding (opcode + fields, see protocol.h)
+ *
+ * - Recording starts with a snapshot of the current settings,
+ *   so the replay doesn't depend on what the robot did before
+ * - Bytecode dances are not logged (a record can't hold the
+ *   program): recording is refused while one runs, and uploads
+ *   are refused while recording
+ * - Writes go through a small RAM buffer; nothing in the
+ *   control path waits on flash for more than one flush
+ * - Replay reports how late each command ran (average, max)
+ * =========================================================
+ */
+
+#ifndef SHOW_LOG_H
+#define SHOW_LOG_H
+
+// Include required libraries
+#include <Arduino.h>
+#include <LittleFS.h>
+#include "protocol.h"
+
+#define SHOW_LOG_PATH "/show.rbl"
+#define SHOW_LOG_MAGIC "RBS1"
+#define SHOW_LOG_MAGIC_SIZE 4
+#define SHOW_LOG_MAX_BYTES 32768
+#define SHOW_LOG_BUFFER 128
+#define SHOW_LOG_MAX_RECORD (5 + 1 + 8 + RB_SONG_NAME_MAX)  // varint + opcode + fields + name
+
+// External function declarations (these will be defined in the main file)
+extern bool executeCommand(const RbCommand& cmd);
+
+// show: commands run from loop() (RB_OP_SHOW); arm/disarm only set a flag
+enum ShowAction : uint8_t {
+  SHOW_ACTION_RECORD,
+  SHOW_ACTION_STOP,
+  SHOW_ACTION_PLAY,
+  SHOW_ACTION_INFO
+};
+
+enum ShowState : uint8_t {
+  SHOW_IDLE,
+  SHOW_RECORDING,
+  SHOW_REPLAYING
+};
+
+// -- SHOW LOG STATE VARIABLES --
+ShowState showState = SHOW_IDLE;
+bool showFsReady = false;
+bool showClapArmed = false;  // A clap starts the replay instead of the clap dance
+File showFile;
+uint8_t showBuffer[SHOW_LOG_BUFFER];
+size_t showBuffered = 0;
+size_t showBufferPos = 0;    // Replay: next unread byte in showBuffer
+uint32_t showRecords = 0;
+uint32_t showBytes = 0;
+uint32_t showDropped = 0;    // Recording: commands that didn't fit in SHOW_LOG_MAX_BYTES
+unsigned long showLastMs = 0;
+
+// Replay
+RbCommand showNext;
+bool showHasNext = false;
+unsigned long showStartUs = 0;
+uint64_t showDueUs = 0;      // Offset of showNext from showStartUs
+uint64_t showLateTotalUs = 0;
+uint32_t showLateMaxUs = 0;
+
+// Only what a client asks the robot to do; HELLO, PING, AT and telemetry are session plumbing
+bool showRecordable(uint8_t op) {
+  switch (op) {
+    case RB_OP_PAUSE: case RB_OP_STOP: case RB_OP_RESUME: case RB_OP_STEP: case RB_OP_SONG:
+    case RB_OP_SPEED: case RB_OP_LED: case RB_OP_BRIGHTNESS: case RB_OP_TEMPO: case RB_OP_ENERGY:
+    case RB_OP_STEP_DEPTH: case RB_OP_STEP_POLICY:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool showBegin() {
+  showFsReady = LittleFS.begin(true);  // Format on first use
+  return showFsReady;
+}
+
+// === RECORDING ===
+void showFlush() {
+  if (showBuffered == 0) return;
+  showFile.write(showBuffer, showBuffered);
+  showBuffered = 0;
+}
+
+bool showStartRecording() {
+  if (!showFsReady || showState != SHOW_IDLE) return false;
+  showFile = LittleFS.open(SHOW_LOG_PATH, "w");
+  if (!showFile) return false;
+  showFile.write((const uint8_t*)SHOW_LOG_MAGIC, SHOW_LOG_MAGIC_SIZE);
+  showState = SHOW_RECORDING;
+  showBuffered = 0;
+  showRecords = 0;
+  showBytes = SHOW_LOG_MAGIC_SIZE;
+  showDropped = 0;
+  showLastMs = millis();
+  return true;
+}
+
+// Called for every executed command; a no-op unless recording
+void showRecord(const RbCommand& cmd) {
+  if (showState != SHOW_RECORDING || !showRecordable(cmd.op)) return;
+  uint8_t record[SHOW_LOG_MAX_RECORD];
+  unsigned long now = millis();
+  uint32_t delta = now - showLastMs;
+  size_t used = 0;
+  do {
+    record[used++] = (delta & 0x7F) | (delta > 0x7F ? 0x80 : 0);
+    delta >>= 7;
+  } while (delta);
+  used += rbEncodeCommand(record + used, cmd);
+  if (showBytes + used > SHOW_LOG_MAX_BYTES) {
+    showDropped++;
+    return;
+  }
+  showLastMs = now;
+  if (showBuffered + used > SHOW_LOG_BUFFER) showFlush();
+  memcpy(showBuffer + showBuffered, record, used);
+  showBuffered += used;
+  showBytes += used;
+  showRecords++;
+}
+
+void showStopRecording() {
+  if (showState != SHOW_RECORDING) return;
+  showFlush();
+  showFile.close();
+  showState = SHOW_IDLE;
+}
+
+// === REPLAY ===
+// Keep at least one whole record in showBuffer
+void showFill() {
+  if (showBufferPos > 0) {
+    memmove(showBuffer, showBuffer + showBufferPos, showBuffered - showBufferPos);
+    showBuffered -= showBufferPos;
+    showBufferPos = 0;
+  }
+  if (showBuffered < SHOW_LOG_BUFFER) {
+    showBuffered += showFile.read(showBuffer + showBuffered, SHOW_LOG_BUFFER - showBuffered);
+  }
+}
+
+// Decode the next record into showNext; false at the end of the log or on a bad record
+bool showReadNext() {
+  if (showBuffered - showBufferPos < SHOW_LOG_MAX_RECORD) showFill();
+  const uint8_t* p = showBuffer + showBufferPos;
+  const uint8_t* end = showBuffer + showBuffered;
+  uint32_t delta = 0;
+  for (int shift = 0; ; shift += 7) {
+    if (p == end || shift > 28) return false;
+    delta |= (uint32_t)(*p & 0x7F) << shift;
+    if (!(*p++ & 0x80)) break;
+  }
+  if (p == end || !rbDecodeCommand(p, end, showNext)) return false;
+  showBufferPos = p - showBuffer;
+  showDueUs += (uint64_t)delta * 1000;
+  return true;
+}
+
+bool showStartReplay() {
+  if (!showFsReady || showState != SHOW_IDLE) return false;
+  showFile = LittleFS.open(SHOW_LOG_PATH, "r");
+  if (!showFile) return false;
+  char magic[SHOW_LOG_MAGIC_SIZE];
+  if (showFile.read((uint8_t*)magic, SHOW_LOG_MAGIC_SIZE) != SHOW_LOG_MAGIC_SIZE ||
+      memcmp(magic, SHOW_LOG_MAGIC, SHOW_LOG_MAGIC_SIZE) != 0) {
+    showFile.close();
+    return false;
+  }
+  showState = SHOW_REPLAYING;
+  showBuffered = 0;
+  showBufferPos = 0;
+  showRecords = 0;
+  showDueUs = 0;
+  showLateTotalUs = 0;
+  showLateMaxUs = 0;
+  showStartUs = micros();
+  showHasNext = showReadNext();
+  return true;
+}
+
+void showStopReplay() {
+  if (showState != SHOW_REPLAYING) return;
+  showFile.close();
+  showState = SHOW_IDLE;
+  showHasNext = false;
+}
+
+// From loop(): run every record that is due; true when the replay just finished
+bool showPoll() {
+  if (showState != SHOW_REPLAYING) return false;
+  while (showHasNext) {
+    unsigned long elapsed = micros() - showStartUs;
+    if (elapsed < showDueUs) return false;
+    uint32_t lateUs = elapsed - showDueUs;
+    showLateTotalUs += lateUs;
+    if (lateUs > showLateMaxUs) showLateMaxUs = lateUs;
+    showRecords++;
+    executeCommand(showNext);
+    showHasNext = showReadNext();
+  }
+  showStopReplay();
+  return true;
+}
+
+// "records,avgLateUs,maxLateUs" for the last replay
+void showReplayStats(char* out, size_t size) {
+  snprintf(out, size, "%lu,%lu,%lu", (unsigned long)showRecords,
+           (unsigned long)(showRecords ? showLateTotalUs / showRecords : 0), (unsigned long)showLateMaxUs);
+}
+
+#endif
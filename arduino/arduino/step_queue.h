@@ -0,0 +1,97 @@
+/*
+ * =========================================================
+ * STEP QUEUE - UPCOMING DANCE STEPS WITH AN OVERRUN POLICY
+ * =========================================================
+ * Step commands that arrive while a step is still playing wait
+ * here instead of replacing it. When the track ends, the next
+ * queued step starts straight from the pose the last one ended
+ * in (no trip home), so a client sending a step or two ahead
+ * hides the network latency.
+ *
+ * - Depth 1..STEPQ_MAX_DEPTH, set at runtime
+ * - When full: drop the oldest, drop the new one, or coalesce
+ *   (the new step replaces the last queued one)
+ * - Every overrun is counted and reported to the caller
+ * =========================================================
+ */
+
+#ifndef STEP_QUEUE_H
+#define STEP_QUEUE_H
+
+// Include required libraries
+#include <Arduino.h>
+
+#define STEPQ_MAX_DEPTH 8
+#define STEPQ_DEFAULT_DEPTH 4
+
+enum StepqPolicy : uint8_t {
+  STEPQ_DROP_OLDEST,
+  STEPQ_DROP_NEWEST,
+  STEPQ_COALESCE,
+  STEPQ_POLICIES
+};
+
+enum StepqResult : uint8_t {
+  STEPQ_QUEUED,
+  STEPQ_DROPPED_OLDEST,  // Queued, the oldest waiting step was lost
+  STEPQ_DROPPED_NEWEST,  // Not queued
+  STEPQ_COALESCED        // Queued in place of the last waiting step
+};
+
+// -- STEP QUEUE STATE VARIABLES --
+uint8_t stepqSteps[STEPQ_MAX_DEPTH];
+uint8_t stepqHead = 0;
+uint8_t stepqCount = 0;
+uint8_t stepqDepth = STEPQ_DEFAULT_DEPTH;
+uint8_t stepqPolicy = STEPQ_DROP_OLDEST;
+uint32_t stepqOverruns = 0;
+
+bool stepqConfigure(int32_t depth, int32_t policy) {
+  if (depth < 1 || depth > STEPQ_MAX_DEPTH || policy < 0 || policy >= STEPQ_POLICIES) return false;
+  stepqDepth = depth;
+  stepqPolicy = policy;
+  if (stepqCount > depth) stepqCount = depth;  // Keep the oldest
+  return true;
+}
+
+void stepqClear() {
+  stepqCount = 0;
+}
+
+// Add a step; lost is the step that didn't make it (when the result isn't STEPQ_QUEUED)
+StepqResult stepqPush(uint8_t step, uint8_t& lost) {
+  if (stepqCount < stepqDepth) {
+    stepqSteps[(stepqHead + stepqCount++) % STEPQ_MAX_DEPTH] = step;
+    return STEPQ_QUEUED;
+  }
+  stepqOverruns++;
+  uint8_t& tail = stepqSteps[(stepqHead + stepqCount - 1) % STEPQ_MAX_DEPTH];
+  switch (stepqPolicy) {
+    case STEPQ_DROP_NEWEST:
+      lost = step;
+      return STEPQ_DROPPED_NEWEST;
+    case STEPQ_COALESCE:
+      lost = tail;
+      tail = step;
+      return STEPQ_COALESCED;
+    default:
+      lost = stepqSteps[stepqHead];
+      stepqHead = (stepqHead + 1) % STEPQ_MAX_DEPTH;
+      stepqSteps[(stepqHead + stepqCount - 1) % STEPQ_MAX_DEPTH] = step;
+      return STEPQ_DROPPED_OLDEST;
+  }
+}
+
+bool stepqPop(uint8_t& step) {
+  if (stepqCount == 0) return false;
+  step = stepqSteps[stepqHead];
+  stepqHead = (stepqHead + 1) % STEPQ_MAX_DEPTH;
+  stepqCount--;
+  return true;
+}
+
+bool stepqPending() {
+  return stepqCount > 0;
+}
+
+#endif
@@ -0,0 +1,122 @@
+/*
+ * =========================================================
+ * TELEMETRY - PACKED STATUS SNAPSHOTS OVER THE WEBSOCKET
+ * =========================================================
+ * A client subscribes with RB_OP_TELEMETRY (or "telemetry:<hz>")
+ * and every connected client then receives binary snapshots at
+ * that rate: servo angles, step and keyframe, obstacle distance,
+ * loop/tick timing and heap.
+ *
+ * Snapshot (RB_MSG_TELEMETRY, little-endian, 52 bytes):
+ *    0 magic version type seq16
+ *    5 timeUs64          robot clock, same as PONG
+ *   13 angles[12]
+ *   25 step  keyframe16  distanceMm16
+ *   30 loopUs32  loopMaxUs32 (since the previous snapshot)
+ *   38 cpgTickUs16  schedLateUs32
+ *   44 freeHeap32  dropped16  seqSlot(int8)  flags
+ *
+ * Snapshots are built at send time and never queued. When a send
+ * is slow or fails, the next frames are skipped (and counted in
+ * dropped) instead of piling up behind a slow client.
+ * =========================================================
+ */
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+// Include required libraries
+#include <Arduino.h>
+#include "protocol.h"
+
+#define TELEMETRY_MAX_HZ 50
+#define TELEMETRY_FRAME_SIZE 52
+#define TELEMETRY_SLOW_SEND_US 4000  // A send this slow means the client is behind
+#define TELEMETRY_BACKOFF_FRAMES 4   // Frames skipped after a slow or failed send
+
+// Snapshot flag bits
+#define TELEMETRY_DANCING 0x01
+#define TELEMETRY_PAUSED 0x02
+#define TELEMETRY_OBSTACLE 0x04
+#define TELEMETRY_CLAP 0x08
+#define TELEMETRY_TRACK 0x10
+#define TELEMETRY_CPG 0x20
+#define TELEMETRY_VM 0x40
+
+struct TelemetrySnapshot {
+  uint64_t timeUs;
+  uint8_t angles[12];
+  uint8_t step;
+  uint16_t keyframe;
+  uint16_t distanceMm;
+  uint32_t loopUs;
+  uint32_t loopMaxUs;
+  uint16_t cpgTickUs;
+  int32_t schedLateUs;
+  uint32_t freeHeap;
+  int8_t seqSlot;
+  uint8_t flags;
+};
+
+// -- TELEMETRY STATE VARIABLES --
+unsigned long telemetryIntervalMs = 0;  // 0 = nobody subscribed
+unsigned long lastTelemetry = 0;
+uint16_t telemetrySeq = 0;
+uint16_t telemetryDropped = 0;
+uint8_t telemetrySkip = 0;  // Frames still to skip after backpressure
+
+bool telemetrySetRate(int hz) {
+  if (hz < 0 || hz > TELEMETRY_MAX_HZ) return false;
+  telemetryIntervalMs = hz ? 1000 / hz : 0;
+  telemetryDropped = 0;
+  telemetrySkip = 0;
+  Serial.print("Telemetry rate: ");
+  Serial.println(hz);
+  return true;
+}
+
+// True when a snapshot should be built and sent now
+bool telemetryDue() {
+  if (telemetryIntervalMs == 0) return false;
+  unsigned long elapsed = millis() - lastTelemetry;
+  if (elapsed < telemetryIntervalMs) return false;
+  // Intervals missed while the loop was busy are dropped, not caught up
+  if (elapsed >= 2 * telemetryIntervalMs && lastTelemetry != 0) {
+    telemetryDropped += elapsed / telemetryIntervalMs - 1;
+  }
+  lastTelemetry = millis();
+  if (telemetrySkip > 0) {
+    telemetrySkip--;
+    telemetryDropped++;
+    return false;
+  }
+  return true;
+}
+
+// Back off after a send that blocked or failed
+void telemetrySent(bool ok, unsigned long sendUs) {
+  if (!ok || sendUs > TELEMETRY_SLOW_SEND_US) telemetrySkip = TELEMETRY_BACKOFF_FRAMES;
+}
+
+size_t rbWriteTelemetry(uint8_t* out, const TelemetrySnapshot& snap) {
+  out[0] = RB_PROTO_MAGIC;
+  out[1] = RB_PROTO_VERSION;
+  out[2] = RB_MSG_TELEMETRY;
+  rbWriteU16(out + 3, telemetrySeq++);
+  rbWriteU64(out + 5, snap.timeUs);
+  memcpy(out + 13, snap.angles, 12);
+  out[25] = snap.step;
+  rbWriteU16(out + 26, snap.keyframe);
+  rbWriteU16(out + 28, snap.distanceMm);
+  rbWriteU32(out + 30, snap.loopUs);
+  rbWriteU32(out + 34, snap.loopMaxUs);
+  rbWriteU16(out + 38, snap.cpgTickUs);
+  rbWriteU32(out + 40, (uint32_t)snap.schedLateUs);
+  rbWriteU32(out + 44, snap.freeHeap);
+  rbWriteU16(out + 48, telemetryDropped);
+  out[50] = (uint8_t)snap.seqSlot;
+  out[51] = snap.flags;
+  return TELEMETRY_FRAME_SIZE;
+}
+
+#endif
@@ -0,0 +1,109 @@
+/*
+ * =========================================================
+ * ULTRASONIC - INTERRUPT-TIMED BACKGROUND RANGING
+ * =========================================================
+ * The HC-SR04 is pinged from the control tick and its echo is
+ * timed by a pin-change interrupt, so ranging never waits:
+ *
+ * - ultrasonicPoll() sends the 10 us trigger pulse once every
+ *   ULTRASONIC_PERIOD_MS (the previous ping's echoes have died
+ *   out by then) and returns at once
+ * - The echo interrupt notes the rising edge and, on the
+ *   falling edge, publishes the pulse width
+ * - A pulse longer than ULTRASONIC_TIMEOUT_US, or none by the
+ *   next ping, is published as "nothing in range"
+ *
+ * A reading is one 32-bit atomic word: sequence number in the
+ * top half, echo time in us in the bottom (0 = no echo), so
+ * loop() never sees half an update. ultrasonicRead() returns
+ * each new reading once.
+ * =========================================================
+ */
+
+#ifndef ULTRASONIC_H
+#define ULTRASONIC_H
+
+// Include required libraries
+#include <Arduino.h>
+#include <atomic>
+
+#define ULTRASONIC_PERIOD_MS 60       // Ping rate; echoes from the last ping are gone by then
+#define ULTRASONIC_TIMEOUT_US 30000   // About 5 m; the module holds a missed echo high for ~38 ms
+#define ULTRASONIC_TRIGGER_US 10
+#define ULTRASONIC_CM_PER_US 0.01715f // Half the speed of sound: the pulse goes there and back
+
+// -- ULTRASONIC STATE VARIABLES --
+uint8_t ultrasonicTrigPin = 0;
+uint8_t ultrasonicEchoPin = 0;
+std::atomic<uint32_t> ultrasonicReading{0};  // seq16 << 16 | echoUs16
+std::atomic<bool> ultrasonicWaiting{false};  // Pinged, no falling edge yet
+volatile uint32_t ultrasonicRiseUs = 0;
+uint16_t ultrasonicSeq = 0;                  // Written by whichever side publishes the ping's result
+uint16_t ultrasonicSeen = 0;
+unsigned long ultrasonicLastPing = 0;
+
+// Counters
+uint32_t ultrasonicPings = 0;
+uint32_t ultrasonicEchoes = 0;
+uint32_t ultrasonicMisses = 0;
+
+inline void ultrasonicPublish(uint32_t echoUs) {
+  ultrasonicSeq++;
+  ultrasonicReading.store((uint32_t)ultrasonicSeq << 16 | echoUs, std::memory_order_release);
+}
+
+void IRAM_ATTR ultrasonicEchoIsr() {
+  uint32_t now = micros();
+  if (digitalRead(ultrasonicEchoPin) == HIGH) {
+    ultrasonicRiseUs = now;
+    return;
+  }
+  if (!ultrasonicWaiting.exchange(false)) return;  // Already timed out
+  uint32_t width = now - ultrasonicRiseUs;
+  ultrasonicPublish(width <= ULTRASONIC_TIMEOUT_US ? width : 0);
+}
+
+void ultrasonicBegin(uint8_t trigPin, uint8_t echoPin) {
+  ultrasonicTrigPin = trigPin;
+  ultrasonicEchoPin = echoPin;
+  pinMode(trigPin, OUTPUT);
+  pinMode(echoPin, INPUT);
+  digitalWrite(trigPin, LOW);
+  attachInterrupt(digitalPinToInterrupt(echoPin), ultrasonicEchoIsr, CHANGE);
+}
+
+// Every control tick: ping when due; costs the trigger pulse and nothing else
+void ultrasonicPoll() {
+  if (millis() - ultrasonicLastPing < ULTRASONIC_PERIOD_MS) return;
+  ultrasonicLastPing = millis();
+  if (ultrasonicWaiting.exchange(false)) ultrasonicPublish(0);  // No falling edge since the last ping
+  ultrasonicPings++;
+  ultrasonicWaiting = true;
+  digitalWrite(ultrasonicTrigPin, HIGH);
+  delayMicroseconds(ULTRASONIC_TRIGGER_US);
+  digitalWrite(ultrasonicTrigPin, LOW);
+}
+
+// True once per new reading; cm is -1 when nothing is in range
+bool ultrasonicRead(float& cm) {
+  uint32_t reading = ultrasonicReading.load(std::memory_order_acquire);
+  uint16_t seq = reading >> 16;
+  if (seq == ultrasonicSeen) return false;
+  ultrasonicSeen = seq;
+  uint16_t echoUs = reading & 0xFFFF;
+  if (echoUs) {
+    ultrasonicEchoes++;
+  } else {
+    ultrasonicMisses++;
+  }
+  cm = echoUs ? echoUs * ULTRASONIC_CM_PER_US : -1;
+  return true;
+}
+
+// "pings,echoes,misses"
+void ultrasonicStats(char* out, size_t size) {
+  snprintf(out, size, "%lu,%lu,%lu", (unsigned long)ultrasonicPings, (unsigned long)ultrasonicEchoes,
+           (unsigned long)ultrasonicMisses);
+}
+
+#endif
@@ -0,0 +1,146 @@
+/*
+ * =========================================================
+ * AUDIO FFT BENCHMARK
+ * =========================================================
+ * Cost per audio frame of the fixed-point kernels in
+ * audio_spectrum.h (window, Q15 FFT, band energies) for
+ * 128 to 1024 points, next to a float FFT of the same size,
+ * and the share of the frame period (N / 10 kHz) it takes.
+ *
+ * Each size also checks the Q15 result against the float one
+ * on a test signal (a sine on bin N/16 plus noise): the peak
+ * must land on the same bin, and the SNR column is the Q15
+ * spectrum's error against the float spectrum.
+ *
+ * Host timings: a desktop runs the float FFT about as fast as
+ * the Q15 one, and the ESP32 is far slower at both, so read the
+ * columns for scaling with n, not as firmware numbers
+ * ("audiostats" reports the frame time on the robot).
+ *
+ * Build and run from the repository root:
+ *   g++ -std=gnu++17 -O2 -Itools/twin -Iarduino/arduino tools/bench_fft.cpp -o bench_fft
+ *   ./bench_fft
+ * =========================================================
+ */
+
+#include <Arduino.h>
+#include <chrono>
+#include <complex>
+#include <random>
+#include <vector>
+#include "audio_spectrum.h"
+
+static std::mt19937 rng(1);
+
+unsigned long millis() { return 0; }
+unsigned long micros() { return 0; }
+int analogRead(uint8_t) { return 0; }
+void audioFrameAnalysed(uint32_t) {}
+
+// === FLOAT REFERENCE ===
+void floatFft(std::vector<std::complex<float>>& x) {
+  size_t n = x.size();
+  for (size_t i = 1, j = 0; i < n; i++) {
+    size_t bit = n >> 1;
+    for (; j & bit; bit >>= 1) j ^= bit;
+    j ^= bit;
+    if (i < j) std::swap(x[i], x[j]);
+  }
+  for (size_t len = 2; len <= n; len <<= 1) {
+    std::complex<float> step = std::polar(1.0f, -2.0f * (float)M_PI / len);
+    for (size_t start = 0; start < n; start += len) {
+      std::complex<float> w = 1;
+      for (size_t k = 0; k < len / 2; k++, w *= step) {
+        std::complex<float> a = x[start + k], b = w * x[start + k + len / 2];
+        x[start + k] = a + b;
+        x[start + k + len / 2] = a - b;
+      }
+    }
+  }
+}
+
+// === TIMING ===
+template <typename Run> double usPerFrame(int frames, Run run) {
+  auto start = std::chrono::steady_clock::now();
+  for (int f = 0; f < frames; f++) run(f);
+  std::chrono::duration<double, std::micro> took = std::chrono::steady_clock::now() - start;
+  return took.count() / frames;
+}
+
+int main() {
+  const uint16_t SIZES[] = {128, 256, 512, 1024};
+  volatile int32_t sink = 0;
+  std::normal_distribution<float> noise(0, 200);
+
+  printf("%5s %8s %9s %9s %9s %9s %7s %9s %7s\n", "n", "frame ms", "window us", "fft us", "bands us", "float us",
+         "cpu %", "peak bin", "snr dB");
+  for (uint16_t n : SIZES) {
+    std::vector<int16_t> cosTable(n / 2), sinTable(n / 2), window(n), re(n), im(n);
+    std::vector<uint16_t> samples(n);
+    audioFftTables(cosTable.data(), sinTable.data(), n);
+    audioHannTable(window.data(), n);
+
+    // Same log-spaced bands, scaled from the 256-point edges
+    std::vector<uint16_t> edges(AUDIO_BANDS + 1);
+    for (uint8_t b = 0; b <= AUDIO_BANDS; b++) edges[b] = max(1, AUDIO_BAND_EDGES[b] * n / AUDIO_FFT_N);
+    uint32_t energy[AUDIO_BANDS];
+
+    uint16_t toneBin = n / 16;
+    for (uint16_t i = 0; i < n; i++) {
+      float x = 2048 + 1500 * sinf(2 * (float)M_PI * toneBin * i / n) + noise(rng);
+      samples[i] = constrain((int)lroundf(x), 0, 4095);
+    }
+
+    auto windowed = [&]() {
+      uint32_t sum = 0;
+      for (uint16_t i = 0; i < n; i++) sum += samples[i];
+      int16_t mean = sum / n;
+      for (uint16_t i = 0; i < n; i++) {
+        re[i] = ((samples[i] - mean) * 8 * window[i]) >> 15;
+        im[i] = 0;
+      }
+    };
+    int frames = 2000000 / n;
+    double windowUs = usPerFrame(frames, [&](int) { windowed(); });
+    double fftUs = usPerFrame(frames, [&](int) {
+      windowed();
+      audioFftQ15(re.data(), im.data(), n, cosTable.data(), sinTable.data(), n);
+    }) - windowUs;
+    double bandsUs = usPerFrame(frames, [&](int) {
+      audioBandEnergies(re.data(), im.data(), edges.data(), AUDIO_BANDS, energy);
+      sink += energy[0];
+    });
+
+    std::vector<std::complex<float>> ref(n);
+    auto floatFrame = [&]() {
+      float mean = 0;
+      for (uint16_t i = 0; i < n; i++) mean += samples[i];
+      mean /= n;
+      for (uint16_t i = 0; i < n; i++) ref[i] = (samples[i] - mean) * 8 * window[i] / 32768.0f;
+      floatFft(ref);
+    };
+    double floatUs = usPerFrame(frames, [&](int) {
+      floatFrame();
+      sink += (int32_t)ref[1].real();
+    });
+
+    // Accuracy: Q15 output is the float spectrum scaled by 1/n
+    windowed();
+    audioFftQ15(re.data(), im.data(), n, cosTable.data(), sinTable.data(), n);
+    floatFrame();
+    uint16_t peak = 1;
+    double signal = 0, error = 0;
+    for (uint16_t k = 1; k < n / 2; k++) {
+      if (abs(re[k]) + abs(im[k]) > abs(re[peak]) + abs(im[peak])) peak = k;
+      std::complex<float> expect = ref[k] / (float)n;
+      signal += std::norm(expect);
+      error += std::norm(expect - std::complex<float>(re[k], im[k]));
+    }
+
+    double frameUs = n * 1e6 / AUDIO_SAMPLE_HZ;
+    double totalUs = windowUs + fftUs + bandsUs;
+    printf("%5u %8.1f %9.2f %9.2f %9.2f %9.2f %7.3f %5u/%-3u %7.1f\n", n, frameUs / 1000, windowUs, fftUs, bandsUs,
+           floatUs, 100 * totalUs / frameUs, peak, toneBin, 10 * log10(signal / error));
+  }
+  return sink == 0x7FFFFFFF;
+}
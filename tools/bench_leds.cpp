@@ -0,0 +1,136 @@
+/*
+ * =========================================================
+ * LED EFFECT BENCHMARK
+ * =========================================================
+ * Render time per frame against pixel count for the effect
+ * kernels in led_effects.h, next to the per-pixel divide loops
+ * they replaced (strip length known only at run time, as it is
+ * once strips are configured as segments). Pixels are split
+ * into strips of at most 300, like a multi-pin rig, and the
+ * report adds the WS2812 wire time of the longest strip
+ * (30 us per pixel, strips sent in parallel) to show which one
+ * limits the frame rate.
+ *
+ * Host timings: a desktop divides far faster than the ESP32
+ * and the twin's sin8() is floating point, so read them for
+ * scaling and for render time against wire time, not as
+ * firmware numbers.
+ *
+ * Build and run from the repository root:
+ *   g++ -std=gnu++17 -O2 -Itools/twin -Iarduino/arduino tools/bench_leds.cpp -o bench_leds
+ *   ./bench_leds
+ * =========================================================
+ */
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include <chrono>
+#include <random>
+#include <vector>
+#include "led_effects.h"
+
+static std::mt19937 rng(1);
+
+unsigned long millis() { return 0; }
+unsigned long micros() { return 0; }
+long random(long howBig) { return howBig > 0 ? (long)(rng() % howBig) : 0; }
+long random(long howSmall, long howBig) { return howSmall + random(howBig - howSmall); }
+void twinRecord(const char*, const char*, ...) {}
+
+#define MAX_STRIP 300
+#define WIRE_US_PER_PIXEL 30
+
+// === EFFECTS BEFORE led_effects.h ===
+// As they were in RythmoBot.ino, with the strip length a run-time value
+void oldRainbow(CRGB* leds, uint16_t n, uint8_t hue) {
+  for (int i = 0; i < n; i++) leds[i] = CHSV((hue + (i * 255 / n)) % 255, 255, 100);
+}
+
+void oldWave(CRGB* leds, uint16_t n, uint8_t hue, int step) {
+  for (int i = 0; i < n; i++) {
+    uint8_t brightness = sin8(((i * 256 / n) + (step * 4)) % 256);
+    leds[i] = CHSV((hue + (i * 2)) % 255, 255, brightness);
+  }
+}
+
+void oldSineFill(CRGB* leds, uint16_t n, int step) {
+  for (int i = 0; i < n; i++) {
+    uint8_t brightness = sin8(((i * 256 / n) + (step * 8)) % 256);
+    leds[i] = CRGB(0, brightness, 0);
+  }
+}
+
+void oldFire(CRGB* leds, uint16_t n) {
+  for (int i = 0; i < n; i++) {
+    int heat = random(0, 255);
+    leds[i] = heat < 80 ? CRGB(CRGB::Black) : heat < 160 ? CRGB(CRGB::Red) : heat < 220 ? CRGB(CRGB::Orange)
+                                                                                        : CRGB(CRGB::Yellow);
+  }
+}
+
+void oldBurst(CRGB* leds, uint16_t n, unsigned long elapsed) {
+  int center = n / 2;
+  int maxRadius = n / 2;
+  int radius = map(elapsed, 0, 500, 0, maxRadius);
+  fill_solid(leds, n, CRGB::Black);
+  for (int i = max(0, center - radius); i <= min(n - 1, center + radius); i++) {
+    uint8_t brightness = 255 - (abs(i - center) * 255 / maxRadius);
+    brightness = max(brightness, (uint8_t)50);
+    leds[i] = CHSV((elapsed / 10) % 255, 255, brightness);
+  }
+}
+
+// === TIMING ===
+template <typename Render> double usPerFrame(int frames, Render render) {
+  auto start = std::chrono::steady_clock::now();
+  for (int f = 0; f < frames; f++) render(f);
+  std::chrono::duration<double, std::micro> took = std::chrono::steady_clock::now() - start;
+  return took.count() / frames;
+}
+
+int main() {
+  const uint16_t PIXELS[] = {60, 150, 300, 600, 1200, 2400};
+  volatile uint32_t sink = 0;
+
+  printf("%7s %6s %9s %10s %10s %8s %9s %7s\n", "pixels", "strips", "effect", "old us", "new us", "speedup",
+         "wire us", "max fps");
+  for (uint16_t pixels : PIXELS) {
+    std::vector<CRGB> leds(pixels);
+    std::vector<uint8_t> phase(pixels);
+    ledSegmentsBegin(phase.data());
+    for (uint16_t start = 0; start < pixels; start += MAX_STRIP) {
+      ledAddSegment(start, min(pixels - start, MAX_STRIP), false);
+    }
+    uint16_t longest = min(pixels, (uint16_t)MAX_STRIP);
+    int frames = max(200, 2000000 / pixels);
+
+    // The old loops ran over each strip the same way
+    auto perStrip = [&](auto render) {
+      for (uint8_t s = 0; s < ledSegmentCount; s++) render(&leds[ledSegments[s].start], ledSegments[s].count);
+    };
+    struct Row {
+      const char* name;
+      double oldUs;
+      double newUs;
+    } rows[] = {
+      {"rainbow", usPerFrame(frames, [&](int f) { perStrip([&](CRGB* px, uint16_t n) { oldRainbow(px, n, f); }); }),
+       usPerFrame(frames, [&](int f) { ledFxRainbow(leds.data(), phase.data(), pixels, f, 100); })},
+      {"wave", usPerFrame(frames, [&](int f) { perStrip([&](CRGB* px, uint16_t n) { oldWave(px, n, f, f); }); }),
+       usPerFrame(frames, [&](int f) { ledFxWave(leds.data(), phase.data(), pixels, f, f * 4); })},
+      {"sinefill", usPerFrame(frames, [&](int f) { perStrip([&](CRGB* px, uint16_t n) { oldSineFill(px, n, f); }); }),
+       usPerFrame(frames, [&](int f) { ledFxSineFill(leds.data(), phase.data(), pixels, CRGB(0, 255, 0), f * 8); })},
+      {"fire", usPerFrame(frames, [&](int) { perStrip([&](CRGB* px, uint16_t n) { oldFire(px, n); }); }),
+       usPerFrame(frames, [&](int) { ledFxFire(leds.data(), pixels); })},
+      {"burst", usPerFrame(frames, [&](int f) { perStrip([&](CRGB* px, uint16_t n) { oldBurst(px, n, f % 500); }); }),
+       usPerFrame(frames, [&](int f) { ledFxBurst(leds.data(), phase.data(), pixels, f % 256, f); })},
+    };
+    sink += leds[pixels / 2].r;
+
+    double wireUs = (double)longest * WIRE_US_PER_PIXEL;
+    for (const Row& row : rows) {
+      printf("%7u %6u %9s %10.2f %10.2f %7.1fx %9.0f %7.0f\n", pixels, ledSegmentCount, row.name, row.oldUs,
+             row.newUs, row.oldUs / row.newUs, wireUs, 1e6 / max(wireUs, row.newUs));
+    }
+  }
+  return sink == 0xFFFFFFFF;
+}
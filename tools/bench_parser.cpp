@@ -0,0 +1,151 @@
+/*
+ * =========================================================
+ * COMMAND PARSER BENCHMARK
+ * =========================================================
+ * Messages per second and heap allocations per message for
+ * the firmware's in-place parser (command_parser.h) against
+ * the String-based if/else chain it replaced, on a typical
+ * mix of client traffic.
+ *
+ * Build and run from the repository root:
+ *   g++ -std=c++17 -O2 -Itools/host -Iarduino/arduino tools/bench_parser.cpp -o bench_parser
+ *   ./bench_parser
+ * =========================================================
+ */
+
+#include <Arduino.h>
+#include <chrono>
+#include <new>
+#include <string>
+#include "command_parser.h"
+
+HostSerial Serial;
+unsigned long millis() { return 0; }
+unsigned long micros() { return 0; }
+void delay(unsigned long) {}
+void digitalWrite(uint8_t, uint8_t) {}
+long random(long howBig) { return rand() % howBig; }
+long random(long howSmall, long howBig) { return howSmall + rand() % (howBig - howSmall); }
+
+// Count every heap allocation
+static unsigned long allocations = 0;
+void* operator new(size_t size) {
+  allocations++;
+  void* p = malloc(size);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
+static volatile int32_t sink = 0;
+
+// -- In-place parser, same table shape as the firmware --
+void onVerb(uint8_t, const char* arg, size_t argLen) {
+  int32_t value;
+  if (cmdParseInt(arg, argLen, value)) sink += value;
+  else sink += argLen;
+}
+
+void onLed(uint8_t, const char* arg, size_t argLen) {
+  static const char* names[] = {"off", "rainbow", "pulse", "chase", "strobe", "fire", "dance", "breathing", "wave"};
+  static const uint32_t hashes[] = {cmdHash("off"), cmdHash("rainbow"), cmdHash("pulse"), cmdHash("chase"),
+                                    cmdHash("strobe"), cmdHash("fire"), cmdHash("dance"), cmdHash("breathing"),
+                                    cmdHash("wave")};
+  uint32_t hash = cmdHashRange(arg, argLen, true);
+  for (int i = 0; i < 9; i++) {
+    if (hashes[i] == hash && cmdMatches(names[i], arg, argLen, true)) {
+      sink += i;
+      return;
+    }
+  }
+}
+
+const CommandEntry TABLE[] = {
+  CMD_ENTRY("pause", onVerb),
+  CMD_ENTRY("stop", onVerb),
+  CMD_ENTRY("resume", onVerb),
+  CMD_ENTRY("heartbeat", onVerb),
+  CMD_ENTRY("song", onVerb),
+  CMD_ENTRY("speed", onVerb),
+  CMD_ENTRY("led", onLed),
+  CMD_ENTRY("brightness", onVerb),
+  CMD_ENTRY("tempo", onVerb),
+  CMD_ENTRY("energy", onVerb)
+};
+
+void parseInPlace(const char* msg, size_t len) {
+  int32_t step;
+  if (cmdParseInt(msg, len, step) && step >= 1 && step <= 26) {
+    sink += step;
+    return;
+  }
+  if (!cmdDispatch(TABLE, sizeof(TABLE) / sizeof(TABLE[0]), 0, msg, len)) sink -= 1;
+}
+
+// -- Old handler shape: build a String, then ==/startsWith/substring/toInt --
+void parseWithStrings(const char* msg, size_t len) {
+  std::string message = std::string(msg).substr(0, len);
+  auto startsWith = [&](const char* prefix) { return message.compare(0, strlen(prefix), prefix) == 0; };
+  auto toInt = [](const std::string& s) { return atoi(std::string(s).c_str()); };  // String::toInt copies too
+  if (message == "pause" || message == "stop" || message == "resume" || message == "heartbeat") {
+    sink += 1;
+    return;
+  }
+  if (toInt(message) >= 1 && toInt(message) <= 26) {
+    sink += toInt(message);
+  } else if (startsWith("song:")) {
+    std::string song = message.substr(5);
+    sink += song.size();
+  } else if (startsWith("speed:")) {
+    sink += toInt(message.substr(6));
+  } else if (startsWith("led:")) {
+    std::string led = message.substr(4);
+    for (char& c : led) c = tolower(c);
+    if (led == "off") sink += 0;
+    else if (led == "rainbow") sink += 1;
+    else if (led == "pulse") sink += 2;
+    else if (led == "chase") sink += 3;
+    else if (led == "strobe") sink += 4;
+    else if (led == "fire") sink += 5;
+    else if (led == "dance") sink += 6;
+    else if (led == "breathing") sink += 7;
+    else if (led == "wave") sink += 8;
+  } else if (startsWith("brightness:")) {
+    sink += toInt(message.substr(11));
+  } else if (startsWith("tempo:")) {
+    sink += toInt(message.substr(6));
+  } else if (startsWith("energy:")) {
+    sink += toInt(message.substr(7));
+  } else {
+    sink -= 1;
+  }
+}
+
+const char* MESSAGES[] = {
+  "12", "energy:180", "speed:150", "led:Rainbow", "brightness:200", "tempo:124",
+  "song:Falling For You Extended Mix", "heartbeat", "pause", "resume", "led:breathing", "7"
+};
+const int MESSAGE_COUNT = sizeof(MESSAGES) / sizeof(MESSAGES[0]);
+
+void bench(const char* label, void (*parse)(const char*, size_t)) {
+  const int rounds = 200000;
+  size_t lengths[MESSAGE_COUNT];
+  for (int i = 0; i < MESSAGE_COUNT; i++) lengths[i] = strlen(MESSAGES[i]);
+
+  unsigned long allocsBefore = allocations;
+  auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < rounds; r++) {
+    for (int i = 0; i < MESSAGE_COUNT; i++) parse(MESSAGES[i], lengths[i]);
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  double messages = (double)rounds * MESSAGE_COUNT;
+  printf("%-14s %12.0f msg/s  %6.1f ns/msg  %5.2f allocs/msg\n", label, messages / seconds,
+         seconds * 1e9 / messages, (allocations - allocsBefore) / messages);
+}
+
+int main() {
+  bench("String chain", parseWithStrings);
+  bench("in-place", parseInPlace);
+  return 0;
+}
@@ -0,0 +1,336 @@
+/*
+ * =========================================================
+ * CHOREO ENCODE - KEYFRAME TRACK GENERATOR (HOST TOOL)
+ * =========================================================
+ * Runs every step of the six song headers against recording
+ * stand-ins for smoothMove(), pwmWriteAngle(), delay() and the
+ * base motor calls, then writes the compressed tracks played by
+ * arduino/arduino/keyframes.h.
+ *
+ * Build and regenerate (from the repository root):
+ *   g++ -std=c++17 -O2 -Itools/host -Iarduino/arduino \
+ *       tools/choreo_encode.cpp -o choreo_encode
+ *   ./choreo_encode > arduino/arduino/choreo_tracks.h
+ *
+ * Timing follows the firmware: smoothMove() walks 5 degree
+ * increments with one delay each, moveForward()/moveBackward()
+ * run the base for their duration, random() is seeded so the
+ * output is reproducible. Size statistics go to stderr.
+ * =========================================================
+ */
+
+#include <Arduino.h>
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+// Same pin and channel numbers as RythmoBot.ino
+extern const int LEG1_HIP_CHANNEL = 6;
+extern const int LEG1_KNEE_CHANNEL = 7;
+extern const int LEG1_ANKLE_CHANNEL = 8;
+extern const int LEG2_HIP_CHANNEL = 9;
+extern const int LEG2_KNEE_CHANNEL = 10;
+extern const int LEG2_ANKLE_CHANNEL = 11;
+extern const int IN1 = 12, IN2 = 14, IN3 = 27, IN4 = 26;
+
+const int SERVOS = 12;
+const int BASE = 12;
+const int CHANNELS = 13;
+const int servoHome[SERVOS] = {90, 45, 135, 90, 60, 120, 0, 0, 0, 0, 0, 0};
+
+// === RECORDER ===
+
+struct ServoEvent {
+  unsigned long t0;
+  unsigned long duration;  // 0 = instant write
+  int channel;
+  int target;
+};
+
+struct BaseEvent {
+  unsigned long t;
+  uint8_t pins;
+};
+
+HostSerial Serial;
+unsigned long nowMs = 0;
+int pose[SERVOS];
+uint8_t basePins = 0;
+long baseStopAt = -1;  // Pending stop from moveForward()/moveBackward()
+std::vector<ServoEvent> servoEvents;
+std::vector<BaseEvent> baseEvents;
+
+void recordBase(uint8_t pins) {
+  if (baseStopAt >= 0 && (unsigned long)baseStopAt <= nowMs) {
+    baseEvents.push_back({(unsigned long)baseStopAt, 0});
+  }
+  baseStopAt = -1;
+  basePins = pins;
+  baseEvents.push_back({nowMs, pins});
+}
+
+unsigned long millis() { return nowMs; }
+unsigned long micros() { return nowMs * 1000; }
+void delay(unsigned long ms) { nowMs += ms; }
+long random(long howBig) { return howBig > 0 ? rand() % howBig : 0; }
+long random(long howSmall, long howBig) { return howBig > howSmall ? howSmall + random(howBig - howSmall) : howSmall; }
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+  const int pins[4] = {IN1, IN2, IN3, IN4};
+  for (int i = 0; i < 4; i++) {
+    if (pin == pins[i]) {
+      uint8_t bits = value ? (basePins | (1 << i)) : (basePins & ~(1 << i));
+      recordBase(bits);
+    }
+  }
+}
+
+void pwmWriteAngle(uint8_t ch, float angle) {
+  if (ch >= SERVOS) return;
+  int a = constrain((int)angle, 0, 180);
+  servoEvents.push_back({nowMs, 0, ch, a});
+  pose[ch] = a;
+}
+
+// Mirrors the firmware loop, including where it stops short of toAngle
+void smoothMove(uint8_t channel, int toAngle, int delayMs) {
+  if (channel >= SERVOS) return;
+  int fromAngle = pose[channel];
+  int step = (toAngle > fromAngle) ? 5 : -5;
+  int steps = abs(toAngle - fromAngle) / 5;
+  int finalAngle = fromAngle + steps * step;
+  if ((step > 0 && finalAngle > toAngle) || (step < 0 && finalAngle < toAngle)) finalAngle = toAngle;
+  finalAngle = constrain(finalAngle, 0, 180);
+  unsigned long duration = (unsigned long)(steps + 1) * delayMs;
+  servoEvents.push_back({nowMs, duration, channel, finalAngle});
+  pose[channel] = finalAngle;
+  nowMs += duration;
+}
+
+void moveForward(int duration) {
+  recordBase(0b0101);  // IN1, IN3 high
+  baseStopAt = nowMs + duration;
+}
+
+void moveBackward(int duration) {
+  recordBase(0b1010);  // IN2, IN4 high
+  baseStopAt = nowMs + duration;
+}
+
+void stopBase() { recordBase(0); }
+void playStepSound(int) {}
+
+#include "fallingforyou.h"
+#include "stereo.h"
+#include "faded.h"
+#include "alone.h"
+#include "neural.h"
+#include "other.h"
+
+// === KEYFRAME BUILDER ===
+
+struct Keyframe {
+  unsigned long duration;
+  uint16_t mask;
+  uint8_t values[CHANNELS];
+};
+
+// Turn the recorded events of one step into keyframes on a shared timeline
+std::vector<Keyframe> buildKeyframes(unsigned long endTime) {
+  std::set<unsigned long> bounds = {0, endTime};
+  for (const ServoEvent& e : servoEvents) {
+    bounds.insert(e.t0);
+    bounds.insert(e.t0 + e.duration);
+  }
+  for (const BaseEvent& e : baseEvents) bounds.insert(e.t);
+
+  int value[CHANNELS];
+  for (int ch = 0; ch < SERVOS; ch++) value[ch] = servoHome[ch];
+  value[BASE] = 0;
+  std::map<int, int> moveStart;  // Servo event index -> angle when it began
+
+  std::vector<Keyframe> frames;
+  auto emit = [&](unsigned long duration, uint16_t mask) {
+    Keyframe k;
+    k.duration = duration;
+    k.mask = mask;
+    for (int ch = 0; ch < CHANNELS; ch++) k.values[ch] = (uint8_t)value[ch];
+    // Instants merge with instants, holds with holds
+    if (!frames.empty()) {
+      Keyframe& last = frames.back();
+      if (duration == 0 && last.duration == 0) {
+        last.mask |= mask;
+        memcpy(last.values, k.values, CHANNELS);
+        return;
+      }
+      if (mask == 0 && last.mask == 0) {
+        last.duration += duration;
+        return;
+      }
+    }
+    frames.push_back(k);
+  };
+
+  for (auto it = bounds.begin(); it != bounds.end(); ++it) {
+    unsigned long t = *it;
+    if (t > endTime) break;
+
+    // Instant changes at t
+    uint16_t instant = 0;
+    for (const BaseEvent& e : baseEvents) {
+      if (e.t == t && value[BASE] != e.pins) {
+        value[BASE] = e.pins;
+        instant |= 1 << BASE;
+      } else if (e.t == t) {
+        value[BASE] = e.pins;
+      }
+    }
+    for (size_t i = 0; i < servoEvents.size(); i++) {
+      const ServoEvent& e = servoEvents[i];
+      if (e.t0 == t && e.duration == 0) {
+        if (value[e.channel] != e.target) instant |= 1 << e.channel;
+        value[e.channel] = e.target;
+      }
+      if (e.t0 == t && e.duration > 0) moveStart[(int)i] = value[e.channel];
+    }
+    if (instant) emit(0, instant);
+
+    auto next = std::next(it);
+    if (next == bounds.end() || *next > endTime) break;
+    unsigned long t1 = *next;
+
+    // Servo moves spanning [t, t1], split wherever another event lands inside
+    uint16_t moving = 0;
+    for (size_t i = 0; i < servoEvents.size(); i++) {
+      const ServoEvent& e = servoEvents[i];
+      if (e.duration == 0 || e.t0 > t || e.t0 + e.duration < t1) continue;
+      int from = moveStart[(int)i];
+      int angle = from + (int)lround((double)(e.target - from) * (double)(t1 - e.t0) / (double)e.duration);
+      if (angle != value[e.channel]) moving |= 1 << e.channel;
+      value[e.channel] = angle;
+    }
+    emit(t1 - t, moving);
+  }
+  return frames;
+}
+
+// === ENCODER ===
+
+void putVarint(std::vector<uint8_t>& out, uint32_t v) {
+  while (v >= 0x80) {
+    out.push_back((uint8_t)(v | 0x80));
+    v >>= 7;
+  }
+  out.push_back((uint8_t)v);
+}
+
+std::vector<uint8_t> encodeTrack(const std::vector<Keyframe>& frames) {
+  std::vector<uint8_t> out;
+  putVarint(out, (uint32_t)frames.size());
+  int state[CHANNELS];
+  for (int ch = 0; ch < SERVOS; ch++) state[ch] = servoHome[ch];
+  state[BASE] = 0;
+  for (const Keyframe& k : frames) {
+    putVarint(out, (uint32_t)k.duration);
+    putVarint(out, k.mask);
+    for (int ch = 0; ch < CHANNELS; ch++) {
+      if (!(k.mask & (1 << ch))) continue;
+      int32_t delta = (int32_t)k.values[ch] - state[ch];
+      putVarint(out, (uint32_t)((delta << 1) ^ (delta >> 31)));
+      state[ch] = k.values[ch];
+    }
+  }
+  return out;
+}
+
+struct SongSource {
+  const char* name;     // Name sent by the web app in "song:"
+  const char* symbol;   // Prefix for the generated arrays
+  void (*execute)(int);
+  int stepCount;
+};
+
+int main() {
+  srand(1);
+  const SongSource songs[] = {
+    {"Falling For You", "FALLING", executeFallingStep, 26},
+    {"Stereo Love", "STEREO", executeStereoStep, 28},
+    {"Faded", "FADED", executeFadedStep, 30},
+    {"Alone", "ALONE", executeAloneStep, 38},
+    {"Mastie Mashup", "NEURAL", executeNeuralStep, 35},
+    {"Other", "OTHER", executeOtherStep, 18},
+  };
+
+  printf("/*\n");
+  printf(" * =========================================================\n");
+  printf(" * CHOREO TRACKS - GENERATED, DO NOT EDIT\n");
+  printf(" * =========================================================\n");
+  printf(" * Compressed keyframe tracks for all six songs, generated by\n");
+  printf(" * tools/choreo_encode.cpp from the song headers. Edit the\n");
+  printf(" * song headers and regenerate instead.\n");
+  printf(" * =========================================================\n");
+  printf(" */\n\n");
+  printf("#ifndef CHOREO_TRACKS_H\n#define CHOREO_TRACKS_H\n\n");
+  printf("#include \"keyframes.h\"\n");
+
+  size_t totalBytes = 0;
+  size_t totalFrames = 0;
+  std::vector<std::string> entries;
+
+  for (const SongSource& song : songs) {
+    std::vector<uint8_t> data;
+    std::vector<uint16_t> offsets;
+    for (int step = 1; step <= song.stepCount; step++) {
+      for (int ch = 0; ch < SERVOS; ch++) pose[ch] = servoHome[ch];
+      servoEvents.clear();
+      baseEvents.clear();
+      basePins = 0;
+      baseStopAt = -1;
+      nowMs = 0;
+      song.execute(step);
+
+      unsigned long endTime = nowMs;
+      if (baseStopAt >= 0 && (unsigned long)baseStopAt > endTime) endTime = baseStopAt;
+      nowMs = endTime;
+      recordBase(0);  // Base always ends a step stopped
+
+      std::vector<Keyframe> frames = buildKeyframes(endTime);
+      offsets.push_back((uint16_t)data.size());
+      std::vector<uint8_t> track = encodeTrack(frames);
+      data.insert(data.end(), track.begin(), track.end());
+      totalFrames += frames.size();
+    }
+
+    printf("\n// %s - %zu steps, %zu bytes\n", song.name, offsets.size(), data.size());
+    printf("const uint8_t %s_TRACKS[] PROGMEM = {", song.symbol);
+    for (size_t i = 0; i < data.size(); i++) {
+      printf("%s%u%s", i % 20 == 0 ? "\n  " : "", data[i], i + 1 < data.size() ? ", " : "");
+    }
+    printf("\n};\n");
+    printf("const uint16_t %s_STEP_OFFSETS[] PROGMEM = {", song.symbol);
+    for (size_t i = 0; i < offsets.size(); i++) {
+      printf("%s%u%s", i % 12 == 0 ? "\n  " : "", offsets[i], i + 1 < offsets.size() ? ", " : "");
+    }
+    printf("\n};\n");
+
+    char entry[160];
+    snprintf(entry, sizeof(entry), "  {\"%s\", %s_TRACKS, %s_STEP_OFFSETS, %zu},",
+             song.name, song.symbol, song.symbol, offsets.size());
+    entries.push_back(entry);
+    totalBytes += data.size() + offsets.size() * 2;
+    fprintf(stderr, "%-16s %3zu steps %6zu bytes\n", song.name, offsets.size(), data.size() + offsets.size() * 2);
+  }
+
+  printf("\n// Looked up by song name; the last entry also serves unknown songs\n");
+  printf("const ChoreoSong CHOREO_SONGS[] = {\n");
+  for (const std::string& e : entries) printf("%s\n", e.c_str());
+  printf("};\n");
+  printf("const int CHOREO_SONG_COUNT = sizeof(CHOREO_SONGS) / sizeof(CHOREO_SONGS[0]);\n\n");
+  printf("#endif\n");
+
+  fprintf(stderr, "total            %zu keyframes %6zu bytes\n", totalFrames, totalBytes);
+  return 0;
+}
@@ -0,0 +1,53 @@
+/*
+ * =========================================================
+ * HOST ARDUINO SHIM
+ * =========================================================
+ * Just enough of the Arduino core to compile the firmware
+ * headers on a desktop compiler. Each host tool provides the
+ * function bodies (recording, simulated or real time).
+ * =========================================================
+ */
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+typedef uint8_t byte;
+
+// -- Provided by the host tool --
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void digitalWrite(uint8_t pin, uint8_t value);
+long random(long howBig);
+long random(long howSmall, long howBig);
+
+// Serial output is discarded unless a tool redirects it
+class HostSerial {
+public:
+  void begin(unsigned long) {}
+  template <typename T> size_t print(const T&) { return 0; }
+  template <typename T> size_t println(const T&) { return 0; }
+  size_t println() { return 0; }
+};
+
+extern HostSerial Serial;
+
+#endif
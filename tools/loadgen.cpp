@@ -0,0 +1,501 @@
+/*
+ * =========================================================
+ * CONTROL PROTOCOL LOAD GENERATOR
+ * =========================================================
+ * Opens N WebSocket clients to a robot (or tools/twin), plays
+ * a traffic mix at a fixed per-client rate and reports how the
+ * firmware keeps up: ACK latency percentiles, ACK statuses and
+ * frames that were never acknowledged.
+ *
+ * Traffic goes out as binary protocol frames (protocol.h),
+ * one command per frame unless --batch says otherwise, because
+ * the frame ACK carries the sequence number needed to match
+ * every reply to its request. Latency is send -> ACK on the
+ * client, so it includes the network both ways.
+ *
+ * Scenarios:
+ *   mixed   client 0 starts a song; steps, LED/brightness/speed
+ *           changes, pings and the odd pause/resume pair
+ *   steps   dance steps only
+ *   slider  brightness and speed sweeps (UI dragging)
+ *   storm   pause/resume back to back
+ *
+ * Build and run from the repository root:
+ *   g++ -std=c++17 -O2 tools/loadgen.cpp -o loadgen
+ *   ./loadgen --host 192.168.4.1 --port 81 --clients 3 --rate 20 --seconds 30
+ *
+ * Options: --host H --port N --clients N --rate FRAMES_PER_S (per
+ * client) --seconds N --scenario NAME --batch N --grace-ms N
+ * --seed N --label TEXT --json
+ *
+ * Same seed, scenario, rate and client count give the same traffic,
+ * so reports from two firmware builds can be compared line by line.
+ * =========================================================
+ */
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+// Protocol constants (arduino/arduino/protocol.h)
+const uint8_t RB_PROTO_MAGIC = 0xB1;
+const uint8_t RB_PROTO_VERSION = 1;
+const uint8_t RB_OP_PAUSE = 0x02;
+const uint8_t RB_OP_RESUME = 0x04;
+const uint8_t RB_OP_STEP = 0x05;
+const uint8_t RB_OP_SONG = 0x06;
+const uint8_t RB_OP_SPEED = 0x07;
+const uint8_t RB_OP_LED = 0x08;
+const uint8_t RB_OP_BRIGHTNESS = 0x09;
+const uint8_t RB_OP_PING = 0x0C;
+const uint8_t RB_MSG_HELLO = 0x81;
+const uint8_t RB_MSG_ACK = 0x82;
+const uint8_t RB_MSG_PONG = 0x83;
+const uint8_t RB_MSG_TELEMETRY = 0x84;
+
+const char* STATUS_NAMES[] = {"ok", "bad_version", "malformed", "rejected", "queue_full", "cancelled"};
+const int STATUS_COUNT = 6;
+
+// === OPTIONS ===
+struct Options {
+  std::string host = "127.0.0.1";
+  int port = 81;
+  int clients = 1;
+  double rate = 10;
+  double seconds = 10;
+  std::string scenario = "mixed";
+  int batch = 1;
+  int graceMs = 2000;
+  unsigned seed = 1;
+  std::string label;
+  bool json = false;
+};
+
+static uint64_t nowUs() {
+  static const auto start = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+// === TRAFFIC ===
+struct Command {
+  uint8_t op;
+  uint32_t value;
+  const char* text;  // RB_OP_SONG
+};
+
+class Traffic {
+public:
+  Traffic(const std::string& scenario, unsigned seed, int client) : scenario(scenario), rng(seed * 7919 + client) {}
+
+  Command next() {
+    n++;
+    if (scenario == "steps") return step();
+    if (scenario == "slider") return slider();
+    if (scenario == "storm") return {(n & 1) ? RB_OP_PAUSE : RB_OP_RESUME, 0, nullptr};
+    // mixed
+    if (pendingResume) {
+      pendingResume = false;
+      return {RB_OP_RESUME, 0, nullptr};
+    }
+    uint32_t roll = rng() % 100;
+    if (roll < 45) return step();
+    if (roll < 70) return slider();
+    if (roll < 80) return {RB_OP_LED, LED_PATTERNS[rng() % 6], nullptr};
+    if (roll < 95) return {RB_OP_PING, n, nullptr};
+    pendingResume = true;
+    return {RB_OP_PAUSE, 0, nullptr};
+  }
+
+private:
+  Command step() { return {RB_OP_STEP, 1 + (n % 26), nullptr}; }
+
+  Command slider() {
+    // Triangle sweep, like a finger dragging back and forth
+    uint32_t pos = (n * 9) % 510;
+    uint32_t value = pos < 255 ? pos : 510 - pos;
+    return {(n % 3) ? RB_OP_BRIGHTNESS : RB_OP_SPEED, value, nullptr};
+  }
+
+  static constexpr uint32_t LED_PATTERNS[6] = {1, 2, 3, 5, 6, 12};
+  std::string scenario;
+  std::mt19937 rng;
+  uint32_t n = 0;
+  bool pendingResume = false;
+};
+
+constexpr uint32_t Traffic::LED_PATTERNS[6];
+
+static void encode(std::vector<uint8_t>& out, const Command& cmd) {
+  out.push_back(cmd.op);
+  switch (cmd.op) {
+    case RB_OP_PAUSE:
+    case RB_OP_RESUME:
+      break;
+    case RB_OP_PING:
+      for (int i = 0; i < 4; i++) out.push_back(cmd.value >> (8 * i));
+      break;
+    case RB_OP_SONG: {
+      size_t len = strlen(cmd.text);
+      out.push_back(len);
+      out.insert(out.end(), cmd.text, cmd.text + len);
+      break;
+    }
+    default:
+      out.push_back(cmd.value);
+      break;
+  }
+}
+
+// === CLIENT ===
+struct Client {
+  int fd = -1;
+  bool open = false;
+  uint16_t seq = 0;
+  uint64_t nextSendUs = 0;
+  std::string in;
+  std::string out;
+  std::map<uint16_t, uint64_t> pending;  // seq -> send time
+  Traffic traffic;
+  Client(const Options& opt, int index) : traffic(opt.scenario, opt.seed, index) {}
+};
+
+struct Stats {
+  std::vector<uint64_t> latencies;
+  uint64_t framesSent = 0;
+  uint64_t commandsSent = 0;
+  uint64_t acked = 0;
+  uint64_t executed = 0;
+  uint64_t statuses[STATUS_COUNT] = {0};
+  uint64_t pongs = 0;
+  uint64_t telemetry = 0;
+  uint64_t textMessages = 0;
+  uint64_t overruns = 0;
+  uint64_t lost = 0;
+  uint64_t connectFailures = 0;
+  uint64_t disconnects = 0;
+  uint32_t caps = 0;
+};
+
+static std::string wsFrame(uint8_t op, const uint8_t* data, size_t len, std::mt19937& rng) {
+  std::string frame;
+  frame += (char)(0x80 | op);
+  if (len < 126) {
+    frame += (char)(0x80 | len);
+  } else {
+    frame += (char)(0x80 | 126);
+    frame += (char)(len >> 8);
+    frame += (char)len;
+  }
+  uint8_t mask[4];
+  for (uint8_t& m : mask) m = rng();
+  frame.append((const char*)mask, 4);
+  for (size_t i = 0; i < len; i++) frame += (char)(data[i] ^ mask[i % 4]);
+  return frame;
+}
+
+static bool connectClient(Client& client, const Options& opt) {
+  addrinfo hints = {};
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+  addrinfo* res;
+  if (getaddrinfo(opt.host.c_str(), std::to_string(opt.port).c_str(), &hints, &res) != 0) return false;
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  bool ok = connect(fd, res->ai_addr, res->ai_addrlen) == 0;
+  freeaddrinfo(res);
+  if (!ok) {
+    close(fd);
+    return false;
+  }
+  int on = 1;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+
+  std::string request = "GET / HTTP/1.1\r\nHost: " + opt.host +
+                        "\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+                        "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\nSec-WebSocket-Version: 13\r\n\r\n";
+  send(fd, request.data(), request.size(), MSG_NOSIGNAL);
+  timeval timeout = {3, 0};
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+  std::string response;
+  char c;
+  while (response.find("\r\n\r\n") == std::string::npos && recv(fd, &c, 1, 0) == 1) response += c;
+  if (response.compare(0, 12, "HTTP/1.1 101") != 0) {
+    close(fd);
+    return false;
+  }
+  fcntl(fd, F_SETFL, O_NONBLOCK);
+  client.fd = fd;
+  client.open = true;
+  return true;
+}
+
+static void closeClient(Client& client, Stats& stats) {
+  if (client.fd < 0) return;
+  close(client.fd);
+  client.fd = -1;
+  client.open = false;
+  stats.disconnects++;
+}
+
+static void handleMessage(Client& client, uint8_t op, const std::string& payload, Stats& stats) {
+  const uint8_t* p = (const uint8_t*)payload.data();
+  if (op == 0x1) {
+    stats.textMessages++;
+    if (payload.compare(0, 13, "step_overrun:") == 0) stats.overruns++;
+    return;
+  }
+  if (op != 0x2 || payload.size() < 3 || p[0] != RB_PROTO_MAGIC) return;
+  switch (p[2]) {
+    case RB_MSG_HELLO:
+      if (payload.size() >= 7) stats.caps = p[3] | p[4] << 8 | p[5] << 16 | (uint32_t)p[6] << 24;
+      break;
+    case RB_MSG_PONG:
+      stats.pongs++;
+      break;
+    case RB_MSG_TELEMETRY:
+      stats.telemetry++;
+      break;
+    case RB_MSG_ACK: {
+      if (payload.size() < 7) break;
+      uint16_t seq = p[3] | p[4] << 8;
+      auto it = client.pending.find(seq);
+      if (it == client.pending.end()) break;
+      stats.latencies.push_back(nowUs() - it->second);
+      client.pending.erase(it);
+      stats.acked++;
+      stats.executed += p[5];
+      if (p[6] < STATUS_COUNT) stats.statuses[p[6]]++;
+      break;
+    }
+  }
+}
+
+static void readClient(Client& client, Stats& stats) {
+  char buffer[8192];
+  for (;;) {
+    ssize_t n = recv(client.fd, buffer, sizeof(buffer), 0);
+    if (n > 0) {
+      client.in.append(buffer, n);
+      continue;
+    }
+    if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) closeClient(client, stats);
+    break;
+  }
+  // Server frames are unmasked
+  for (;;) {
+    const uint8_t* p = (const uint8_t*)client.in.data();
+    size_t have = client.in.size();
+    if (have < 2) return;
+    uint64_t len = p[1] & 0x7F;
+    size_t header = 2;
+    if (len == 126) {
+      if (have < 4) return;
+      len = p[2] << 8 | p[3];
+      header = 4;
+    } else if (len == 127) {
+      if (have < 10) return;
+      len = 0;
+      for (int i = 0; i < 8; i++) len = len << 8 | p[2 + i];
+      header = 10;
+    }
+    if (have < header + len) return;
+    uint8_t op = p[0] & 0x0F;
+    std::string payload = client.in.substr(header, len);
+    client.in.erase(0, header + len);
+    handleMessage(client, op, payload, stats);
+  }
+}
+
+static void flushClient(Client& client, Stats& stats) {
+  while (client.fd >= 0 && !client.out.empty()) {
+    ssize_t n = send(client.fd, client.out.data(), client.out.size(), MSG_NOSIGNAL);
+    if (n > 0) {
+      client.out.erase(0, n);
+    } else {
+      if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK) closeClient(client, stats);
+      return;
+    }
+  }
+}
+
+static void sendFrame(Client& client, const Options& opt, Stats& stats, std::mt19937& maskRng) {
+  std::vector<uint8_t> frame = {RB_PROTO_MAGIC, RB_PROTO_VERSION, (uint8_t)(client.seq & 0xFF), (uint8_t)(client.seq >> 8)};
+  for (int i = 0; i < opt.batch; i++) encode(frame, client.traffic.next());
+  client.pending[client.seq] = nowUs();
+  client.seq++;
+  client.out += wsFrame(0x2, frame.data(), frame.size(), maskRng);
+  stats.framesSent++;
+  stats.commandsSent += opt.batch;
+  flushClient(client, stats);
+}
+
+// === REPORT ===
+static uint64_t percentile(const std::vector<uint64_t>& sorted, double p) {
+  if (sorted.empty()) return 0;
+  size_t i = std::min(sorted.size() - 1, (size_t)(p / 100.0 * sorted.size()));
+  return sorted[i];
+}
+
+static void report(const Options& opt, Stats& stats, double elapsed) {
+  std::vector<uint64_t>& lat = stats.latencies;
+  std::sort(lat.begin(), lat.end());
+  double mean = 0;
+  for (uint64_t v : lat) mean += v;
+  mean = lat.empty() ? 0 : mean / lat.size();
+  double lossPct = stats.framesSent ? 100.0 * stats.lost / stats.framesSent : 0;
+
+  if (opt.json) {
+    printf("{\"label\":\"%s\",\"scenario\":\"%s\",\"clients\":%d,\"rate\":%.1f,\"batch\":%d,\"seconds\":%.2f,"
+           "\"caps\":%u,\"frames\":%llu,\"commands\":%llu,\"acked\":%llu,\"executed\":%llu,\"lost\":%llu,"
+           "\"loss_pct\":%.3f,\"throughput\":%.1f,",
+           opt.label.c_str(), opt.scenario.c_str(), opt.clients, opt.rate, opt.batch, elapsed, stats.caps,
+           (unsigned long long)stats.framesSent, (unsigned long long)stats.commandsSent,
+           (unsigned long long)stats.acked, (unsigned long long)stats.executed, (unsigned long long)stats.lost,
+           lossPct, stats.acked / elapsed);
+    printf("\"latency_us\":{\"mean\":%.0f,\"p50\":%llu,\"p90\":%llu,\"p99\":%llu,\"p999\":%llu,\"max\":%llu},",
+           mean, (unsigned long long)percentile(lat, 50), (unsigned long long)percentile(lat, 90),
+           (unsigned long long)percentile(lat, 99), (unsigned long long)percentile(lat, 99.9),
+           (unsigned long long)(lat.empty() ? 0 : lat.back()));
+    printf("\"status\":{");
+    for (int i = 0; i < STATUS_COUNT; i++) {
+      printf("%s\"%s\":%llu", i ? "," : "", STATUS_NAMES[i], (unsigned long long)stats.statuses[i]);
+    }
+    printf("},\"pongs\":%llu,\"telemetry\":%llu,\"text\":%llu,\"step_overruns\":%llu,\"connect_failures\":%llu,"
+           "\"disconnects\":%llu}\n",
+           (unsigned long long)stats.pongs, (unsigned long long)stats.telemetry,
+           (unsigned long long)stats.textMessages, (unsigned long long)stats.overruns,
+           (unsigned long long)stats.connectFailures, (unsigned long long)stats.disconnects);
+    return;
+  }
+
+  printf("label          %s\n", opt.label.empty() ? "-" : opt.label.c_str());
+  printf("scenario       %s, %d clients x %.1f frames/s, batch %d, %.1f s\n", opt.scenario.c_str(), opt.clients,
+         opt.rate, opt.batch, elapsed);
+  printf("robot caps     0x%04x\n", stats.caps);
+  printf("frames         %llu sent, %llu acked, %llu lost (%.3f%%)\n", (unsigned long long)stats.framesSent,
+         (unsigned long long)stats.acked, (unsigned long long)stats.lost, lossPct);
+  printf("commands       %llu sent, %llu executed\n", (unsigned long long)stats.commandsSent,
+         (unsigned long long)stats.executed);
+  printf("throughput     %.1f acks/s\n", stats.acked / elapsed);
+  printf("latency (us)   mean %.0f  p50 %llu  p90 %llu  p99 %llu  p99.9 %llu  max %llu\n", mean,
+         (unsigned long long)percentile(lat, 50), (unsigned long long)percentile(lat, 90),
+         (unsigned long long)percentile(lat, 99), (unsigned long long)percentile(lat, 99.9),
+         (unsigned long long)(lat.empty() ? 0 : lat.back()));
+  printf("ack status    ");
+  for (int i = 0; i < STATUS_COUNT; i++) printf(" %s %llu", STATUS_NAMES[i], (unsigned long long)stats.statuses[i]);
+  printf("\n");
+  printf("other          %llu pongs, %llu telemetry, %llu text, %llu step overruns\n", (unsigned long long)stats.pongs,
+         (unsigned long long)stats.telemetry, (unsigned long long)stats.textMessages,
+         (unsigned long long)stats.overruns);
+  printf("connections    %llu failed, %llu dropped\n", (unsigned long long)stats.connectFailures,
+         (unsigned long long)stats.disconnects);
+}
+
+static void usage() {
+  fprintf(stderr,
+          "usage: loadgen [--host H] [--port N] [--clients N] [--rate FRAMES_PER_S] [--seconds N]\n"
+          "               [--scenario mixed|steps|slider|storm] [--batch N] [--grace-ms N] [--seed N]\n"
+          "               [--label TEXT] [--json]\n");
+  exit(2);
+}
+
+int main(int argc, char** argv) {
+  Options opt;
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    bool hasValue = i + 1 < argc;
+    if (arg == "--host" && hasValue) opt.host = argv[++i];
+    else if (arg == "--port" && hasValue) opt.port = atoi(argv[++i]);
+    else if (arg == "--clients" && hasValue) opt.clients = std::max(1, atoi(argv[++i]));
+    else if (arg == "--rate" && hasValue) opt.rate = std::max(0.1, atof(argv[++i]));
+    else if (arg == "--seconds" && hasValue) opt.seconds = atof(argv[++i]);
+    else if (arg == "--scenario" && hasValue) opt.scenario = argv[++i];
+    else if (arg == "--batch" && hasValue) opt.batch = std::max(1, std::min(32, atoi(argv[++i])));
+    else if (arg == "--grace-ms" && hasValue) opt.graceMs = atoi(argv[++i]);
+    else if (arg == "--seed" && hasValue) opt.seed = strtoul(argv[++i], nullptr, 10);
+    else if (arg == "--label" && hasValue) opt.label = argv[++i];
+    else if (arg == "--json") opt.json = true;
+    else usage();
+  }
+  if (opt.scenario != "mixed" && opt.scenario != "steps" && opt.scenario != "slider" && opt.scenario != "storm") usage();
+
+  Stats stats;
+  std::mt19937 maskRng(opt.seed);
+  std::vector<Client> clients;
+  for (int i = 0; i < opt.clients; i++) {
+    clients.emplace_back(opt, i);
+    if (!connectClient(clients.back(), opt)) {
+      stats.connectFailures++;
+      fprintf(stderr, "loadgen: client %d could not connect to %s:%d\n", i, opt.host.c_str(), opt.port);
+    }
+  }
+
+  // Stagger clients across one send interval; client 0 starts the song
+  uint64_t intervalUs = (uint64_t)(1e6 / opt.rate);
+  uint64_t start = nowUs();
+  for (int i = 0; i < opt.clients; i++) clients[i].nextSendUs = start + intervalUs * i / opt.clients;
+  if (opt.scenario == "mixed" && clients[0].open) {
+    std::vector<uint8_t> frame = {RB_PROTO_MAGIC, RB_PROTO_VERSION, 0, 0};
+    encode(frame, {RB_OP_SONG, 0, "Faded"});
+    clients[0].pending[clients[0].seq++] = nowUs();
+    clients[0].out += wsFrame(0x2, frame.data(), frame.size(), maskRng);
+    stats.framesSent++;
+    stats.commandsSent++;
+    flushClient(clients[0], stats);
+  }
+
+  uint64_t sendUntil = start + (uint64_t)(opt.seconds * 1e6);
+  uint64_t stopAt = sendUntil + (uint64_t)opt.graceMs * 1000;
+  std::vector<pollfd> fds(clients.size());
+  for (;;) {
+    uint64_t now = nowUs();
+    bool waiting = false;
+    for (Client& client : clients) {
+      if (!client.open) continue;
+      while (now < sendUntil && client.nextSendUs <= now) {
+        sendFrame(client, opt, stats, maskRng);
+        client.nextSendUs += intervalUs;
+      }
+      waiting |= !client.pending.empty();
+    }
+    if (now >= stopAt || (now >= sendUntil && !waiting)) break;
+
+    uint64_t wakeUs = now >= sendUntil ? stopAt : sendUntil;
+    for (size_t i = 0; i < clients.size(); i++) {
+      fds[i].fd = clients[i].fd;
+      fds[i].events = POLLIN | (clients[i].out.empty() ? 0 : POLLOUT);
+      fds[i].revents = 0;
+      if (clients[i].open && now < sendUntil) wakeUs = std::min(wakeUs, clients[i].nextSendUs);
+    }
+    int timeoutMs = wakeUs > now ? (int)((wakeUs - now + 999) / 1000) : 0;
+    poll(fds.data(), fds.size(), timeoutMs);
+    for (size_t i = 0; i < clients.size(); i++) {
+      if (!clients[i].open) continue;
+      if (fds[i].revents & POLLOUT) flushClient(clients[i], stats);
+      if (fds[i].revents & (POLLIN | POLLHUP | POLLERR)) readClient(clients[i], stats);
+    }
+  }
+  double elapsed = (nowUs() - start) / 1e6;
+
+  for (Client& client : clients) {
+    stats.lost += client.pending.size();
+    if (client.fd >= 0) close(client.fd);
+  }
+  report(opt, stats, elapsed);
+  return 0;
+}
@@ -0,0 +1,263 @@
+/*
+ * =========================================================
+ * PIXEL STREAM SENDER
+ * =========================================================
+ * Stands in for a lighting desk: renders a simple effect on the
+ * PC and streams it to the robot (or tools/twin) as DDP or
+ * E1.31 at a fixed frame rate, so pixel_stream.h can be tested
+ * without show software.
+ *
+ * --drop N sends every packet except each Nth, and --reorder N
+ * swaps each Nth packet with the one after it. The robot's
+ * "streamstats" reply should then show the dropped and late
+ * packets (a swapped pair also shows as one gap). A run that
+ * ends without --terminate lets the robot time out to its
+ * own pattern after 2.5 s.
+ *
+ * Build and run from the repository root:
+ *   g++ -std=c++17 -O2 tools/pixel_sender.cpp -o pixel_sender
+ *   ./pixel_sender --host 192.168.4.1 --proto ddp --pixels 60 --fps 40 --seconds 10
+ *
+ * Options: --host H --proto ddp|e131 --pixels N --fps F --seconds N
+ * --effect rainbow|chase|solid --universe U --packet-pixels N (DDP)
+ * --drop N --reorder N --terminate (E1.31)
+ * =========================================================
+ */
+
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Wire constants (arduino/arduino/pixel_stream.h)
+const int DDP_PORT = 4048;
+const int E131_PORT = 5568;
+const uint8_t DDP_FLAG_VERSION_1 = 0x40;
+const uint8_t DDP_FLAG_PUSH = 0x01;
+const uint8_t DDP_TYPE_RGB8 = 0x0B;
+const uint8_t DDP_ID_DISPLAY = 1;
+const int E131_HEADER = 126;
+const int E131_CHANNELS = 510;
+const uint8_t E131_OPTION_TERMINATED = 0x40;
+
+// === OPTIONS ===
+struct Options {
+  std::string host = "127.0.0.1";
+  std::string proto = "ddp";
+  int pixels = 60;
+  double fps = 40;
+  double seconds = 10;
+  std::string effect = "rainbow";
+  int universe = 1;
+  int packetPixels = 480;  // 1440 data bytes, fits one Ethernet frame
+  int drop = 0;
+  int reorder = 0;
+  bool terminate = false;
+};
+
+static uint64_t nowUs() {
+  static const auto start = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+// === EFFECTS ===
+static void hsvToRgb(uint8_t h, uint8_t* out) {
+  float hue = h / 256.0f * 6.0f;
+  float x = 1.0f - std::fabs(std::fmod(hue, 2.0f) - 1.0f);
+  float r = 0, g = 0, b = 0;
+  switch ((int)hue) {
+    case 0: r = 1; g = x; break;
+    case 1: r = x; g = 1; break;
+    case 2: g = 1; b = x; break;
+    case 3: g = x; b = 1; break;
+    case 4: r = x; b = 1; break;
+    default: r = 1; b = x; break;
+  }
+  out[0] = r * 255;
+  out[1] = g * 255;
+  out[2] = b * 255;
+}
+
+static void render(const Options& opt, uint32_t frame, std::vector<uint8_t>& rgb) {
+  for (int i = 0; i < opt.pixels; i++) {
+    uint8_t* px = &rgb[i * 3];
+    if (opt.effect == "chase") {
+      bool lit = (i + opt.pixels - (int)(frame % opt.pixels)) % opt.pixels < 3;
+      px[0] = lit ? 255 : 0;
+      px[1] = lit ? 80 : 0;
+      px[2] = 0;
+    } else if (opt.effect == "solid") {
+      hsvToRgb(frame * 2, px);
+    } else {
+      hsvToRgb(frame * 4 + i * 256 / opt.pixels, px);
+    }
+  }
+}
+
+// === PACKETS ===
+static std::vector<std::vector<uint8_t>> ddpPackets(const Options& opt, const std::vector<uint8_t>& rgb, uint8_t& seq) {
+  std::vector<std::vector<uint8_t>> packets;
+  size_t chunk = (size_t)opt.packetPixels * 3;
+  for (size_t offset = 0; offset < rgb.size(); offset += chunk) {
+    size_t len = std::min(chunk, rgb.size() - offset);
+    bool last = offset + len >= rgb.size();
+    seq = seq % 15 + 1;
+    std::vector<uint8_t> p = {
+      (uint8_t)(DDP_FLAG_VERSION_1 | (last ? DDP_FLAG_PUSH : 0)), seq, DDP_TYPE_RGB8, DDP_ID_DISPLAY,
+      (uint8_t)(offset >> 24), (uint8_t)(offset >> 16), (uint8_t)(offset >> 8), (uint8_t)offset,
+      (uint8_t)(len >> 8), (uint8_t)len};
+    p.insert(p.end(), rgb.begin() + offset, rgb.begin() + offset + len);
+    packets.push_back(p);
+  }
+  return packets;
+}
+
+static void put16(std::vector<uint8_t>& p, size_t at, uint16_t v) {
+  p[at] = v >> 8;
+  p[at + 1] = v;
+}
+
+static std::vector<uint8_t> e131Packet(uint16_t universe, uint8_t seq, uint8_t options, const uint8_t* data,
+                                       size_t channels) {
+  static const uint8_t ACN_ID[12] = {'A', 'S', 'C', '-', 'E', '1', '.', '1', '7', 0, 0, 0};
+  static const uint8_t CID[16] = {'R', 'y', 't', 'h', 'm', 'o', 'B', 'o', 't', '-', 's', 'e', 'n', 'd', 'e', 'r'};
+  std::vector<uint8_t> p(E131_HEADER + channels, 0);
+  put16(p, 0, 0x0010);  // Preamble size
+  memcpy(&p[4], ACN_ID, sizeof(ACN_ID));
+  put16(p, 16, 0x7000 | (p.size() - 16));
+  p[21] = 0x04;  // VECTOR_ROOT_E131_DATA
+  memcpy(&p[22], CID, sizeof(CID));
+  put16(p, 38, 0x7000 | (p.size() - 38));
+  p[43] = 0x02;  // VECTOR_E131_DATA_PACKET
+  snprintf((char*)&p[44], 64, "RythmoBot pixel_sender");
+  p[108] = 100;  // Priority
+  p[111] = seq;
+  p[112] = options;
+  put16(p, 113, universe);
+  put16(p, 115, 0x7000 | (p.size() - 115));
+  p[117] = 0x02;  // VECTOR_DMP_SET_PROPERTY
+  p[118] = 0xA1;
+  put16(p, 121, 1);  // Address increment
+  put16(p, 123, channels + 1);
+  memcpy(&p[E131_HEADER], data, channels);
+  return p;
+}
+
+static std::vector<std::vector<uint8_t>> e131Packets(const Options& opt, const std::vector<uint8_t>& rgb,
+                                                     std::vector<uint8_t>& seqs, uint8_t options) {
+  std::vector<std::vector<uint8_t>> packets;
+  for (size_t u = 0; u * E131_CHANNELS < rgb.size(); u++) {
+    size_t offset = u * E131_CHANNELS;
+    packets.push_back(e131Packet(opt.universe + u, ++seqs[u], options, &rgb[offset],
+                                 std::min((size_t)E131_CHANNELS, rgb.size() - offset)));
+  }
+  return packets;
+}
+
+static void usage() {
+  fprintf(stderr,
+          "usage: pixel_sender [--host H] [--proto ddp|e131] [--pixels N] [--fps F] [--seconds N]\n"
+          "                    [--effect rainbow|chase|solid] [--universe U] [--packet-pixels N]\n"
+          "                    [--drop N] [--reorder N] [--terminate]\n");
+  exit(2);
+}
+
+int main(int argc, char** argv) {
+  Options opt;
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    bool hasValue = i + 1 < argc;
+    if (arg == "--host" && hasValue) opt.host = argv[++i];
+    else if (arg == "--proto" && hasValue) opt.proto = argv[++i];
+    else if (arg == "--pixels" && hasValue) opt.pixels = std::max(1, atoi(argv[++i]));
+    else if (arg == "--fps" && hasValue) opt.fps = std::max(0.1, atof(argv[++i]));
+    else if (arg == "--seconds" && hasValue) opt.seconds = atof(argv[++i]);
+    else if (arg == "--effect" && hasValue) opt.effect = argv[++i];
+    else if (arg == "--universe" && hasValue) opt.universe = std::max(1, atoi(argv[++i]));
+    else if (arg == "--packet-pixels" && hasValue) opt.packetPixels = std::max(1, std::min(480, atoi(argv[++i])));
+    else if (arg == "--drop" && hasValue) opt.drop = std::max(0, atoi(argv[++i]));
+    else if (arg == "--reorder" && hasValue) opt.reorder = std::max(0, atoi(argv[++i]));
+    else if (arg == "--terminate") opt.terminate = true;
+    else usage();
+  }
+  if (opt.proto != "ddp" && opt.proto != "e131") usage();
+
+  addrinfo hints = {}, *res = nullptr;
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_DGRAM;
+  std::string port = std::to_string(opt.proto == "ddp" ? DDP_PORT : E131_PORT);
+  if (getaddrinfo(opt.host.c_str(), port.c_str(), &hints, &res) != 0) {
+    fprintf(stderr, "pixel_sender: cannot resolve %s\n", opt.host.c_str());
+    return 1;
+  }
+  int fd = socket(AF_INET, SOCK_DGRAM, 0);
+
+  std::vector<uint8_t> rgb(opt.pixels * 3);
+  std::vector<uint8_t> e131Seqs((rgb.size() + E131_CHANNELS - 1) / E131_CHANNELS, 0);
+  uint8_t ddpSeq = 0;
+  uint64_t packetsSent = 0, packetsDropped = 0, packetsSwapped = 0, bytesSent = 0, sendErrors = 0, packetNo = 0;
+  std::vector<uint8_t> held;  // Packet waiting to go out after its successor (--reorder)
+
+  auto send = [&](const std::vector<uint8_t>& p) {
+    if (sendto(fd, p.data(), p.size(), 0, res->ai_addr, res->ai_addrlen) < 0) {
+      sendErrors++;
+      return;
+    }
+    packetsSent++;
+    bytesSent += p.size();
+  };
+
+  uint64_t intervalUs = (uint64_t)(1e6 / opt.fps);
+  uint32_t frames = (uint32_t)(opt.seconds * opt.fps);
+  uint64_t start = nowUs();
+  for (uint32_t frame = 0; frame < frames; frame++) {
+    uint64_t due = start + frame * intervalUs;
+    uint64_t now = nowUs();
+    if (due > now) std::this_thread::sleep_for(std::chrono::microseconds(due - now));
+
+    render(opt, frame, rgb);
+    auto packets = opt.proto == "ddp" ? ddpPackets(opt, rgb, ddpSeq) : e131Packets(opt, rgb, e131Seqs, 0);
+    for (auto& p : packets) {
+      packetNo++;
+      if (opt.drop && packetNo % opt.drop == 0) {
+        packetsDropped++;
+        continue;
+      }
+      if (opt.reorder && packetNo % opt.reorder == 0) {
+        held = p;
+        continue;
+      }
+      send(p);
+      if (!held.empty()) {
+        send(held);
+        held.clear();
+        packetsSwapped++;
+      }
+    }
+  }
+  if (!held.empty()) send(held);
+  if (opt.terminate && opt.proto == "e131") {
+    for (auto& p : e131Packets(opt, rgb, e131Seqs, E131_OPTION_TERMINATED)) send(p);
+  }
+  double took = (nowUs() - start) / 1e6;
+
+  printf("proto=%s pixels=%d frames=%u seconds=%.2f fps=%.1f\n", opt.proto.c_str(), opt.pixels, frames, took,
+         took > 0 ? frames / took : 0.0);
+  printf("packets sent=%llu bytes=%llu dropped=%llu swapped=%llu errors=%llu\n", (unsigned long long)packetsSent,
+         (unsigned long long)bytesSent, (unsigned long long)packetsDropped, (unsigned long long)packetsSwapped,
+         (unsigned long long)sendErrors);
+  freeaddrinfo(res);
+  close(fd);
+  return sendErrors ? 1 : 0;
+}
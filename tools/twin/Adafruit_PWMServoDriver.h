@@ -0,0 +1,34 @@
+/*
+ * =========================================================
+ * TWIN PCA9685 - RECORDS EVERY CHANNEL WRITE
+ * =========================================================
+ * Recorded as "pwm,<channel>,<off tick>" (0-4095 at 50 Hz).
+ * =========================================================
+ */
+
+#ifndef TWIN_ADAFRUIT_PWM_SERVO_DRIVER_H
+#define TWIN_ADAFRUIT_PWM_SERVO_DRIVER_H
+
+#include <Arduino.h>
+
+class Adafruit_PWMServoDriver {
+public:
+  Adafruit_PWMServoDriver(uint8_t address = 0x40) : address(address) {}
+  bool begin() { return true; }
+  void setOscillatorFrequency(uint32_t) {}
+  void setPWMFreq(float) {}
+  uint8_t setPWM(uint8_t channel, uint16_t on, uint16_t off) {
+    if (channel < 16 && off != offTicks[channel]) {
+      offTicks[channel] = off;
+      twinRecord("pwm", "%u,%u", channel, off);
+    }
+    return 0;
+  }
+
+  uint16_t offTicks[16] = {0};
+
+private:
+  uint8_t address;
+};
+
+#endif
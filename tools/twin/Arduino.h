@@ -0,0 +1,220 @@
+/*
+ * =========================================================
+ * TWIN ARDUINO CORE - ESP32 CORE API FOR THE DIGITAL TWIN
+ * =========================================================
+ * The part of the Arduino/ESP32 core that RythmoBot.ino uses,
+ * implemented on the host. Clock, GPIO, tone and LEDC calls go
+ * to the twin runtime (twin.cpp), which runs them on real or
+ * virtual time and records what the firmware drives.
+ *
+ * Unlike tools/host/Arduino.h (enough for single headers),
+ * this one carries String and Print so the whole sketch builds.
+ * =========================================================
+ */
+
+#ifndef TWIN_ARDUINO_H
+#define TWIN_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <string>
+
+using std::max;
+using std::min;
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define RISING 1
+#define FALLING 2
+#define CHANGE 3
+#define DEC 10
+#define HEX 16
+
+#define PROGMEM
+#define IRAM_ATTR
+#define F(s) (s)
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#define memcpy_P memcpy
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+// -- Provided by the twin runtime --
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+void attachInterrupt(uint8_t interrupt, void (*isr)(), int mode);
+void detachInterrupt(uint8_t interrupt);
+inline uint8_t digitalPinToInterrupt(uint8_t pin) { return pin; }
+void tone(uint8_t pin, unsigned int frequency, unsigned long duration = 0);
+void noTone(uint8_t pin);
+bool ledcAttach(uint8_t pin, uint32_t freq, uint8_t resolution);
+bool ledcWrite(uint8_t pin, uint32_t duty);
+long random(long howBig);
+long random(long howSmall, long howBig);
+void randomSeed(unsigned long seed);
+
+// Recorder line: "<time_us>,<kind>,<fields>"
+void twinRecord(const char* kind, const char* fmt, ...);
+
+inline long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+// === STRING ===
+class String {
+public:
+  String() {}
+  String(const char* s) : str(s ? s : "") {}
+  String(const std::string& s) : str(s) {}
+  String(char c) : str(1, c) {}
+  String(int value) : str(std::to_string(value)) {}
+  String(unsigned int value) : str(std::to_string(value)) {}
+  String(long value) : str(std::to_string(value)) {}
+  String(unsigned long value) : str(std::to_string(value)) {}
+
+  bool reserve(unsigned int size) {
+    str.reserve(size);
+    return true;
+  }
+  unsigned int length() const { return str.size(); }
+  const char* c_str() const { return str.c_str(); }
+  char operator[](unsigned int i) const { return i < str.size() ? str[i] : 0; }
+
+  String substring(unsigned int from) const { return from < str.size() ? String(str.substr(from)) : String(); }
+  String substring(unsigned int from, unsigned int to) const {
+    if (from > to) std::swap(from, to);
+    return from < str.size() ? String(str.substr(from, to - from)) : String();
+  }
+  int indexOf(char c) const {
+    size_t i = str.find(c);
+    return i == std::string::npos ? -1 : (int)i;
+  }
+  bool startsWith(const String& prefix) const { return str.compare(0, prefix.str.size(), prefix.str) == 0; }
+  long toInt() const { return atol(str.c_str()); }
+  void toLowerCase() {
+    for (char& c : str) c = tolower(c);
+  }
+  void trim() {
+    size_t a = str.find_first_not_of(" \t\r\n");
+    size_t b = str.find_last_not_of(" \t\r\n");
+    str = a == std::string::npos ? "" : str.substr(a, b - a + 1);
+  }
+
+  String& operator=(const char* s) {
+    str = s ? s : "";
+    return *this;
+  }
+  String& operator+=(const String& other) {
+    str += other.str;
+    return *this;
+  }
+  friend String operator+(const String& a, const String& b) { return String(a.str + b.str); }
+  friend String operator+(const String& a, const char* b) { return String(a.str + b); }
+  friend String operator+(const char* a, const String& b) { return String(a + b.str); }
+  bool operator==(const String& other) const { return str == other.str; }
+  bool operator==(const char* s) const { return str == s; }
+  bool operator!=(const String& other) const { return str != other.str; }
+  bool operator!=(const char* s) const { return str != s; }
+
+private:
+  std::string str;
+};
+
+// === PRINT ===
+class IPAddress {
+public:
+  IPAddress(uint8_t a = 0, uint8_t b = 0, uint8_t c = 0, uint8_t d = 0) : bytes{a, b, c, d} {}
+  uint8_t operator[](int i) const { return bytes[i]; }
+  String toString() const {
+    char text[16];
+    snprintf(text, sizeof(text), "%u.%u.%u.%u", bytes[0], bytes[1], bytes[2], bytes[3]);
+    return String(text);
+  }
+
+private:
+  uint8_t bytes[4];
+};
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(const uint8_t* buffer, size_t size) = 0;
+  size_t write(uint8_t c) { return write(&c, 1); }
+
+  size_t print(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+  size_t print(const String& s) { return print(s.c_str()); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(unsigned char n, int base = DEC) { return print((unsigned long)n, base); }
+  size_t print(int n, int base = DEC) { return print((long)n, base); }
+  size_t print(unsigned int n, int base = DEC) { return print((unsigned long)n, base); }
+  size_t print(long n, int base = DEC) { return printFormat(base == HEX ? "%lx" : "%ld", n); }
+  size_t print(unsigned long n, int base = DEC) { return printFormat(base == HEX ? "%lx" : "%lu", n); }
+  size_t print(long long n, int base = DEC) { return printFormat(base == HEX ? "%llx" : "%lld", n); }
+  size_t print(unsigned long long n, int base = DEC) { return printFormat(base == HEX ? "%llx" : "%llu", n); }
+  size_t print(double n, int digits = 2) { return printFormat("%.*f", digits, n); }
+  size_t print(const IPAddress& ip) { return print(ip.toString()); }
+
+  size_t println() { return print("\r\n"); }
+  template <typename T> size_t println(const T& value) { return print(value) + println(); }
+  template <typename T> size_t println(const T& value, int format) { return print(value, format) + println(); }
+
+  size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+    char text[256];
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+    return write((const uint8_t*)text, min((size_t)max(n, 0), sizeof(text) - 1));
+  }
+
+private:
+  template <typename... Args> size_t printFormat(const char* format, Args... args) {
+    char text[32];
+    int n = snprintf(text, sizeof(text), format, args...);
+    return write((const uint8_t*)text, min((size_t)max(n, 0), sizeof(text) - 1));
+  }
+};
+
+// Serial goes to stderr when the twin runs with --serial
+class HardwareSerial : public Print {
+public:
+  bool enabled = false;
+  void begin(unsigned long) {}
+  using Print::write;
+  size_t write(const uint8_t* buffer, size_t size) override {
+    if (enabled) fwrite(buffer, 1, size, stderr);
+    return size;
+  }
+};
+
+extern HardwareSerial Serial;
+
+// === ESP ===
+class EspClass {
+public:
+  uint32_t getFreeHeap() { return 200000; }  // Fixed; the twin doesn't model the heap
+};
+
+extern EspClass ESP;
+
+#endif
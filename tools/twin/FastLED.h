@@ -0,0 +1,208 @@
+/*
+ * =========================================================
+ * TWIN FASTLED - COLOUR MATH AND RECORDED SHOW()
+ * =========================================================
+ * CRGB/CHSV, the helpers RythmoBot.ino uses, and a controller
+ * list. show() records each strip whose pixels or brightness
+ * changed as "leds,<pin>,<brightness>,<rrggbb...>" (unscaled).
+ * Colour conversion is a plain HSV spectrum, close to but not
+ * bit-exact with FastLED's rainbow mapping.
+ * =========================================================
+ */
+
+#ifndef TWIN_FASTLED_H
+#define TWIN_FASTLED_H
+
+#include <Arduino.h>
+#include <deque>
+#include <vector>
+
+inline uint8_t scale8(uint8_t i, uint8_t scale) {
+  return ((uint16_t)i * (1 + scale)) >> 8;
+}
+
+inline uint8_t qadd8(uint8_t a, uint8_t b) {
+  return min(255, a + b);
+}
+
+inline uint8_t qsub8(uint8_t a, uint8_t b) {
+  return a > b ? a - b : 0;
+}
+
+inline uint8_t sin8(uint8_t theta) {
+  return (uint8_t)lround(128 + 127 * sin(theta * 2 * M_PI / 256));
+}
+
+inline uint8_t cos8(uint8_t theta) {
+  return sin8(theta + 64);
+}
+
+inline int16_t sin16(uint16_t theta) {
+  return (int16_t)lround(32767 * sin(theta * 2 * M_PI / 65536));
+}
+
+inline int16_t cos16(uint16_t theta) {
+  return sin16(theta + 16384);
+}
+
+inline uint8_t random8() {
+  return random(256);
+}
+
+inline uint8_t random8(uint8_t lim) {
+  return random(lim);
+}
+
+inline uint16_t random16() {
+  return random(65536);
+}
+
+// One full cycle of 65536 per beat
+inline uint16_t beat16(uint16_t bpm, uint32_t timebase = 0) {
+  return (uint16_t)((uint64_t)(millis() - timebase) * bpm * 65536 / 60000);
+}
+
+inline uint8_t beatsin8(uint16_t bpm, uint8_t low = 0, uint8_t high = 255, uint32_t timebase = 0, uint8_t phase = 0) {
+  return low + scale8(sin8((beat16(bpm, timebase) >> 8) + phase), high - low);
+}
+
+inline uint16_t beatsin16(uint16_t bpm, uint16_t low = 0, uint16_t high = 65535, uint32_t timebase = 0,
+                          uint16_t phase = 0) {
+  uint16_t wave = sin16(beat16(bpm, timebase) + phase) + 32768;
+  return low + (uint32_t)wave * (high - low) / 65535;
+}
+
+struct CHSV {
+  uint8_t h, s, v;
+  CHSV() : h(0), s(0), v(0) {}
+  CHSV(uint8_t h, uint8_t s, uint8_t v) : h(h), s(s), v(v) {}
+};
+
+struct CRGB {
+  uint8_t r, g, b;
+
+  enum HTMLColorCode : uint32_t {
+    Black = 0x000000,
+    Blue = 0x0000FF,
+    Green = 0x008000,
+    Orange = 0xFFA500,
+    Purple = 0x800080,
+    Red = 0xFF0000,
+    White = 0xFFFFFF,
+    Yellow = 0xFFFF00
+  };
+
+  CRGB() : r(0), g(0), b(0) {}
+  CRGB(uint8_t r, uint8_t g, uint8_t b) : r(r), g(g), b(b) {}
+  CRGB(uint32_t code) : r(code >> 16), g(code >> 8), b(code) {}
+  CRGB(HTMLColorCode code) : CRGB((uint32_t)code) {}
+  CRGB(const CHSV& hsv) {
+    uint8_t region = hsv.h / 43;
+    uint8_t rem = (hsv.h - region * 43) * 6;
+    uint8_t p = scale8(hsv.v, 255 - hsv.s);
+    uint8_t q = scale8(hsv.v, 255 - scale8(hsv.s, rem));
+    uint8_t t = scale8(hsv.v, 255 - scale8(hsv.s, 255 - rem));
+    switch (region) {
+      case 0: r = hsv.v; g = t; b = p; break;
+      case 1: r = q; g = hsv.v; b = p; break;
+      case 2: r = p; g = hsv.v; b = t; break;
+      case 3: r = p; g = q; b = hsv.v; break;
+      case 4: r = t; g = p; b = hsv.v; break;
+      default: r = hsv.v; g = p; b = q; break;
+    }
+  }
+
+  CRGB& operator+=(const CRGB& other) {
+    r = qadd8(r, other.r);
+    g = qadd8(g, other.g);
+    b = qadd8(b, other.b);
+    return *this;
+  }
+  CRGB& nscale8(uint8_t scale) {
+    r = scale8(r, scale);
+    g = scale8(g, scale);
+    b = scale8(b, scale);
+    return *this;
+  }
+  CRGB& fadeToBlackBy(uint8_t fade) { return nscale8(255 - fade); }
+  uint8_t& operator[](int i) { return i == 0 ? r : (i == 1 ? g : b); }
+  bool operator==(const CRGB& other) const { return r == other.r && g == other.g && b == other.b; }
+  bool operator!=(const CRGB& other) const { return !(*this == other); }
+};
+
+inline void fill_solid(CRGB* leds, int count, const CRGB& color) {
+  for (int i = 0; i < count; i++) leds[i] = color;
+}
+
+inline void fadeToBlackBy(CRGB* leds, uint16_t count, uint8_t fade) {
+  for (int i = 0; i < count; i++) leds[i].fadeToBlackBy(fade);
+}
+
+inline void nscale8(CRGB* leds, uint16_t count, uint8_t scale) {
+  for (int i = 0; i < count; i++) leds[i].nscale8(scale);
+}
+
+inline CRGB blend(const CRGB& a, const CRGB& b, uint8_t amount) {
+  return CRGB(a.r + (((int)b.r - a.r) * amount) / 255, a.g + (((int)b.g - a.g) * amount) / 255,
+              a.b + (((int)b.b - a.b) * amount) / 255);
+}
+
+enum EOrder { RGB, GRB, BRG };
+
+template <uint8_t DATA_PIN, EOrder RGB_ORDER> class WS2812B {};
+template <uint8_t DATA_PIN, EOrder RGB_ORDER> class WS2812 {};
+template <uint8_t DATA_PIN, EOrder RGB_ORDER> class NEOPIXEL {};
+
+class CLEDController {
+public:
+  CRGB* leds = nullptr;
+  int count = 0;
+  uint8_t pin = 0;
+  std::vector<CRGB> lastShown;
+  int lastBrightness = -1;
+
+  // Record the strip if it changed since it was last shown
+  void show(uint8_t brightness) {
+    if (lastBrightness == brightness && std::equal(lastShown.begin(), lastShown.end(), leds)) return;
+    lastShown.assign(leds, leds + count);
+    lastBrightness = brightness;
+    std::string hex(count * 6, '0');
+    for (int i = 0; i < count; i++) snprintf(&hex[i * 6], 7, "%02x%02x%02x", leds[i].r, leds[i].g, leds[i].b);
+    twinRecord("leds", "%u,%u,%s", pin, brightness, hex.c_str());
+  }
+};
+
+class CFastLED {
+public:
+  template <template <uint8_t, EOrder> class CHIPSET, uint8_t DATA_PIN, EOrder RGB_ORDER>
+  CLEDController& addLeds(CRGB* leds, int count, int offset = 0) {
+    controllers.emplace_back();
+    CLEDController& controller = controllers.back();
+    controller.leds = leds + offset;
+    controller.count = count;
+    controller.pin = DATA_PIN;
+    return controller;
+  }
+  void setBrightness(uint8_t value) { brightness = value; }
+  uint8_t getBrightness() { return brightness; }
+  void clear(bool writeData = false) {
+    for (CLEDController& controller : controllers) fill_solid(controller.leds, controller.count, CRGB::Black);
+    if (writeData) show();
+  }
+  void show() {
+    shows++;
+    for (CLEDController& controller : controllers) controller.show(brightness);
+  }
+  int count() { return controllers.size(); }
+  CLEDController& operator[](int i) { return controllers[i]; }
+
+  uint32_t shows = 0;
+
+private:
+  std::deque<CLEDController> controllers;  // addLeds() hands out references
+  uint8_t brightness = 255;
+};
+
+extern CFastLED FastLED;
+
+#endif
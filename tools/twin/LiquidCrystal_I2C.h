@@ -0,0 +1,66 @@
+/*
+ * =========================================================
+ * TWIN LCD - 16x2 CHARACTER BUFFER
+ * =========================================================
+ * Prints update the buffer; the twin calls twinFlush() once
+ * per loop pass, and each row that looks different from what
+ * was last recorded is written as "lcd,<row>,<text>", so a
+ * clear-and-redraw of the same text records nothing.
+ * =========================================================
+ */
+
+#ifndef TWIN_LIQUID_CRYSTAL_I2C_H
+#define TWIN_LIQUID_CRYSTAL_I2C_H
+
+#include <Arduino.h>
+
+class LiquidCrystal_I2C : public Print {
+public:
+  LiquidCrystal_I2C(uint8_t address, uint8_t cols, uint8_t rows) : cols(min(cols, (uint8_t)20)), rows(min(rows, (uint8_t)4)) {
+    clearBuffer();
+    memset(recorded, ' ', sizeof(recorded));
+  }
+  void init() {}
+  void backlight() {}
+  void noBacklight() {}
+  void clear() { clearBuffer(); }
+  void setCursor(uint8_t col, uint8_t row) {
+    cursorCol = col;
+    cursorRow = min(row, (uint8_t)(rows - 1));
+  }
+
+  using Print::write;
+  size_t write(const uint8_t* buffer, size_t size) override {
+    for (size_t i = 0; i < size && cursorCol < cols; i++, cursorCol++) text[cursorRow][cursorCol] = buffer[i];
+    return size;
+  }
+
+  void twinFlush() {
+    for (uint8_t r = 0; r < rows; r++) {
+      if (memcmp(text[r], recorded[r], cols) == 0) continue;
+      memcpy(recorded[r], text[r], cols);
+      char row[21];
+      memcpy(row, text[r], cols);
+      int end = cols;
+      while (end > 0 && row[end - 1] == ' ') end--;
+      row[end] = '\0';
+      twinRecord("lcd", "%u,%s", r, row);
+    }
+  }
+
+  char text[4][20];
+  char recorded[4][20];
+
+private:
+  void clearBuffer() {
+    memset(text, ' ', sizeof(text));
+    cursorCol = cursorRow = 0;
+  }
+
+  uint8_t cols;
+  uint8_t rows;
+  uint8_t cursorCol;
+  uint8_t cursorRow;
+};
+
+#endif
@@ -0,0 +1,62 @@
+/*
+ * =========================================================
+ * TWIN LITTLEFS - FLASH FILES IN A HOST DIRECTORY
+ * =========================================================
+ * "/show.rbl" on the robot is <twinFsRoot>/show.rbl here
+ * (twin.cpp, --fs DIR), so logs survive between runs and can
+ * be copied to or from a real robot.
+ * =========================================================
+ */
+
+#ifndef TWIN_LITTLEFS_H
+#define TWIN_LITTLEFS_H
+
+#include <Arduino.h>
+#include <sys/stat.h>
+#include <memory>
+
+extern std::string twinFsRoot;
+
+class File {
+public:
+  File() {}
+  explicit File(FILE* handle) {
+    if (handle) file.reset(handle, fclose);
+  }
+
+  explicit operator bool() const { return (bool)file; }
+  size_t write(const uint8_t* buffer, size_t size) { return file ? fwrite(buffer, 1, size, file.get()) : 0; }
+  size_t read(uint8_t* buffer, size_t size) { return file ? fread(buffer, 1, size, file.get()) : 0; }
+  size_t size() const {
+    if (!file) return 0;
+    struct stat info;
+    fflush(file.get());
+    return fstat(fileno(file.get()), &info) == 0 ? info.st_size : 0;
+  }
+  void close() { file.reset(); }
+
+private:
+  std::shared_ptr<FILE> file;  // Copies share the handle, like the ESP32 File
+};
+
+class LittleFSFS {
+public:
+  bool begin(bool formatOnFail = false) {
+    mkdir(twinFsRoot.c_str(), 0755);
+    struct stat info;
+    return stat(twinFsRoot.c_str(), &info) == 0 && S_ISDIR(info.st_mode);
+  }
+  File open(const char* path, const char* mode = "r") {
+    std::string hostMode = mode[0] == 'w' ? "wb" : mode[0] == 'a' ? "ab" : "rb";
+    return File(fopen((twinFsRoot + path).c_str(), hostMode.c_str()));
+  }
+  bool exists(const char* path) {
+    struct stat info;
+    return stat((twinFsRoot + path).c_str(), &info) == 0;
+  }
+  bool remove(const char* path) { return ::remove((twinFsRoot + path).c_str()) == 0; }
+};
+
+extern LittleFSFS LittleFS;
+
+#endif
@@ -0,0 +1,396 @@
+/*
+ * =========================================================
+ * TWIN WEBSOCKETS SERVER - RFC 6455 OVER HOST SOCKETS
+ * =========================================================
+ * The subset of the Links2004 WebSocketsServer API the sketch
+ * uses, served from a non-blocking TCP socket so the web app
+ * and tools/loadgen can talk to the twin exactly as they talk
+ * to the robot.
+ *
+ * - Like the library, loop() delivers at most one message per
+ *   client per call and text payloads are NUL-terminated
+ * - Fragmented messages are reassembled; ping is answered
+ * - Unsent output is buffered and flushed from loop()
+ * - Every message in or out is recorded (ws_rx / ws_tx)
+ * =========================================================
+ */
+
+#ifndef TWIN_WEBSOCKETS_SERVER_H
+#define TWIN_WEBSOCKETS_SERVER_H
+
+#include <Arduino.h>
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#define WEBSOCKETS_SERVER_CLIENT_MAX 5
+#define TWIN_WS_MAX_MESSAGE 65536
+
+enum WStype_t {
+  WStype_ERROR,
+  WStype_DISCONNECTED,
+  WStype_CONNECTED,
+  WStype_TEXT,
+  WStype_BIN,
+  WStype_PING,
+  WStype_PONG
+};
+
+typedef void (*WebSocketServerEvent)(uint8_t num, WStype_t type, uint8_t* payload, size_t length);
+
+extern uint16_t twinWebSocketPort;  // Overrides the sketch's port when non-zero
+
+// === HANDSHAKE HELPERS ===
+inline void twinSha1(const uint8_t* data, size_t len, uint8_t out[20]) {
+  uint32_t h[5] = {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0};
+  std::string msg((const char*)data, len);
+  msg += (char)0x80;
+  while (msg.size() % 64 != 56) msg += (char)0;
+  uint64_t bits = (uint64_t)len * 8;
+  for (int i = 7; i >= 0; i--) msg += (char)(bits >> (8 * i));
+
+  for (size_t chunk = 0; chunk < msg.size(); chunk += 64) {
+    uint32_t w[80];
+    for (int i = 0; i < 16; i++) {
+      const uint8_t* p = (const uint8_t*)&msg[chunk + 4 * i];
+      w[i] = (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+    }
+    for (int i = 16; i < 80; i++) {
+      uint32_t x = w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16];
+      w[i] = x << 1 | x >> 31;
+    }
+    uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+    for (int i = 0; i < 80; i++) {
+      uint32_t f, k;
+      if (i < 20) { f = (b & c) | (~b & d); k = 0x5A827999; }
+      else if (i < 40) { f = b ^ c ^ d; k = 0x6ED9EBA1; }
+      else if (i < 60) { f = (b & c) | (b & d) | (c & d); k = 0x8F1BBCDC; }
+      else { f = b ^ c ^ d; k = 0xCA62C1D6; }
+      uint32_t temp = (a << 5 | a >> 27) + f + e + k + w[i];
+      e = d;
+      d = c;
+      c = b << 30 | b >> 2;
+      b = a;
+      a = temp;
+    }
+    h[0] += a; h[1] += b; h[2] += c; h[3] += d; h[4] += e;
+  }
+  for (int i = 0; i < 20; i++) out[i] = h[i / 4] >> (24 - 8 * (i % 4));
+}
+
+inline std::string twinBase64(const uint8_t* data, size_t len) {
+  static const char* table = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  std::string out;
+  for (size_t i = 0; i < len; i += 3) {
+    uint32_t v = data[i] << 16 | (i + 1 < len ? data[i + 1] << 8 : 0) | (i + 2 < len ? data[i + 2] : 0);
+    out += table[v >> 18 & 63];
+    out += table[v >> 12 & 63];
+    out += i + 1 < len ? table[v >> 6 & 63] : '=';
+    out += i + 2 < len ? table[v & 63] : '=';
+  }
+  return out;
+}
+
+// === SERVER ===
+class WebSocketsServer {
+public:
+  WebSocketsServer(uint16_t port) : port(port) {}
+
+  void begin() {
+    uint16_t listenPort = twinWebSocketPort ? twinWebSocketPort : port;
+    listenFd = socket(AF_INET, SOCK_STREAM, 0);
+    int on = 1;
+    setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(listenPort);
+    if (bind(listenFd, (sockaddr*)&addr, sizeof(addr)) < 0 || listen(listenFd, 8) < 0) {
+      fprintf(stderr, "twin: can't listen on port %u: %s\n", listenPort, strerror(errno));
+      exit(1);
+    }
+    fcntl(listenFd, F_SETFL, O_NONBLOCK);
+    fprintf(stderr, "twin: WebSocket server on ws://localhost:%u/\n", listenPort);
+  }
+
+  void onEvent(WebSocketServerEvent cb) { event = cb; }
+  void enableHeartbeat(uint32_t, uint32_t, uint8_t) {}
+
+  void loop() {
+    acceptClients();
+    for (uint8_t num = 0; num < WEBSOCKETS_SERVER_CLIENT_MAX; num++) {
+      Client& client = clients[num];
+      if (client.fd < 0) continue;
+      flush(num);
+      readAvailable(num);
+      if (client.fd >= 0 && !client.open) handshake(num);
+      if (client.fd >= 0 && client.open) deliverOne(num);
+    }
+  }
+
+  IPAddress remoteIP(uint8_t num) {
+    if (num >= WEBSOCKETS_SERVER_CLIENT_MAX) return IPAddress();
+    uint32_t ip = ntohl(clients[num].addr);
+    return IPAddress(ip >> 24, ip >> 16, ip >> 8, ip);
+  }
+
+  bool sendTXT(uint8_t num, const char* payload, size_t length = 0) {
+    return sendFrame(num, 0x1, (const uint8_t*)payload, length ? length : strlen(payload));
+  }
+  bool sendTXT(uint8_t num, const String& payload) { return sendTXT(num, payload.c_str(), payload.length()); }
+  bool sendBIN(uint8_t num, const uint8_t* payload, size_t length) { return sendFrame(num, 0x2, payload, length); }
+
+  bool broadcastTXT(const char* payload, size_t length = 0) {
+    bool ok = true;
+    for (uint8_t num = 0; num < WEBSOCKETS_SERVER_CLIENT_MAX; num++) {
+      if (clients[num].open) ok &= sendTXT(num, payload, length);
+    }
+    return ok;
+  }
+  bool broadcastTXT(const String& payload) { return broadcastTXT(payload.c_str(), payload.length()); }
+
+  bool broadcastBIN(const uint8_t* payload, size_t length) {
+    bool ok = true;
+    for (uint8_t num = 0; num < WEBSOCKETS_SERVER_CLIENT_MAX; num++) {
+      if (clients[num].open) ok &= sendBIN(num, payload, length);
+    }
+    return ok;
+  }
+
+  int connectedClients(bool ping = false) {
+    int count = 0;
+    for (const Client& client : clients) count += client.open;
+    return count;
+  }
+
+  // Deliver a message as if a client had sent it (twin scripts)
+  void inject(uint8_t num, WStype_t type, const uint8_t* payload, size_t length) {
+    std::string copy((const char*)payload, length);
+    twinRecord("ws_rx", "%u,%s", num, describe(type == WStype_TEXT ? 0x1 : 0x2, payload, length).c_str());
+    if (event) event(num, type, (uint8_t*)&copy[0], length);
+  }
+
+private:
+  struct Client {
+    int fd = -1;
+    bool open = false;
+    uint32_t addr = 0;
+    std::string in;
+    std::string out;
+    std::string fragments;
+    uint8_t fragmentOp = 0;
+  };
+
+  void acceptClients() {
+    for (;;) {
+      sockaddr_in addr;
+      socklen_t len = sizeof(addr);
+      int fd = accept(listenFd, (sockaddr*)&addr, &len);
+      if (fd < 0) return;
+      int slot = -1;
+      for (int i = 0; i < WEBSOCKETS_SERVER_CLIENT_MAX && slot < 0; i++) {
+        if (clients[i].fd < 0) slot = i;
+      }
+      if (slot < 0) {
+        close(fd);  // Full, like the library
+        continue;
+      }
+      fcntl(fd, F_SETFL, O_NONBLOCK);
+      int on = 1;
+      setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+      clients[slot] = Client();
+      clients[slot].fd = fd;
+      clients[slot].addr = addr.sin_addr.s_addr;
+    }
+  }
+
+  void readAvailable(uint8_t num) {
+    Client& client = clients[num];
+    char buffer[4096];
+    for (;;) {
+      ssize_t n = recv(client.fd, buffer, sizeof(buffer), 0);
+      if (n > 0) {
+        client.in.append(buffer, n);
+        if (client.in.size() > 4 * TWIN_WS_MAX_MESSAGE) return;
+        continue;
+      }
+      if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) disconnect(num);
+      return;
+    }
+  }
+
+  void handshake(uint8_t num) {
+    Client& client = clients[num];
+    size_t end = client.in.find("\r\n\r\n");
+    if (end == std::string::npos) return;
+    std::string request = client.in.substr(0, end);
+    client.in.erase(0, end + 4);
+
+    std::string key;
+    size_t keyPos = request.find("Sec-WebSocket-Key:");
+    if (keyPos == std::string::npos) keyPos = request.find("sec-websocket-key:");
+    if (keyPos != std::string::npos) {
+      size_t start = request.find_first_not_of(' ', keyPos + 18);
+      key = request.substr(start, request.find("\r\n", start) - start);
+    }
+    if (key.empty()) {
+      disconnect(num);
+      return;
+    }
+    key += "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+    uint8_t digest[20];
+    twinSha1((const uint8_t*)key.data(), key.size(), digest);
+    client.out += "HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+                  "Sec-WebSocket-Accept: " + twinBase64(digest, 20) + "\r\n\r\n";
+    flush(num);
+    client.open = true;
+    size_t pathStart = request.find(' ') + 1;
+    std::string path = request.substr(pathStart, request.find(' ', pathStart) - pathStart);
+    twinRecord("ws_connect", "%u", num);
+    if (event) event(num, WStype_CONNECTED, (uint8_t*)&path[0], path.size());
+  }
+
+  // Parse frames until one complete message has been delivered
+  void deliverOne(uint8_t num) {
+    Client& client = clients[num];
+    for (;;) {
+      const uint8_t* p = (const uint8_t*)client.in.data();
+      size_t have = client.in.size();
+      if (have < 2) return;
+      bool fin = p[0] & 0x80;
+      uint8_t op = p[0] & 0x0F;
+      bool masked = p[1] & 0x80;
+      uint64_t len = p[1] & 0x7F;
+      size_t header = 2;
+      if (len == 126) {
+        if (have < 4) return;
+        len = p[2] << 8 | p[3];
+        header = 4;
+      } else if (len == 127) {
+        if (have < 10) return;
+        len = 0;
+        for (int i = 0; i < 8; i++) len = len << 8 | p[2 + i];
+        header = 10;
+      }
+      if (len > TWIN_WS_MAX_MESSAGE) {
+        disconnect(num);
+        return;
+      }
+      size_t maskAt = header;
+      if (masked) header += 4;
+      if (have < header + len) return;
+
+      std::string payload(client.in, header, len);
+      if (masked) {
+        for (size_t i = 0; i < len; i++) payload[i] ^= p[maskAt + i % 4];
+      }
+      client.in.erase(0, header + len);
+
+      if (op == 0x8) {  // Close
+        sendFrame(num, 0x8, (const uint8_t*)payload.data(), min(payload.size(), (size_t)2));
+        flush(num);
+        disconnect(num);
+        return;
+      }
+      if (op == 0x9) {  // Ping
+        sendFrame(num, 0xA, (const uint8_t*)payload.data(), payload.size());
+        continue;
+      }
+      if (op == 0xA) continue;
+      if (op == 0x0) {
+        client.fragments += payload;
+      } else {
+        client.fragments = payload;
+        client.fragmentOp = op;
+      }
+      if (!fin) continue;
+
+      std::string message;
+      message.swap(client.fragments);
+      twinRecord("ws_rx", "%u,%s", num, describe(client.fragmentOp, (const uint8_t*)message.data(), message.size()).c_str());
+      WStype_t type = client.fragmentOp == 0x1 ? WStype_TEXT : WStype_BIN;
+      size_t length = message.size();
+      message += '\0';
+      if (event) event(num, type, (uint8_t*)&message[0], length);
+      return;
+    }
+  }
+
+  bool sendFrame(uint8_t num, uint8_t op, const uint8_t* payload, size_t length) {
+    if (num >= WEBSOCKETS_SERVER_CLIENT_MAX) {
+      // Script pseudo-client: recorded only
+      twinRecord("ws_tx", "%u,%s", num, describe(op, payload, length).c_str());
+      return true;
+    }
+    Client& client = clients[num];
+    if (!client.open) return false;
+    if (op == 0x1 || op == 0x2) twinRecord("ws_tx", "%u,%s", num, describe(op, payload, length).c_str());
+    client.out += (char)(0x80 | op);
+    if (length < 126) {
+      client.out += (char)length;
+    } else if (length < 65536) {
+      client.out += (char)126;
+      client.out += (char)(length >> 8);
+      client.out += (char)length;
+    } else {
+      client.out += (char)127;
+      for (int i = 7; i >= 0; i--) client.out += (char)((uint64_t)length >> (8 * i));
+    }
+    client.out.append((const char*)payload, length);
+    return flush(num);
+  }
+
+  bool flush(uint8_t num) {
+    Client& client = clients[num];
+    while (!client.out.empty()) {
+      ssize_t n = send(client.fd, client.out.data(), client.out.size(), MSG_NOSIGNAL);
+      if (n > 0) {
+        client.out.erase(0, n);
+        continue;
+      }
+      if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return true;  // Rest goes out from loop()
+      disconnect(num);
+      return false;
+    }
+    return true;
+  }
+
+  void disconnect(uint8_t num) {
+    Client& client = clients[num];
+    if (client.fd < 0) return;
+    close(client.fd);
+    bool wasOpen = client.open;
+    client = Client();
+    if (wasOpen) {
+      twinRecord("ws_disconnect", "%u", num);
+      if (event) event(num, WStype_DISCONNECTED, nullptr, 0);
+    }
+  }
+
+  // Text as-is (commas kept, newlines escaped), binary as "bin:<hex>"
+  static std::string describe(uint8_t op, const uint8_t* payload, size_t length) {
+    std::string text;
+    if (op == 0x1) {
+      for (size_t i = 0; i < length; i++) text += payload[i] == '\n' ? ' ' : (char)payload[i];
+      return text;
+    }
+    text = "bin:";
+    char hex[3];
+    for (size_t i = 0; i < length; i++) {
+      snprintf(hex, sizeof(hex), "%02x", payload[i]);
+      text += hex;
+    }
+    return text;
+  }
+
+  uint16_t port;
+  int listenFd = -1;
+  WebSocketServerEvent event = nullptr;
+  Client clients[WEBSOCKETS_SERVER_CLIENT_MAX];
+};
+
+#endif
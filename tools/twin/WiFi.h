@@ -0,0 +1,25 @@
+/*
+ * =========================================================
+ * TWIN WIFI - ALWAYS CONNECTED ON LOCALHOST
+ * =========================================================
+ */
+
+#ifndef TWIN_WIFI_H
+#define TWIN_WIFI_H
+
+#include <Arduino.h>
+
+#define WL_CONNECTED 3
+
+class WiFiClass {
+public:
+  void begin(const char*, const char*) {}
+  int status() { return WL_CONNECTED; }
+  IPAddress localIP() { return IPAddress(127, 0, 0, 1); }
+  void setSleep(bool) {}
+  void setAutoReconnect(bool) {}
+};
+
+extern WiFiClass WiFi;
+
+#endif
@@ -0,0 +1,71 @@
+/*
+ * =========================================================
+ * TWIN WIFI UDP - DATAGRAMS OVER HOST SOCKETS
+ * =========================================================
+ * The WiFiUDP receive calls the sketch uses, on a non-blocking
+ * socket bound to all interfaces, so tools/pixel_sender (or a
+ * real lighting desk) can stream to the twin. A port that is
+ * already taken leaves the socket closed: parsePacket() then
+ * never returns data, like a robot nobody is sending to.
+ * =========================================================
+ */
+
+#ifndef TWIN_WIFI_UDP_H
+#define TWIN_WIFI_UDP_H
+
+#include <Arduino.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+class WiFiUDP {
+public:
+  ~WiFiUDP() { stop(); }
+
+  uint8_t begin(uint16_t port) {
+    stop();
+    fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd < 0) return 0;
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(port);
+    if (bind(fd, (sockaddr*)&addr, sizeof(addr)) != 0) {
+      fprintf(stderr, "twin: UDP port %u unavailable\n", port);
+      stop();
+      return 0;
+    }
+    fcntl(fd, F_SETFL, O_NONBLOCK);
+    return 1;
+  }
+
+  void stop() {
+    if (fd >= 0) close(fd);
+    fd = -1;
+  }
+
+  // Size of the next datagram, 0 if none; its bytes are then read()
+  int parsePacket() {
+    if (fd < 0) return 0;
+    ssize_t n = recv(fd, packet, sizeof(packet), 0);
+    length = n > 0 ? n : 0;
+    position = 0;
+    return length;
+  }
+
+  int read(uint8_t* buffer, size_t size) {
+    size_t n = min(size, length - position);
+    memcpy(buffer, packet + position, n);
+    position += n;
+    return n;
+  }
+
+private:
+  int fd = -1;
+  uint8_t packet[65536];
+  size_t length = 0;
+  size_t position = 0;
+};
+
+#endif
@@ -0,0 +1,21 @@
+/*
+ * =========================================================
+ * TWIN WIRE - NO I2C BUS, THE DEVICES ARE SIMULATED DIRECTLY
+ * =========================================================
+ */
+
+#ifndef TWIN_WIRE_H
+#define TWIN_WIRE_H
+
+#include <Arduino.h>
+
+class TwoWire {
+public:
+  void begin() {}
+  void begin(int, int) {}
+  void setClock(uint32_t) {}
+};
+
+extern TwoWire Wire;
+
+#endif
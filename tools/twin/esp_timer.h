@@ -0,0 +1,14 @@
+/*
+ * =========================================================
+ * TWIN ESP TIMER - SAME CLOCK AS micros()
+ * =========================================================
+ */
+
+#ifndef TWIN_ESP_TIMER_H
+#define TWIN_ESP_TIMER_H
+
+#include <stdint.h>
+
+int64_t esp_timer_get_time();
+
+#endif
@@ -0,0 +1,407 @@
+/*
+ * =========================================================
+ * RYTHMOBOT DIGITAL TWIN
+ * =========================================================
+ * RythmoBot.ino and its headers, unmodified, built for the
+ * host against the stub libraries in this directory. The twin
+ * serves the same WebSocket protocol on localhost, so the web
+ * app and tools/loadgen can drive it like the real robot.
+ *
+ * Build from the repository root:
+ *   g++ -std=gnu++17 -O2 -Itools/twin -Iarduino -Iarduino/arduino tools/twin/twin.cpp -o rythmobot_twin
+ *
+ * Run:
+ *   ./rythmobot_twin [--port N] [--record FILE|-] [--virtual [TICK_US]]
+ *                    [--duration-ms N] [--script FILE] [--seed N] [--fs DIR] [--serial]
+ *
+ *   --port       listen here instead of the sketch's port 81
+ *   --record     write "<time_us>,<kind>,<fields>" lines: pwm, gpio,
+ *                ledc, tone, leds, lcd, ws_connect, ws_rx, ws_tx ...
+ *   --virtual    virtual clock: starts at 0, advances TICK_US (100)
+ *                per yield(), by the full amount on delay(), and 1 us
+ *                per clock read; runs as fast as the host allows and
+ *                replays a script identically every time
+ *   --script     timed input, one event per line (ms since boot):
+ *                  1500 song:Faded           text command
+ *                  1600 bin:b1010000050107   binary frame (hex)
+ *                  2000 !distance 12         obstacle at 12 cm: each trigger gets an
+ *                                            echo pulse on the echo pin; 0 = none
+ *                  2500 !pulse 34            flip a pin for one read (clap)
+ *                  3000 !pin 34 0            hold an input level (analog value)
+ *                  3500 !tone 34 120 900     sine on an analog input: Hz,
+ *                                            amplitude around mid-scale; 0 0 = off
+ *                                            (advances one audio sample per read)
+ *                  4000 !beat 34 124 1200    kick drum on an analog input: BPM,
+ *                                            peak amplitude; 0 0 = off
+ *                Digital inputs idle HIGH, like the sound sensor.
+ *                A pulse read through analogRead() is one sample at
+ *                the far end of the range, so it still claps when the
+ *                sketch samples the sound sensor as audio.
+ *                Script messages come from pseudo-client 5, whose
+ *                replies are recorded but not sent anywhere.
+ *   --duration-ms  exit (and flush the recording) at this time
+ *   --fs         directory standing in for LittleFS (default twin_fs)
+ *   --serial     echo the sketch's Serial output to stderr
+ * =========================================================
+ */
+
+#include <Arduino.h>
+#include <chrono>
+#include <csignal>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "RythmoBot.ino"
+
+HardwareSerial Serial;
+EspClass ESP;
+WiFiClass WiFi;
+TwoWire Wire;
+CFastLED FastLED;
+LittleFSFS LittleFS;
+uint16_t twinWebSocketPort = 0;
+std::string twinFsRoot = "twin_fs";
+
+// -- TWIN STATE --
+struct TwinEvent {
+  uint64_t atUs;
+  std::string line;
+};
+
+static bool virtualTime = false;
+static uint64_t virtualUs = 0;
+static uint64_t virtualTickUs = 100;
+static uint64_t durationUs = 0;
+static std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+static FILE* recording = nullptr;
+static uint64_t recordedLines = 0;
+static std::vector<TwinEvent> script;
+static size_t scriptNext = 0;
+static std::mt19937 rng(1);
+static volatile sig_atomic_t interrupted = 0;
+static uint64_t yields = 0;
+
+// Pins
+static uint8_t pinOut[64];
+static bool pinOutSet[64];
+static int pinIn[64];  // Analog value; digital reads are HIGH when non-zero
+static bool pinPulse[64];
+static int pinToneHz[64];
+static int pinToneAmp[64];
+static int pinBeatBpm[64];
+static int pinBeatAmp[64];
+static uint64_t pinSignalReads[64];
+static uint32_t ledcDuty[64];
+static unsigned long echoUs = 0;
+static void (*pinIsr[64])();
+static int pinIsrMode[64];
+
+// Input edges due at a time; their interrupts run with the clock at that time
+struct TwinEdge {
+  uint64_t atUs;
+  uint8_t pin;
+  int level;
+};
+static std::vector<TwinEdge> edges;
+static int64_t isrClockUs = -1;
+
+// === CLOCK ===
+static uint64_t nowUs() {
+  if (virtualTime) return virtualUs;
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+static void twinService();
+
+// Each clock read costs the virtual CPU a microsecond, so busy-waits still finish
+unsigned long micros() {
+  if (isrClockUs >= 0) return isrClockUs;
+  if (virtualTime) virtualUs++;
+  return nowUs();
+}
+
+unsigned long millis() {
+  return micros() / 1000;
+}
+
+int64_t esp_timer_get_time() {
+  return micros();
+}
+
+void delay(unsigned long ms) {
+  if (virtualTime) {
+    virtualUs += ms * 1000;
+  } else {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+  }
+  twinService();
+}
+
+void delayMicroseconds(unsigned int us) {
+  if (virtualTime) {
+    virtualUs += us;
+  } else {
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+  }
+}
+
+void yield() {
+  yields++;
+  if (virtualTime) virtualUs += virtualTickUs;
+  twinService();
+}
+
+// === GPIO, TONE, LEDC ===
+void pinMode(uint8_t, uint8_t) {}
+
+// HC-SR04: the trigger's falling edge sends the burst; the echo pin is high for the
+// round trip, or ~38 ms when nothing answers (!distance 0)
+static void twinPing() {
+  uint64_t rise = nowUs() + 200;
+  edges.push_back({rise, ECHO_PIN, HIGH});
+  edges.push_back({rise + (echoUs ? echoUs : 38000), ECHO_PIN, LOW});
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+  if (pin >= 64 || (pinOutSet[pin] && pinOut[pin] == value)) return;
+  pinOut[pin] = value;
+  pinOutSet[pin] = true;
+  twinRecord("gpio", "%u,%u", pin, value);
+  if (pin == TRIG_PIN && value == LOW) twinPing();
+}
+
+void attachInterrupt(uint8_t pin, void (*isr)(), int mode) {
+  if (pin >= 64) return;
+  pinIsr[pin] = isr;
+  pinIsrMode[pin] = mode;
+}
+
+void detachInterrupt(uint8_t pin) {
+  if (pin < 64) pinIsr[pin] = nullptr;
+}
+
+// Apply the edges that are due, in time order, and run their interrupts
+static void twinDeliverEdges(uint64_t now) {
+  std::stable_sort(edges.begin(), edges.end(), [](const TwinEdge& a, const TwinEdge& b) { return a.atUs < b.atUs; });
+  size_t due = 0;
+  for (; due < edges.size() && edges[due].atUs <= now; due++) {
+    const TwinEdge& edge = edges[due];
+    bool changed = (pinIn[edge.pin] != 0) != (edge.level != 0);
+    pinIn[edge.pin] = edge.level;
+    int mode = pinIsrMode[edge.pin];
+    if (!changed || !pinIsr[edge.pin]) continue;
+    if (mode == CHANGE || (mode == RISING) == (edge.level == HIGH)) {
+      isrClockUs = edge.atUs;
+      pinIsr[edge.pin]();
+      isrClockUs = -1;
+    }
+  }
+  edges.erase(edges.begin(), edges.begin() + due);
+}
+
+int digitalRead(uint8_t pin) {
+  if (pin >= 64) return LOW;
+  int level = pinIn[pin] ? HIGH : LOW;
+  if (pinPulse[pin]) {
+    pinPulse[pin] = false;
+    return !level;
+  }
+  return level;
+}
+
+int analogRead(uint8_t pin) {
+  if (pin >= 64) return 0;
+  int value = pinIn[pin];
+  if (pinToneAmp[pin] || pinBeatAmp[pin]) {
+    double t = (double)pinSignalReads[pin]++ / AUDIO_SAMPLE_HZ;  // Catch-up reads in one pass are still spaced
+    double x = pinToneAmp[pin] * sin(2 * M_PI * pinToneHz[pin] * t);
+    if (pinBeatAmp[pin] && pinBeatBpm[pin] > 0) {
+      double sinceBeat = fmod(t, 60.0 / pinBeatBpm[pin]);  // Thump falling from 120 Hz, and a click
+      x += pinBeatAmp[pin] * exp(-sinceBeat / 0.05) * sin(2 * M_PI * (60 + 60 * exp(-sinceBeat / 0.02)) * sinceBeat);
+      x += pinBeatAmp[pin] * 0.3 * exp(-sinceBeat / 0.005) * sin(2 * M_PI * 3000 * sinceBeat);
+    }
+    value = 2048 + (int)lround(x);
+  }
+  if (pinPulse[pin]) {
+    pinPulse[pin] = false;
+    return value > 2047 ? 0 : 4095;
+  }
+  return constrain(value, 0, 4095);
+}
+
+void tone(uint8_t pin, unsigned int frequency, unsigned long duration) {
+  twinRecord("tone", "%u,%u", pin, frequency);
+}
+
+void noTone(uint8_t pin) {
+  twinRecord("tone", "%u,0", pin);
+}
+
+bool ledcAttach(uint8_t pin, uint32_t freq, uint8_t resolution) {
+  return true;
+}
+
+bool ledcWrite(uint8_t pin, uint32_t duty) {
+  if (pin < 64 && ledcDuty[pin] != duty) {
+    ledcDuty[pin] = duty;
+    twinRecord("ledc", "%u,%u", pin, duty);
+  }
+  return true;
+}
+
+long random(long howBig) {
+  return howBig > 0 ? (long)(rng() % howBig) : 0;
+}
+
+long random(long howSmall, long howBig) {
+  return howBig > howSmall ? howSmall + random(howBig - howSmall) : howSmall;
+}
+
+void randomSeed(unsigned long seed) {
+  // Ignored: the twin's --seed decides, so runs are repeatable
+}
+
+// === RECORDER ===
+void twinRecord(const char* kind, const char* fmt, ...) {
+  if (!recording) return;
+  fprintf(recording, "%llu,%s,", (unsigned long long)nowUs(), kind);
+  va_list args;
+  va_start(args, fmt);
+  vfprintf(recording, fmt, args);
+  va_end(args);
+  fputc('\n', recording);
+  recordedLines++;
+}
+
+static void twinFinish() {
+  if (recording) {
+    twinRecord("end", "%llu", (unsigned long long)yields);
+    fflush(recording);
+    if (recording != stdout) fclose(recording);
+    recording = nullptr;
+  }
+  fprintf(stderr, "twin: stopped at %.3f s, %llu loop yields, %u LED shows, %llu recorded lines\n", nowUs() / 1e6,
+          (unsigned long long)yields, FastLED.shows, (unsigned long long)recordedLines);
+}
+
+// === SCRIPT ===
+static std::vector<uint8_t> parseHex(const char* hex) {
+  std::vector<uint8_t> bytes;
+  for (; hex[0] && hex[1]; hex += 2) {
+    unsigned value;
+    if (sscanf(hex, "%2x", &value) != 1) break;
+    bytes.push_back(value);
+  }
+  return bytes;
+}
+
+static void runScriptLine(const std::string& line) {
+  const char* text = line.c_str();
+  int pin, value, amplitude;
+  if (sscanf(text, "!distance %d", &value) == 1) {
+    echoUs = value > 0 ? (unsigned long)(value * 2 / 0.0343) : 0;
+  } else if (sscanf(text, "!pulse %d", &pin) == 1 && pin >= 0 && pin < 64) {
+    pinPulse[pin] = true;
+  } else if (sscanf(text, "!pin %d %d", &pin, &value) == 2 && pin >= 0 && pin < 64) {
+    pinIn[pin] = value;
+  } else if (sscanf(text, "!tone %d %d %d", &pin, &value, &amplitude) == 3 && pin >= 0 && pin < 64) {
+    pinToneHz[pin] = value;
+    pinToneAmp[pin] = amplitude;
+  } else if (sscanf(text, "!beat %d %d %d", &pin, &value, &amplitude) == 3 && pin >= 0 && pin < 64) {
+    pinBeatBpm[pin] = value;
+    pinBeatAmp[pin] = amplitude;
+  } else if (strncmp(text, "bin:", 4) == 0) {
+    std::vector<uint8_t> frame = parseHex(text + 4);
+    webSocket.inject(WEBSOCKETS_SERVER_CLIENT_MAX, WStype_BIN, frame.data(), frame.size());
+  } else {
+    webSocket.inject(WEBSOCKETS_SERVER_CLIENT_MAX, WStype_TEXT, (const uint8_t*)text, line.size());
+  }
+}
+
+static bool loadScript(const char* path) {
+  FILE* file = fopen(path, "r");
+  if (!file) return false;
+  char buffer[1024];
+  while (fgets(buffer, sizeof(buffer), file)) {
+    char* end = buffer + strcspn(buffer, "\r\n");
+    *end = '\0';
+    unsigned long ms;
+    int offset;
+    if (buffer[0] == '#' || sscanf(buffer, "%lu %n", &ms, &offset) != 1) continue;
+    script.push_back({(uint64_t)ms * 1000, buffer + offset});
+  }
+  fclose(file);
+  std::stable_sort(script.begin(), script.end(), [](const TwinEvent& a, const TwinEvent& b) { return a.atUs < b.atUs; });
+  return true;
+}
+
+// Called from yield() and delay(): display state, due script events, end of run
+static void twinService() {
+  lcd.twinFlush();
+  uint64_t now = nowUs();
+  twinDeliverEdges(now);
+  while (scriptNext < script.size() && script[scriptNext].atUs <= now) {
+    runScriptLine(script[scriptNext++].line);
+  }
+  if (interrupted || (durationUs && now >= durationUs)) {
+    twinFinish();
+    exit(0);
+  }
+}
+
+static void onSignal(int) {
+  interrupted = 1;
+}
+
+static void usage() {
+  fprintf(stderr,
+          "usage: rythmobot_twin [--port N] [--record FILE|-] [--virtual [TICK_US]] [--duration-ms N]\n"
+          "                      [--script FILE] [--seed N] [--fs DIR] [--serial]\n");
+  exit(2);
+}
+
+int main(int argc, char** argv) {
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    bool hasValue = i + 1 < argc && argv[i + 1][0] != '-';
+    if (arg == "--port" && hasValue) {
+      twinWebSocketPort = atoi(argv[++i]);
+    } else if (arg == "--record" && i + 1 < argc) {
+      const char* path = argv[++i];
+      recording = strcmp(path, "-") == 0 ? stdout : fopen(path, "w");
+      if (!recording) {
+        fprintf(stderr, "twin: can't write %s\n", path);
+        return 1;
+      }
+    } else if (arg == "--virtual") {
+      virtualTime = true;
+      if (hasValue) virtualTickUs = strtoull(argv[++i], nullptr, 10);
+    } else if (arg == "--duration-ms" && hasValue) {
+      durationUs = strtoull(argv[++i], nullptr, 10) * 1000;
+    } else if (arg == "--script" && hasValue) {
+      if (!loadScript(argv[++i])) {
+        fprintf(stderr, "twin: can't read %s\n", argv[i]);
+        return 1;
+      }
+    } else if (arg == "--seed" && hasValue) {
+      rng.seed(strtoul(argv[++i], nullptr, 10));
+    } else if (arg == "--fs" && hasValue) {
+      twinFsRoot = argv[++i];
+    } else if (arg == "--serial") {
+      Serial.enabled = true;
+    } else {
+      usage();
+    }
+  }
+
+  std::fill(pinIn, pinIn + 64, 1);
+
+  signal(SIGINT, onSignal);
+  signal(SIGTERM, onSignal);
+  signal(SIGPIPE, SIG_IGN);
+
+  setup();
+  loop();  // Never returns; twinService() exits
+  return 0;
+}